@@ -18,8 +18,23 @@
  * [2] Alan H. Karp and Peter Markstein. 1997. High-precision division and
  *     square root. ACM Trans. Math. Softw. 23, 4 (Dec. 1997), 561–589.
  *     https://dl.acm.org/doi/pdf/10.1145/279232.279237
+ *
+ * [3] T. J. Dekker. A floating-point technique for extending the available
+ *     precision. Numerische Mathematik 18, 3 (June 1971), 224–242.
+ *     https://doi.org/10.1007/BF01397083
  */
 
+/*
+ * Without a fast fma (FP_FAST_FMA, from math.h), fma is a function call,
+ * in software on older processors, so compute the error of a product with
+ * Dekker's algorithm instead (mul_dekker). Define ARITHMETIC_NO_FMA to
+ * use it anyway.
+ */
+
+#if defined(FP_FAST_FMA) && !defined(ARITHMETIC_NO_FMA)
+#define ARITHMETIC_FMA 1
+#endif
+
 /*
  * Return the sum and its error. See TwoSum_k, page 178. [1]
  */
@@ -57,7 +72,7 @@ add_double(double a, double b)
 static inline tuple_float
 __attribute__((always_inline))
 __attribute__((const))
-mul_float(float a, float b)
+mul_fma_float(float a, float b)
 {
     float x = a * b;
     return (tuple_float) {x, fmaf(a, b, -x)};
@@ -66,12 +81,79 @@ mul_float(float a, float b)
 static inline tuple_double
 __attribute__((always_inline))
 __attribute__((const))
-mul_double(double a, double b)
+mul_fma_double(double a, double b)
 {
     double x = a * b;
     return (tuple_double) {x, fma(a, b, -x)};
 }
 
+/*
+ * Return the high 26 bits and the rest of a, with Veltkamp's splitting,
+ * such that a = hi + lo exactly. See mul12, page 234. [3]
+ */
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+split_double(double a)
+{
+    double g = 0x1.0000002p27 * a; // 2²⁷ + 1
+    double hi = g - (g - a);
+    return (tuple_double) {hi, a - hi};
+}
+
+/*
+ * Return the product and its error, without fma, for |a⋅b| < 2⁹⁹⁶
+ * (splitting does not overflow) and no underflow. See mul12. [3]
+ * For floats, the product of two 24-bit significands fits in a double.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+mul_dekker_float(float a, float b)
+{
+    double p = (double) a * (double) b;
+    float x = (float) p;
+    return (tuple_float) {x, (float) (p - (double) x)};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+mul_dekker_double(double a, double b)
+{
+    double x = a * b;
+    tuple_double sa = split_double(a);
+    tuple_double sb = split_double(b);
+    double e = ((sa.a * sb.a - x) + sa.a * sb.b + sa.b * sb.a) + sa.b * sb.b;
+    return (tuple_double) {x, e};
+}
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+mul_float(float a, float b)
+{
+#if defined(ARITHMETIC_FMA)
+    return mul_fma_float(a, b);
+#else
+    return mul_dekker_float(a, b);
+#endif
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+mul_double(double a, double b)
+{
+#if defined(ARITHMETIC_FMA)
+    return mul_fma_double(a, b);
+#else
+    return mul_dekker_double(a, b);
+#endif
+}
+
 #define mul(a, b) \
     _Generic((a), \
         float: mul_float, \
@@ -109,3 +191,79 @@ xfma_double(double a, double b, double c)
         float: xfma_float, \
         double: xfma_double \
     )(a, b, c)
+
+/*
+ * Return a⋅b + c, with one rounding with a fast fma, and otherwise two,
+ * of the product and of the sum, without a call to a software fma: for
+ * the polynomials, the estimates of a quotient and the error terms,
+ * which do not need the single rounding.
+ */
+
+static inline float
+__attribute__((always_inline))
+__attribute__((const))
+madd_float(float a, float b, float c)
+{
+#if defined(ARITHMETIC_FMA)
+    return fmaf(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+madd_double(double a, double b, double c)
+{
+#if defined(ARITHMETIC_FMA)
+    return fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+#define madd(a, b, c) \
+    _Generic((a), \
+        float: madd_float, \
+        double: madd_double \
+    )(a, b, c)
+
+/*
+ * Return c - a⋅b, rounded once, for c∕2 ≤ a⋅b ≤ 2c (or a⋅b = 0), as the
+ * remainders of the reductions: with fma, or with Dekker's product
+ * a⋅b = p + e, where c - p is exact (Sterbenz), so (c - p) - e is the
+ * only rounding. Elsewhere, the result is within an ulp of fma's.
+ * For floats, c - a⋅b is exact in double there, as in mul_dekker_float.
+ */
+
+static inline float
+__attribute__((always_inline))
+__attribute__((const))
+nmadd_float(float a, float b, float c)
+{
+#if defined(ARITHMETIC_FMA)
+    return fmaf(-a, b, c);
+#else
+    return (float) ((double) c - (double) a * (double) b);
+#endif
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+nmadd_double(double a, double b, double c)
+{
+#if defined(ARITHMETIC_FMA)
+    return fma(-a, b, c);
+#else
+    tuple_double p = mul_dekker_double(a, b);
+    return (c - p.a) - p.b;
+#endif
+}
+
+#define nmadd(a, b, c) \
+    _Generic((a), \
+        float: nmadd_float, \
+        double: nmadd_double \
+    )(a, b, c)
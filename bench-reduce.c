@@ -0,0 +1,283 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Measure the latency and the throughput of the reductions (reduce.h),
+ * naive, Cody-Waite, Boldo-Daumas-Li and Payne-Hanek, and of the error-free
+ * product (arithmetic.h), with fma and with Dekker's product, in cycles
+ * per element (bench.h), on the magnitudes of magnitudes.h, up to the
+ * thresholds of Payne-Hanek:
+ *
+ *     make DEBUG=0 bench-reduce && ./bench-reduce > bench-reduce.csv
+ *
+ * The reductions are built for each level of isa.h, and chosen at load
+ * time; set ISA_LEVEL=2 in the environment to measure x86-64-v2, without
+ * fma. mul_fma and mul_dekker, below, are built for x86-64-v2 (the default
+ * on x86-64), where fma is a call to libm; build with make DISPATCH=0 to
+ * compare with the fma instruction. On a processor with FMA, glibc's fma
+ * is the instruction too, chosen at load time; to measure its software
+ * fma, as on a processor without FMA, disable the instruction:
+ *
+ *     GLIBC_TUNABLES=glibc.cpu.hwcaps=-FMA,-FMA4,-AVX2 ./bench-reduce
+ */
+
+#define _GNU_SOURCE // sched_getcpu, sched_setaffinity
+
+#include <assert.h>
+#include <math.h> // FP_FAST_FMA
+#include <stddef.h> // size_t, NULL
+#include <stdint.h> // int32_t, int64_t
+#include <stdlib.h> // calloc, srand48
+#include <stdio.h> // printf
+
+#include "arithmetic.h" // mul_dekker, mul_fma
+#include "bench.h"
+#include "isa.h" // _reduce_isa_level
+#include "magnitudes.h"
+#include "reduce.h"
+#include "types.h" // quadrant_result_double, rem_result_double, tuple_double
+
+// The size of the benchmark arrays.
+static const size_t n = 100000;
+
+// The number of runs; keep the fastest.
+static const int runs = 20;
+
+static float *xfs, *yfs, *zfs, *wfs;
+static double *xds, *yds, *zds, *wds;
+static int32_t *qfs;
+static int64_t *qds;
+
+/*
+ * The function under test, and the loops that call it.
+ */
+
+static rem_result_float (*rem_float)(float);
+static rem_result_double (*rem_double)(double);
+static quadrant_result_double (*quadrant_double)(double);
+
+static void
+throughput_rem_float(void)
+{
+    for (size_t i = 0; i < n; i++)
+        yfs[i] = (*rem_float)(xfs[i]).v1;
+}
+
+static void
+latency_rem_float(void)
+{
+    float y = 0.0f;
+    for (size_t i = 0; i < n; i++)
+        y = (*rem_float)(xfs[i] + y * 0.0f).v1;
+    yfs[0] = y;
+}
+
+static void
+throughput_rem_double(void)
+{
+    for (size_t i = 0; i < n; i++)
+        yds[i] = (*rem_double)(xds[i]).v1;
+}
+
+static void
+latency_rem_double(void)
+{
+    double y = 0.0;
+    for (size_t i = 0; i < n; i++)
+        y = (*rem_double)(xds[i] + y * 0.0).v1;
+    yds[0] = y;
+}
+
+static void
+throughput_quadrant_double(void)
+{
+    for (size_t i = 0; i < n; i++)
+        yds[i] = (*quadrant_double)(xds[i]).v1;
+}
+
+static void
+latency_quadrant_double(void)
+{
+    double y = 0.0;
+    for (size_t i = 0; i < n; i++)
+        y = (*quadrant_double)(xds[i] + y * 0.0).v1;
+    yds[0] = y;
+}
+
+static rem_result_float identity_float(float x) { return (rem_result_float) {0, x, 0.0f}; }
+static rem_result_double identity_double(double x) { return (rem_result_double) {0, x, 0.0}; }
+
+static const struct {
+    const char *name;
+    rem_result_float (*rem_float)(float);
+    rem_result_double (*rem_double)(double);
+} rem_functions[] = {
+    {"identity", &identity_float, &identity_double},
+    {"naive_rem_pi", &naive_rem_pi_float, &naive_rem_pi_double},
+    {"naive_rem_2pi", &naive_rem_2pi_float, &naive_rem_2pi_double},
+    {"naive_rem_pi_2", &naive_rem_pi_2_float, &naive_rem_pi_2_double},
+    {"cw_rem_pi", &cw_rem_pi_float, &cw_rem_pi_double},
+    {"cw_rem_2pi", &cw_rem_2pi_float, &cw_rem_2pi_double},
+    {"cw_rem_pi_2", &cw_rem_pi_2_float, &cw_rem_pi_2_double},
+    {"bdl_rem_pi", &bdl_rem_pi_float, &bdl_rem_pi_double},
+    {"bdl_rem_2pi", &bdl_rem_2pi_float, &bdl_rem_2pi_double},
+    {"bdl_rem_pi_2", &bdl_rem_pi_2_float, &bdl_rem_pi_2_double},
+    {"bdl_dekker_rem_pi_2", &bdl_dekker_rem_pi_2_float, &bdl_dekker_rem_pi_2_double},
+    {"ph_rem_pi_2", &ph_rem_pi_2_float, &ph_rem_pi_2_double},
+};
+
+static const size_t n_rem_functions = sizeof rem_functions / sizeof rem_functions[0];
+
+/*
+ * The quadrant variants of the Boldo-Daumas-Li reduction, valid up to 2⁴⁸
+ * (see test-reduce.c).
+ */
+
+static const struct {
+    const char *name;
+    quadrant_result_double (*function)(double);
+} quadrant_functions[] = {
+    {"bdl_quadrant_pi_2", &bdl_quadrant_pi_2_double},
+    {"bdl_dekker_quadrant_pi_2", &bdl_dekker_quadrant_pi_2_double},
+};
+
+static const size_t n_quadrant_functions = sizeof quadrant_functions / sizeof quadrant_functions[0];
+
+/*
+ * The array functions.
+ */
+
+static void cw_array_float(void) { cw_rem_pi_2_array(xfs, n, qfs, yfs, zfs); }
+static void cw_array_double(void) { cw_rem_pi_2_array(xds, n, qds, yds, zds); }
+static void bdl_array_float(void) { bdl_rem_pi_2_array(xfs, n, qfs, yfs, zfs); }
+static void bdl_array_double(void) { bdl_rem_pi_2_array(xds, n, qds, yds, zds); }
+static void bdl_quadrant_array_float(void) { bdl_quadrant_pi_2_array(xfs, n, wfs, yfs, zfs); }
+static void bdl_quadrant_array_double(void) { bdl_quadrant_pi_2_array(xds, n, wds, yds, zds); }
+
+static const struct {
+    const char *name;
+    void (*function_float)(void);
+    void (*function_double)(void);
+} array_functions[] = {
+    {"cw_rem_pi_2_array", &cw_array_float, &cw_array_double},
+    {"bdl_rem_pi_2_array", &bdl_array_float, &bdl_array_double},
+    {"bdl_quadrant_pi_2_array", &bdl_quadrant_array_float, &bdl_quadrant_array_double},
+};
+
+static const size_t n_array_functions = sizeof array_functions / sizeof array_functions[0];
+
+/*
+ * The error-free product, inlined, on xs and ys in [-1, 1].
+ */
+
+static void
+throughput_mul_fma(void)
+{
+    for (size_t i = 0; i < n; i++)
+        zds[i] = mul_fma_double(xds[i], yds[i]).b;
+}
+
+static void
+latency_mul_fma(void)
+{
+    double z = 0.0;
+    for (size_t i = 0; i < n; i++)
+        z = mul_fma_double(xds[i] + z * 0.0, yds[i]).b;
+    zds[0] = z;
+}
+
+static void
+throughput_mul_dekker(void)
+{
+    for (size_t i = 0; i < n; i++)
+        zds[i] = mul_dekker_double(xds[i], yds[i]).b;
+}
+
+static void
+latency_mul_dekker(void)
+{
+    double z = 0.0;
+    for (size_t i = 0; i < n; i++)
+        z = mul_dekker_double(xds[i] + z * 0.0, yds[i]).b;
+    zds[0] = z;
+}
+
+int
+main(void)
+{
+    xfs = calloc(n, sizeof (float));
+    yfs = calloc(n, sizeof (float));
+    zfs = calloc(n, sizeof (float));
+    wfs = calloc(n, sizeof (float));
+    xds = calloc(n, sizeof (double));
+    yds = calloc(n, sizeof (double));
+    zds = calloc(n, sizeof (double));
+    wds = calloc(n, sizeof (double));
+    qfs = calloc(n, sizeof (int32_t));
+    qds = calloc(n, sizeof (int64_t));
+    assert(xfs != NULL && yfs != NULL && zfs != NULL && wfs != NULL);
+    assert(xds != NULL && yds != NULL && zds != NULL && wds != NULL);
+    assert(qfs != NULL && qds != NULL);
+
+    bench_header();
+#if defined(ISA_DISPATCH)
+    printf("# level: x86-64-v%d (isa.h)\n", _reduce_isa_level());
+#endif
+#if defined(FP_FAST_FMA)
+    printf("# fma: instruction\n");
+#else
+    printf("# fma: function call\n");
+#endif
+    bench_columns();
+
+    srand48(1);
+    for (size_t j = 0; j < N_CW_MAGNITUDES_FLOAT; j++) {
+        float m = magnitudes_float[j];
+        bench_arguments_float(xfs, n, m);
+        for (size_t f = 0; f < n_rem_functions; f++) {
+            rem_float = rem_functions[f].rem_float;
+            bench_print(rem_functions[f].name, "float", "latency", m, bench(&latency_rem_float, n, runs));
+            bench_print(rem_functions[f].name, "float", "throughput", m, bench(&throughput_rem_float, n, runs));
+        }
+        for (size_t f = 0; f < n_array_functions; f++)
+            bench_print(array_functions[f].name, "float", "throughput", m,
+                bench(array_functions[f].function_float, n, runs));
+    }
+    for (size_t j = 0; j < N_CW_MAGNITUDES_DOUBLE; j++) {
+        double m = magnitudes_double[j];
+        bench_arguments_double(xds, n, m);
+        for (size_t f = 0; f < n_rem_functions; f++) {
+            rem_double = rem_functions[f].rem_double;
+            bench_print(rem_functions[f].name, "double", "latency", m, bench(&latency_rem_double, n, runs));
+            bench_print(rem_functions[f].name, "double", "throughput", m, bench(&throughput_rem_double, n, runs));
+        }
+        for (size_t f = 0; f < n_quadrant_functions && m <= 0x1.0p+48; f++) {
+            quadrant_double = quadrant_functions[f].function;
+            bench_print(quadrant_functions[f].name, "double", "latency", m,
+                bench(&latency_quadrant_double, n, runs));
+            bench_print(quadrant_functions[f].name, "double", "throughput", m,
+                bench(&throughput_quadrant_double, n, runs));
+        }
+        for (size_t f = 0; f < n_array_functions; f++)
+            bench_print(array_functions[f].name, "double", "throughput", m,
+                bench(array_functions[f].function_double, n, runs));
+    }
+
+    bench_arguments_double(xds, n, 1.0);
+    bench_arguments_double(yds, n, 1.0);
+    bench_print("mul_fma", "double", "latency", 1.0, bench(&latency_mul_fma, n, runs));
+    bench_print("mul_fma", "double", "throughput", 1.0, bench(&throughput_mul_fma, n, runs));
+    bench_print("mul_dekker", "double", "latency", 1.0, bench(&latency_mul_dekker, n, runs));
+    bench_print("mul_dekker", "double", "throughput", 1.0, bench(&throughput_mul_dekker, n, runs));
+
+    free(qds);
+    free(qfs);
+    free(wds);
+    free(zds);
+    free(yds);
+    free(xds);
+    free(wfs);
+    free(zfs);
+    free(yfs);
+    free(xfs);
+    return 0;
+}
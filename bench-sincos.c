@@ -0,0 +1,261 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Measure the latency and the throughput of the functions of sincos.h,
+ * and of sin and cos of libm, in cycles per element (bench.h), on the
+ * magnitudes of magnitudes.h:
+ *
+ *     make DEBUG=0 bench-sincos && ./bench-sincos > bench-sincos.csv
+ *
+ * Build with make TABLE=1 for the table-driven backend (sincos-table.h),
+ * and compare with the default polynomial backend;
+ * build with make SIMD=0 to disable the vector kernels (sincos-simd.h).
+ * Set ISA_LEVEL=2 or 3 in the environment to compare the levels of isa.h.
+ */
+
+#define _GNU_SOURCE // sched_getcpu, sched_setaffinity, sincos
+
+#include <assert.h>
+#include <math.h> // cos, sin, tan
+#include <stddef.h> // size_t, NULL
+#include <stdlib.h> // calloc, srand48
+#include <stdio.h> // printf
+
+#include "bench.h"
+#include "isa.h" // _sincos_isa_level
+#include "magnitudes.h"
+#include "sincos.h"
+#include "sincos-simd.h" // SINCOS_SIMD
+
+// The size of the benchmark arrays.
+static const size_t n = 100000;
+
+// The number of runs; keep the fastest.
+static const int runs = 20;
+
+static float *xfs, *sfs, *cfs;
+static double *xds, *sds, *cds;
+
+/*
+ * The function under test, and the loops that call it.
+ */
+
+static float (*function_float)(float);
+static double (*function_double)(double);
+static void (*sincos_float)(float, float *, float *);
+static void (*sincos_double)(double, double *, double *);
+
+static void
+throughput_float(void)
+{
+    for (size_t i = 0; i < n; i++)
+        sfs[i] = (*function_float)(xfs[i]);
+}
+
+static void
+latency_float(void)
+{
+    float y = 0.0f;
+    for (size_t i = 0; i < n; i++)
+        y = (*function_float)(xfs[i] + y * 0.0f);
+    sfs[0] = y;
+}
+
+static void
+throughput_double(void)
+{
+    for (size_t i = 0; i < n; i++)
+        sds[i] = (*function_double)(xds[i]);
+}
+
+static void
+latency_double(void)
+{
+    double y = 0.0;
+    for (size_t i = 0; i < n; i++)
+        y = (*function_double)(xds[i] + y * 0.0);
+    sds[0] = y;
+}
+
+static void
+throughput_sincos_float(void)
+{
+    for (size_t i = 0; i < n; i++)
+        (*sincos_float)(xfs[i], &sfs[i], &cfs[i]);
+}
+
+static void
+latency_sincos_float(void)
+{
+    float s = 0.0f, c = 0.0f;
+    for (size_t i = 0; i < n; i++)
+        (*sincos_float)(xfs[i] + (s + c) * 0.0f, &s, &c);
+    sfs[0] = s;
+    cfs[0] = c;
+}
+
+static void
+throughput_sincos_double(void)
+{
+    for (size_t i = 0; i < n; i++)
+        (*sincos_double)(xds[i], &sds[i], &cds[i]);
+}
+
+static void
+latency_sincos_double(void)
+{
+    double s = 0.0, c = 0.0;
+    for (size_t i = 0; i < n; i++)
+        (*sincos_double)(xds[i] + (s + c) * 0.0, &s, &c);
+    sds[0] = s;
+    cds[0] = c;
+}
+
+static float identity_float(float x) { return x; }
+static double identity_double(double x) { return x; }
+
+static const struct {
+    const char *name;
+    float (*function_float)(float);
+    double (*function_double)(double);
+} functions[] = {
+    {"identity", &identity_float, &identity_double},
+    {"_sin", &_sin_float, &_sin_double},
+    {"_cos", &_cos_float, &_cos_double},
+    {"_sin_cr", &_sin_cr_float, &_sin_cr_double},
+    {"_cos_cr", &_cos_cr_float, &_cos_cr_double},
+    {"_sinpi", &_sinpi_float, &_sinpi_double},
+    {"_cospi", &_cospi_float, &_cospi_double},
+    {"_sind", &_sind_float, &_sind_double},
+    {"_cosd", &_cosd_float, &_cosd_double},
+    {"_tan", &_tan_float, &_tan_double},
+    {"libm sin", &sinf, &sin},
+    {"libm cos", &cosf, &cos},
+    {"libm tan", &tanf, &tan},
+};
+
+static const size_t n_functions = sizeof functions / sizeof functions[0];
+
+static const struct {
+    const char *name;
+    void (*sincos_float)(float, float *, float *);
+    void (*sincos_double)(double, double *, double *);
+} sincos_functions[] = {
+    {"_sincos", &_sincos_float, &_sincos_double},
+    {"_sincos_cr", &_sincos_cr_float, &_sincos_cr_double},
+    {"_sincospi", &_sincospi_float, &_sincospi_double},
+    {"libm sincos", &sincosf, &sincos},
+};
+
+static const size_t n_sincos_functions = sizeof sincos_functions / sizeof sincos_functions[0];
+
+/*
+ * The array functions.
+ */
+
+static void sin_array_float(void) { _sin_array(xfs, sfs, n); }
+static void cos_array_float(void) { _cos_array(xfs, cfs, n); }
+static void sincos_array_float(void) { _sincos_array(xfs, sfs, cfs, n); }
+static void sin_cr_array_float(void) { _sin_cr_array(xfs, sfs, n); }
+static void cos_cr_array_float(void) { _cos_cr_array(xfs, cfs, n); }
+static void sincos_cr_array_float(void) { _sincos_cr_array(xfs, sfs, cfs, n); }
+static void tan_array_float(void) { _tan_array(xfs, sfs, n); }
+static void sin_array_double(void) { _sin_array(xds, sds, n); }
+static void cos_array_double(void) { _cos_array(xds, cds, n); }
+static void sincos_array_double(void) { _sincos_array(xds, sds, cds, n); }
+static void sin_cr_array_double(void) { _sin_cr_array(xds, sds, n); }
+static void cos_cr_array_double(void) { _cos_cr_array(xds, cds, n); }
+static void sincos_cr_array_double(void) { _sincos_cr_array(xds, sds, cds, n); }
+static void tan_array_double(void) { _tan_array(xds, sds, n); }
+
+static const struct {
+    const char *name;
+    void (*function_float)(void);
+    void (*function_double)(void);
+} array_functions[] = {
+    {"_sin_array", &sin_array_float, &sin_array_double},
+    {"_cos_array", &cos_array_float, &cos_array_double},
+    {"_sincos_array", &sincos_array_float, &sincos_array_double},
+    {"_sin_cr_array", &sin_cr_array_float, &sin_cr_array_double},
+    {"_cos_cr_array", &cos_cr_array_float, &cos_cr_array_double},
+    {"_sincos_cr_array", &sincos_cr_array_float, &sincos_cr_array_double},
+    {"_tan_array", &tan_array_float, &tan_array_double},
+};
+
+static const size_t n_array_functions = sizeof array_functions / sizeof array_functions[0];
+
+int
+main(void)
+{
+    xfs = calloc(n, sizeof (float));
+    sfs = calloc(n, sizeof (float));
+    cfs = calloc(n, sizeof (float));
+    xds = calloc(n, sizeof (double));
+    sds = calloc(n, sizeof (double));
+    cds = calloc(n, sizeof (double));
+    assert(xfs != NULL && sfs != NULL && cfs != NULL);
+    assert(xds != NULL && sds != NULL && cds != NULL);
+
+    bench_header();
+#if defined(SINCOS_TABLE)
+    printf("# backend: table (sincos-table.h)\n");
+#else
+    printf("# backend: polynomial (sin.h, cos.h)\n");
+#endif
+#if defined(ISA_DISPATCH)
+    printf("# level: x86-64-v%d (isa.h)\n", _sincos_isa_level());
+#elif defined(SINCOS_SIMD)
+    printf("# vector kernels: %d bits (sincos-simd.h)\n", SINCOS_SIMD);
+#else
+    printf("# vector kernels: none\n");
+#endif
+    bench_columns();
+
+    srand48(1);
+    for (size_t j = 0; j < N_MAGNITUDES_FLOAT; j++) {
+        float m = magnitudes_float[j];
+        bench_arguments_float(xfs, n, m);
+        for (size_t f = 0; f < n_functions; f++) {
+            function_float = functions[f].function_float;
+            bench_print(functions[f].name, "float", "latency", m, bench(&latency_float, n, runs));
+            bench_print(functions[f].name, "float", "throughput", m, bench(&throughput_float, n, runs));
+        }
+        for (size_t f = 0; f < n_sincos_functions; f++) {
+            sincos_float = sincos_functions[f].sincos_float;
+            bench_print(sincos_functions[f].name, "float", "latency", m,
+                bench(&latency_sincos_float, n, runs));
+            bench_print(sincos_functions[f].name, "float", "throughput", m,
+                bench(&throughput_sincos_float, n, runs));
+        }
+        for (size_t f = 0; f < n_array_functions; f++)
+            bench_print(array_functions[f].name, "float", "throughput", m,
+                bench(array_functions[f].function_float, n, runs));
+    }
+    for (size_t j = 0; j < N_MAGNITUDES_DOUBLE; j++) {
+        double m = magnitudes_double[j];
+        bench_arguments_double(xds, n, m);
+        for (size_t f = 0; f < n_functions; f++) {
+            function_double = functions[f].function_double;
+            bench_print(functions[f].name, "double", "latency", m, bench(&latency_double, n, runs));
+            bench_print(functions[f].name, "double", "throughput", m, bench(&throughput_double, n, runs));
+        }
+        for (size_t f = 0; f < n_sincos_functions; f++) {
+            sincos_double = sincos_functions[f].sincos_double;
+            bench_print(sincos_functions[f].name, "double", "latency", m,
+                bench(&latency_sincos_double, n, runs));
+            bench_print(sincos_functions[f].name, "double", "throughput", m,
+                bench(&throughput_sincos_double, n, runs));
+        }
+        for (size_t f = 0; f < n_array_functions; f++)
+            bench_print(array_functions[f].name, "double", "throughput", m,
+                bench(array_functions[f].function_double, n, runs));
+    }
+
+    free(cds);
+    free(sds);
+    free(xds);
+    free(cfs);
+    free(sfs);
+    free(xfs);
+    return 0;
+}
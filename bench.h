@@ -0,0 +1,151 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#pragma once
+
+/*
+ * Timing for the benchmarks (bench-reduce.c, bench-sincos.c), in cycles
+ * per element: the time stamp counter (rdtsc, rdtscp) on x86-64, fenced
+ * so that the measured code does not leak out of the interval; or
+ * nanoseconds elsewhere. The time stamp counter runs at a constant rate,
+ * the nominal frequency, whatever the frequency of the core, so disable
+ * turbo and frequency scaling for stable results.
+ *
+ * Each measurement is the least of a few runs, on a thread pinned to
+ * one processor.
+ *
+ * Throughput: a loop over an array of independent arguments.
+ * Latency: a chain, where each argument depends on the previous result,
+ * x = xᵢ + y⋅0; it includes the latency of that multiply and add (see
+ * the baseline "identity" in the results).
+ */
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint64_t, UINT64_MAX
+#include <stdio.h> // printf
+#include <stdlib.h> // drand48
+
+#if defined(__x86_64__)
+#include <x86intrin.h> // __rdtsc, __rdtscp, _mm_lfence
+#else
+#include <time.h> // clock_gettime
+#endif
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#include <sched.h> // sched_getcpu, sched_setaffinity
+#endif
+
+#if defined(__x86_64__)
+#define BENCH_UNIT "cycles (rdtsc)"
+#else
+#define BENCH_UNIT "nanoseconds"
+#endif
+
+static inline uint64_t
+__attribute__((always_inline))
+bench_start(void)
+{
+#if defined(__x86_64__)
+    _mm_lfence();
+    uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t) t.tv_sec * 1000000000 + (uint64_t) t.tv_nsec;
+#endif
+}
+
+static inline uint64_t
+__attribute__((always_inline))
+bench_stop(void)
+{
+#if defined(__x86_64__)
+    unsigned int aux;
+    uint64_t t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+#else
+    return bench_start();
+#endif
+}
+
+/*
+ * Pin this thread to the processor it runs on; return the processor,
+ * or -1 if it is not pinned.
+ */
+
+static inline int
+bench_pin(void)
+{
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    int cpu = sched_getcpu();
+    if (cpu < 0)
+        return -1;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof set, &set) != 0)
+        return -1;
+    return cpu;
+#else
+    return -1;
+#endif
+}
+
+/*
+ * The results are comma-separated values, one line per function, type,
+ * mode and magnitude, after a few comment lines (#) on the build.
+ * bench_header pins this thread, and prints the processor.
+ */
+
+static inline void
+bench_header(void)
+{
+    printf("# unit: %s per element\n", BENCH_UNIT);
+    printf("# processor: %d\n", bench_pin());
+}
+
+static inline void
+bench_columns(void)
+{
+    printf("function,type,mode,magnitude,time\n");
+}
+
+static inline void
+bench_print(const char *function, const char *type, const char *mode, double m, double t)
+{
+    printf("%s,%s,%s,%.0f,%.2f\n", function, type, mode, m, t);
+}
+
+/*
+ * Return the least time of runs of a function, per element.
+ */
+
+static inline double
+bench(void (*function)(void), size_t n, int runs)
+{
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < runs; r++) {
+        uint64_t t0 = bench_start();
+        (*function)();
+        uint64_t t = bench_stop() - t0;
+        if (t < best)
+            best = t;
+    }
+    return (double) best / (double) n;
+}
+
+static inline void
+bench_arguments_float(float *xs, size_t n, float m)
+{
+    for (size_t i = 0; i < n; i++)
+        xs[i] = (drand48() - 0.5) * 2.0f * m;
+}
+
+static inline void
+bench_arguments_double(double *xs, size_t n, double m)
+{
+    for (size_t i = 0; i < n; i++)
+        xs[i] = (drand48() - 0.5) * 2.0 * m;
+}
@@ -242,6 +242,23 @@ static const double pi_6_double = 0.52359877559829892668119555310113355517387390
 static const double pi_8_double = 0.39269908169872413949974543356802314519882202148437 ;
 static const double pi_16_double = 0.19634954084936206974987271678401157259941101074219 ;
 
+// π∕180 = pi_180 + pi_180_lo
+static const float pi_180_float = 1.745329238474369049072265625e-2f ;
+static const float pi_180_lo_float = 1.351996015142020723942550830543041229248046875e-10f ;
+static const double pi_180_double = 1.7453292519943295474371680597869271878153085708618e-2 ;
+static const double pi_180_lo_double = 2.9486522708701686868400244652218130563625460940155e-19 ;
+
+#define pi_180(T) \
+    _Generic((T){0}, \
+        float: pi_180_float, \
+        double: pi_180_double \
+    )
+#define pi_180_lo(T) \
+    _Generic((T){0}, \
+        float: pi_180_lo_float, \
+        double: pi_180_lo_double \
+    )
+
 // k⋅2π ≤ 2²⁴, k = 2670176
 static const float twopi_2_24_float = 16777211.0f ;
 static const float twopi_2_24_hi_float = 16777210.0f ;
@@ -249,3 +266,155 @@ static const float twopi_2_24_lo_float = 0.61078357696533203125f ;
 static const double twopi_2_24_double = 1.677721061078356020152568817138671875e7 ;
 static const double twopi_2_24_hi_double = 1.67772106107835583388805389404296875e7 ;
 static const double twopi_2_24_lo_double = 1.1617299155767537633817251742796711200256254414853e-9 ;
+
+// ln 2
+static const float ln2_float = 0.693147182464599609375f ;
+static const float ln2_hi_float = 0.693147122859954833984375f ;
+static const float ln2_lo_float = 5.7699988786907852045260369777679443359375e-8f ;
+static const float ln2_lo1_float = 5.7699988786907852045260369777679443359375e-8f ;
+static const float ln2_lo2_float = 1.6885250284841366724686295697210880462080240249634e-15f ;
+static const double ln2_double = 0.69314718055994528622676398299518041312694549560547 ;
+static const double ln2_hi_double = 0.69314718055994528622676398299518041312694549560547 ;
+static const double ln2_lo_double = 2.3190468138462995584177710797133615750739959242787e-17 ;
+static const double ln2_lo1_double = 2.3190468138462995584177710797133615750739959242787e-17 ;
+static const double ln2_lo2_double = 5.7077084384162120657770282678482215566084646718852e-34 ;
+
+#define ln2(T) \
+    _Generic((T){0}, \
+        float: ln2_float, \
+        double: ln2_double \
+    )
+#define ln2_hi(T) \
+    _Generic((T){0}, \
+        float: ln2_hi_float, \
+        double: ln2_hi_double \
+    )
+#define ln2_lo(T) \
+    _Generic((T){0}, \
+        float: ln2_lo_float, \
+        double: ln2_lo_double \
+    )
+#define ln2_lo1(T) \
+    _Generic((T){0}, \
+        float: ln2_lo1_float, \
+        double: ln2_lo1_double \
+    )
+#define ln2_lo2(T) \
+    _Generic((T){0}, \
+        float: ln2_lo2_float, \
+        double: ln2_lo2_double \
+    )
+
+// 1∕ln 2
+static const float inv_ln2_float = 1.44269502162933349609375f ;
+static const float inv_ln2_hi_float = 1.44269502162933349609375f ;
+static const float inv_ln2_lo_float = 1.925963033500011079013347625732421875e-8f ;
+static const float inv_ln2_lo1_float = 1.92596285586432713898830115795135498046875e-8f ;
+static const float inv_ln2_lo2_float = 1.352622890063892753531593626803442020900547504425e-15f ;
+static const double inv_ln2_double = 1.4426950408889633870046509400708600878715515136719 ;
+static const double inv_ln2_hi_double = 1.4426950408889633870046509400708600878715515136719 ;
+static const double inv_ln2_lo_double = 2.0355273740931033111021090052206912032560386148581e-17 ;
+static const double inv_ln2_lo1_double = 2.0355273740931030029533179032629547142995678012697e-17 ;
+static const double inv_ln2_lo2_double = 2.020021915407851406570915105675113243156750288902e-33 ;
+
+#define inv_ln2(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_float, \
+        double: inv_ln2_double \
+    )
+#define inv_ln2_hi(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_hi_float, \
+        double: inv_ln2_hi_double \
+    )
+#define inv_ln2_lo(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_lo_float, \
+        double: inv_ln2_lo_double \
+    )
+#define inv_ln2_lo1(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_lo1_float, \
+        double: inv_ln2_lo1_double \
+    )
+#define inv_ln2_lo2(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_lo2_float, \
+        double: inv_ln2_lo2_double \
+    )
+
+// ln 2∕128
+static const float ln2_128_float = 0.0054152123630046844482421875f ;
+static const float ln2_128_hi_float = 0.0054152118973433971405029296875f ;
+static const float ln2_128_lo_float = 4.507811623977175941035966388881206512451171875e-10f ;
+static const float ln2_128_lo1_float = 4.507811623977175941035966388881206512451171875e-10f ;
+static const float ln2_128_lo2_float = 1.3191601785032317753661168513446000361000187695026e-17f ;
+static const double ln2_128_double = 0.0054152123481245725486465936171498469775542616844177 ;
+static const double ln2_128_hi_double = 0.0054152123481245725486465936171498469775542616844177 ;
+static const double ln2_128_lo_double = 1.8117553233174215300138836560260637305265593158427e-19 ;
+static const double ln2_128_lo1_double = 1.8117553233174215300138836560260637305265593158427e-19 ;
+static const double ln2_128_lo2_double = 4.4591472175126656763883033342564230911003630249103e-36 ;
+
+#define ln2_128(T) \
+    _Generic((T){0}, \
+        float: ln2_128_float, \
+        double: ln2_128_double \
+    )
+#define ln2_128_hi(T) \
+    _Generic((T){0}, \
+        float: ln2_128_hi_float, \
+        double: ln2_128_hi_double \
+    )
+#define ln2_128_lo(T) \
+    _Generic((T){0}, \
+        float: ln2_128_lo_float, \
+        double: ln2_128_lo_double \
+    )
+#define ln2_128_lo1(T) \
+    _Generic((T){0}, \
+        float: ln2_128_lo1_float, \
+        double: ln2_128_lo1_double \
+    )
+#define ln2_128_lo2(T) \
+    _Generic((T){0}, \
+        float: ln2_128_lo2_float, \
+        double: ln2_128_lo2_double \
+    )
+
+// 128∕ln 2
+static const float inv_ln2_128_float = 184.6649627685546875f ;
+static const float inv_ln2_128_hi_float = 184.6649627685546875f ;
+static const float inv_ln2_128_lo_float = 2.4652326828800141811370849609375e-6f ;
+static const float inv_ln2_128_lo1_float = 2.465232455506338737905025482177734375e-6f ;
+static const float inv_ln2_128_lo2_float = 1.7313572992817827245204398423084057867527008056641e-13f ;
+static const double inv_ln2_128_double = 184.66496523378731353659532032907009124755859375 ;
+static const double inv_ln2_128_hi_double = 184.66496523378731353659532032907009124755859375 ;
+static const double inv_ln2_128_lo_double = 2.6054750388391722382106995266824847401677294270184e-15 ;
+static const double inv_ln2_128_lo1_double = 2.6054750388391718437802469161765820343034467856252e-15 ;
+static const double inv_ln2_128_lo2_double = 2.5856280517220498004107713352641449512406403697946e-31 ;
+
+#define inv_ln2_128(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_128_float, \
+        double: inv_ln2_128_double \
+    )
+#define inv_ln2_128_hi(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_128_hi_float, \
+        double: inv_ln2_128_hi_double \
+    )
+#define inv_ln2_128_lo(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_128_lo_float, \
+        double: inv_ln2_128_lo_double \
+    )
+#define inv_ln2_128_lo1(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_128_lo1_float, \
+        double: inv_ln2_128_lo1_double \
+    )
+#define inv_ln2_128_lo2(T) \
+    _Generic((T){0}, \
+        float: inv_ln2_128_lo2_float, \
+        double: inv_ln2_128_lo2_double \
+    )
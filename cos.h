@@ -4,83 +4,86 @@
 
 #pragma once
 
-#include "constants.h" // pi, etc.
-#include "polynomial.h" // eval_polynomial
+#include "arithmetic.h" // madd, mul
+#include "polynomial.h" // eval_polynomial_*1, eval_polynomial_estrin_*1
 
-static inline float _cos_pi_2_float(float x);
+// POLYNOMIAL_ESTRIN selects the evaluation scheme, see sin.h.
 
-static inline double _cos_pi_2_double(double x);
+/*
+ * cos(x) ≅ 1 - x²∕2 + x⁴⋅C(x²) on [0, π∕4],
+ * relative error < 2^-36.9 (./remez cos float 4).
+ */
 
-#define _cos_0_pi_2(x) \
-    _Generic((x), \
-        float: _cos_0_pi_2_float, \
-        double: _cos_0_pi_2_double \
-    )(x)
+static const float _cos_as_float[4] = {
+    /* x^4 */ 4.166666791e-02f,
+    /* x^6 */ -1.388897654e-03f,
+    /* x^8 */ 2.482044874e-05f,
+    /* x^10 */ -2.871140055e-07f,
+};
+
+/*
+ * cos(x) ≅ 1 - x²∕2 + x⁴⋅C(x²) on [0, π∕4],
+ * relative error < 2^-61.4 (./remez cos double 6).
+ */
+
+static const double _cos_as_double[6] = {
+    /* x^4 */ 4.16666666666665880e-02,
+    /* x^6 */ -1.38888888888664725e-03,
+    /* x^8 */ 2.48015872825595433e-05,
+    /* x^10 */ -2.75573119604039904e-07,
+    /* x^12 */ 2.08753636544971726e-09,
+    /* x^14 */ -1.13398673946726910e-11,
+};
+
+/*
+ * Return cos(x + xₗ) for |x| ≤ π∕4 and a small xₗ (xₗ² is negligible):
+ *
+ *     cos(x + xₗ) ≅ cos(x) - sin(x)⋅xₗ ≅ 1 - x²∕2 + x⁴⋅C(x²) - x⋅xₗ
+ *
+ * 1 - x²∕2 ≥ 0.69 is computed exactly, including the error of x², and
+ * the other terms are less than 1∕50, so their errors are negligible.
+ */
 
 static inline float
 __attribute__((always_inline))
 __attribute__((const))
-_cos_0_pi_2_float(float x)
+_cos_kernel_float(float x, float xl)
 {
-    assert(x >= 0.0f && x <= pi_2(float));
-    const float as[22 + 1] = {
-        /* x^0 */ 1.0f,
-        /* x^1 */ 6.759776657698502e-13f,
-        /* x^2 */ -0.5f,
-        /* x^3 */ -1.9783012727980775e-10f,
-        /* x^4 */ 0.0416666679084301f,
-        /* x^5 */ 1.084509992921312e-08f,
-        /* x^6 */ -0.0013890363043174148f,
-        /* x^7 */ 4.3343567313058884e-07f,
-        /* x^8 */ 2.706554369069636e-05f,
-        /* x^9 */ -2.5627790819271468e-05f,
-        /* x^10 */ 0.00011755149898817763f,
-        /* x^11 */ -0.00034594471799209714f,
-        /* x^12 */ 0.0007237704703584313f,
-        /* x^13 */ -0.0011300748446956277f,
-        /* x^14 */ 0.0013468097895383835f,
-        /* x^15 */ -0.0012371520278975368f,
-        /* x^16 */ 0.000876404985319823f,
-        /* x^17 */ -0.00047500297660008073f,
-        /* x^18 */ 0.00019345934560988098f,
-        /* x^19 */ -5.732126737711951e-05f,
-        /* x^20 */ 1.1666309546853881e-05f,
-        /* x^21 */ -1.4586045153919258e-06f,
-        /* x^22 */ 8.446725274779965e-08f,
-    };
-    return eval_polynomial(as, sizeof as / sizeof as[0], x);
+    const size_t n = sizeof _cos_as_float / sizeof _cos_as_float[0];
+    float t = x * x;
+    float te = mul(x, x).b; // x² = t + tₑ
+#if defined(POLYNOMIAL_ESTRIN)
+    float c = eval_polynomial_estrin_float1(_cos_as_float, n, t);
+#else
+    float c = eval_polynomial_float1(_cos_as_float, n, t);
+#endif
+    float h = 0.5f * t;
+    float w = 1.0f - h;
+    float we = (1.0f - w) - h; // 1 - x²∕2 = w + wₑ - tₑ∕2
+    return w + (madd(t * t, c, madd(-0.5f, te, we)) - x * xl);
 }
 
 static inline double
 __attribute__((always_inline))
 __attribute__((const))
-_cos_0_pi_2_double(double x)
+_cos_kernel_double(double x, double xl)
 {
-    assert(x >= 0.0 && x <= pi_2(double));
-    const double as[22 + 1] = {
-        /* x^0 */ 1.0,
-        /* x^1 */ -1.1399247575174607e-21,
-        /* x^2 */ -0.5,
-        /* x^3 */ 3.7724774820191193e-19,
-        /* x^4 */ 0.041666666666666664,
-        /* x^5 */ -2.3875436436542907e-17,
-        /* x^6 */ -0.0013888888888885747,
-        /* x^7 */ -9.678259018392463e-16,
-        /* x^8 */ 2.4801587297486778e-05,
-        /* x^9 */ 4.924141452473386e-14,
-        /* x^10 */ -2.755734187130068e-07,
-        /* x^11 */ 6.595923551445847e-13,
-        /* x^12 */ 2.0863109038375228e-09,
-        /* x^13 */ 2.1045225666463804e-12,
-        /* x^14 */ -1.3945869728049475e-11,
-        /* x^15 */ 2.242711520404441e-12,
-        /* x^16 */ -1.5190267372248051e-12,
-        /* x^17 */ 8.374108806832156e-13,
-        /* x^18 */ -3.364846344502883e-13,
-        /* x^19 */ 9.827771930895603e-14,
-        /* x^20 */ -1.9728105301385762e-14,
-        /* x^21 */ 2.4332891569700873e-15,
-        /* x^22 */ -1.3903679550728462e-16,
-    };
-    return eval_polynomial(as, sizeof as / sizeof as[0], x);
+    const size_t n = sizeof _cos_as_double / sizeof _cos_as_double[0];
+    double t = x * x;
+    double te = mul(x, x).b; // x² = t + tₑ
+#if defined(POLYNOMIAL_ESTRIN)
+    double c = eval_polynomial_estrin_double1(_cos_as_double, n, t);
+#else
+    double c = eval_polynomial_double1(_cos_as_double, n, t);
+#endif
+    double h = 0.5 * t;
+    double w = 1.0 - h;
+    double we = (1.0 - w) - h; // 1 - x²∕2 = w + wₑ - tₑ∕2
+    return w + (madd(t * t, c, madd(-0.5, te, we)) - x * xl);
 }
+
+#define _cos_kernel(x, xl) \
+    _Generic((x), \
+        float: _cos_kernel_float, \
+        double: _cos_kernel_double \
+    )(x, xl)
@@ -0,0 +1,162 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#include <pthread.h> // pthread_key_create, pthread_once, pthread_setspecific
+#include <stddef.h> // size_t
+#include <stdint.h> // uint64_t
+#include <stdio.h> // fopen, fprintf
+#include <stdlib.h> // getenv
+#include <string.h> // strcmp
+
+#include "counters.h"
+
+#if defined(COUNTERS)
+
+/*
+ * The counters of each function, the first of each group being the
+ * number of calls: the others are a fraction of it.
+ */
+
+static const char *counter_names[N_COUNTERS] = {
+    [COUNTER_SINCOS_FLOAT] = "sincos float",
+    [COUNTER_SINCOS_TINY_FLOAT] = "    tiny",
+    [COUNTER_SINCOS_REDUCE_FLOAT] = "    |x| > pi/2",
+    [COUNTER_SINCOS_PH_FLOAT] = "    payne-hanek",
+    [COUNTER_SINCOS_SIMD_FLOAT] = "sincos simd blocks float",
+    [COUNTER_SINCOS_SIMD_FALLBACK_FLOAT] = "    scalar fallback",
+    [COUNTER_CW_FLOAT] = "cody-waite float",
+    [COUNTER_CW_CORRECTION_FLOAT] = "    correction",
+    [COUNTER_BDL_FLOAT] = "bdl float",
+    [COUNTER_BDL_CORRECTION_FLOAT] = "    correction",
+    [COUNTER_SINCOS_CR_FLOAT] = "sincos cr float",
+    [COUNTER_SINCOS_CR_LOOKUP_FLOAT] = "    exception lookup",
+    [COUNTER_SINCOS_DOUBLE] = "sincos double",
+    [COUNTER_SINCOS_TINY_DOUBLE] = "    tiny",
+    [COUNTER_SINCOS_REDUCE_DOUBLE] = "    |x| > pi/2",
+    [COUNTER_SINCOS_PH_DOUBLE] = "    payne-hanek",
+    [COUNTER_SINCOS_SIMD_DOUBLE] = "sincos simd blocks double",
+    [COUNTER_SINCOS_SIMD_FALLBACK_DOUBLE] = "    scalar fallback",
+    [COUNTER_CW_DOUBLE] = "cody-waite double",
+    [COUNTER_CW_CORRECTION_DOUBLE] = "    correction",
+    [COUNTER_BDL_DOUBLE] = "bdl double",
+    [COUNTER_BDL_CORRECTION_DOUBLE] = "    correction",
+    [COUNTER_SINCOS_CR_DOUBLE] = "sincos cr double",
+    [COUNTER_SINCOS_CR_DD_DOUBLE] = "    double-double",
+    [COUNTER_SINCOS_CR_TD_DOUBLE] = "    triple-double",
+};
+
+// The group of each counter, the index of its number of calls.
+static const enum counter counter_groups[N_COUNTERS] = {
+    [COUNTER_SINCOS_FLOAT] = COUNTER_SINCOS_FLOAT,
+    [COUNTER_SINCOS_TINY_FLOAT] = COUNTER_SINCOS_FLOAT,
+    [COUNTER_SINCOS_REDUCE_FLOAT] = COUNTER_SINCOS_FLOAT,
+    [COUNTER_SINCOS_PH_FLOAT] = COUNTER_SINCOS_FLOAT,
+    [COUNTER_SINCOS_SIMD_FLOAT] = COUNTER_SINCOS_SIMD_FLOAT,
+    [COUNTER_SINCOS_SIMD_FALLBACK_FLOAT] = COUNTER_SINCOS_SIMD_FLOAT,
+    [COUNTER_CW_FLOAT] = COUNTER_CW_FLOAT,
+    [COUNTER_CW_CORRECTION_FLOAT] = COUNTER_CW_FLOAT,
+    [COUNTER_BDL_FLOAT] = COUNTER_BDL_FLOAT,
+    [COUNTER_BDL_CORRECTION_FLOAT] = COUNTER_BDL_FLOAT,
+    [COUNTER_SINCOS_CR_FLOAT] = COUNTER_SINCOS_CR_FLOAT,
+    [COUNTER_SINCOS_CR_LOOKUP_FLOAT] = COUNTER_SINCOS_CR_FLOAT,
+    [COUNTER_SINCOS_DOUBLE] = COUNTER_SINCOS_DOUBLE,
+    [COUNTER_SINCOS_TINY_DOUBLE] = COUNTER_SINCOS_DOUBLE,
+    [COUNTER_SINCOS_REDUCE_DOUBLE] = COUNTER_SINCOS_DOUBLE,
+    [COUNTER_SINCOS_PH_DOUBLE] = COUNTER_SINCOS_DOUBLE,
+    [COUNTER_SINCOS_SIMD_DOUBLE] = COUNTER_SINCOS_SIMD_DOUBLE,
+    [COUNTER_SINCOS_SIMD_FALLBACK_DOUBLE] = COUNTER_SINCOS_SIMD_DOUBLE,
+    [COUNTER_CW_DOUBLE] = COUNTER_CW_DOUBLE,
+    [COUNTER_CW_CORRECTION_DOUBLE] = COUNTER_CW_DOUBLE,
+    [COUNTER_BDL_DOUBLE] = COUNTER_BDL_DOUBLE,
+    [COUNTER_BDL_CORRECTION_DOUBLE] = COUNTER_BDL_DOUBLE,
+    [COUNTER_SINCOS_CR_DOUBLE] = COUNTER_SINCOS_CR_DOUBLE,
+    [COUNTER_SINCOS_CR_DD_DOUBLE] = COUNTER_SINCOS_CR_DOUBLE,
+    [COUNTER_SINCOS_CR_TD_DOUBLE] = COUNTER_SINCOS_CR_DOUBLE,
+};
+
+_Thread_local uint64_t counters_thread[N_COUNTERS];
+_Thread_local int counters_registered;
+
+static uint64_t counters_total[N_COUNTERS];
+
+static pthread_key_t counters_key;
+static pthread_once_t counters_once = PTHREAD_ONCE_INIT;
+
+// Add the counts of this thread to the totals.
+static void
+counters_flush(void)
+{
+    for (size_t i = 0; i < N_COUNTERS; i++) {
+        if (counters_thread[i] == 0)
+            continue;
+        __atomic_fetch_add(&counters_total[i], counters_thread[i], __ATOMIC_RELAXED);
+        counters_thread[i] = 0;
+    }
+}
+
+static void
+counters_exit(void *value)
+{
+    (void) value;
+    counters_flush();
+}
+
+static void
+counters_init(void)
+{
+    pthread_key_create(&counters_key, &counters_exit);
+}
+
+/*
+ * At the first count of a thread: the destructor of a key runs at the
+ * exit of each thread with a value for it, other than the main thread,
+ * which is flushed by counters_report.
+ */
+
+void
+counters_register(void)
+{
+    pthread_once(&counters_once, &counters_init);
+    pthread_setspecific(counters_key, &counters_registered);
+    counters_registered = 1;
+}
+
+void
+counters_report(FILE *f)
+{
+    counters_flush();
+    for (size_t i = 0; i < N_COUNTERS; i++) {
+        uint64_t n = __atomic_load_n(&counters_total[i], __ATOMIC_RELAXED);
+        uint64_t calls = __atomic_load_n(&counters_total[counter_groups[i]], __ATOMIC_RELAXED);
+        if (calls == 0)
+            continue;
+        fprintf(f, "%-28s %14llu", counter_names[i], (unsigned long long) n);
+        if ((size_t) counter_groups[i] != i)
+            fprintf(f, " (%6.2f%%)", 100.0 * (double) n / (double) calls);
+        fprintf(f, "\n");
+    }
+}
+
+static void
+__attribute__((destructor))
+counters_fini(void)
+{
+    const char *file = getenv("FUNLIBM_COUNTERS");
+    if (file == NULL || file[0] == '\0')
+        return;
+    FILE *f = strcmp(file, "-") == 0 ? stderr : fopen(file, "w");
+    if (f == NULL)
+        return;
+    counters_report(f);
+    if (f != stderr)
+        fclose(f);
+}
+
+#else
+
+void
+counters_report(FILE *f)
+{
+    fprintf(f, "counters: not compiled in (make COUNTERS=1)\n");
+}
+
+#endif
@@ -0,0 +1,90 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#pragma once
+
+/*
+ * Counters of the branches of the hot paths: the tiny arguments, the
+ * reductions and the corrections of sincos.c, cw.h and reduce.h, and the
+ * accurate paths of sincos-cr.h.
+ *
+ * They are compiled in with -DCOUNTERS (make COUNTERS=1), and COUNT and
+ * COUNT_IF are nothing otherwise, so the conditions are not evaluated.
+ * Each thread counts in its own block, with plain increments; the block
+ * is added to the totals, with relaxed atomics, when the thread exits.
+ * With the environment variable FUNLIBM_COUNTERS set to a file name
+ * (or to "-" for stderr), the totals are written to that file at exit.
+ *
+ * The counts change the code they count: with COUNTERS, the branchless
+ * corrections (_cw_correction_select, etc.) branch, and do not vectorize.
+ * The functions that count, or call a function that counts, are declared
+ * COUNTERS_CONST rather than const: with COUNTERS, they have the side
+ * effect of the count, and the compiler could otherwise merge or drop
+ * their calls, and so their counts.
+ */
+
+#include <stdint.h> // uint64_t
+#include <stdio.h> // FILE
+
+enum counter {
+    COUNTER_SINCOS_FLOAT,
+    COUNTER_SINCOS_TINY_FLOAT,
+    COUNTER_SINCOS_REDUCE_FLOAT,
+    COUNTER_SINCOS_PH_FLOAT,
+    COUNTER_SINCOS_SIMD_FLOAT,
+    COUNTER_SINCOS_SIMD_FALLBACK_FLOAT,
+    COUNTER_CW_FLOAT,
+    COUNTER_CW_CORRECTION_FLOAT,
+    COUNTER_BDL_FLOAT,
+    COUNTER_BDL_CORRECTION_FLOAT,
+    COUNTER_SINCOS_CR_FLOAT,
+    COUNTER_SINCOS_CR_LOOKUP_FLOAT,
+    COUNTER_SINCOS_DOUBLE,
+    COUNTER_SINCOS_TINY_DOUBLE,
+    COUNTER_SINCOS_REDUCE_DOUBLE,
+    COUNTER_SINCOS_PH_DOUBLE,
+    COUNTER_SINCOS_SIMD_DOUBLE,
+    COUNTER_SINCOS_SIMD_FALLBACK_DOUBLE,
+    COUNTER_CW_DOUBLE,
+    COUNTER_CW_CORRECTION_DOUBLE,
+    COUNTER_BDL_DOUBLE,
+    COUNTER_BDL_CORRECTION_DOUBLE,
+    COUNTER_SINCOS_CR_DOUBLE,
+    COUNTER_SINCOS_CR_DD_DOUBLE,
+    COUNTER_SINCOS_CR_TD_DOUBLE,
+    N_COUNTERS,
+};
+
+// Write the totals, with those of this thread, to f.
+void counters_report(FILE *f);
+
+#if defined(COUNTERS)
+
+extern _Thread_local uint64_t counters_thread[N_COUNTERS];
+extern _Thread_local int counters_registered;
+
+void counters_register(void);
+
+static inline void
+__attribute__((always_inline))
+counter_increment(enum counter c)
+{
+    if (__builtin_expect(!counters_registered, 0))
+        counters_register();
+    counters_thread[c]++;
+}
+
+#define COUNTERS_CONST
+#define COUNT(c) counter_increment(c)
+#define COUNT_IF(condition, c) \
+    do { \
+        if (condition) \
+            counter_increment(c); \
+    } while (0)
+
+#else
+
+#define COUNTERS_CONST __attribute__((const))
+#define COUNT(c) ((void) 0)
+#define COUNT_IF(condition, c) ((void) 0)
+
+#endif
@@ -5,12 +5,13 @@
 #pragma once
 
 #include <assert.h>
-#include <math.h> // fmaf, fma
+#include <math.h> // fma, fmaf, trunc, truncf
 #include <stdint.h> // int32_t, int64_t
 
-#include "arithmetic.h" // add, mul
-#include "constants.h" // pi, etc.
-#include "types.h" // rem_result_float, rem_result_double
+#include "arithmetic.h" // add, mul, mul_dekker, xfma
+#include "constants.h" // pi, ln2_128, etc.
+#include "counters.h" // COUNT, COUNT_IF, COUNTERS_CONST
+#include "types.h" // quadrant_result_float, rem_result_float, etc.
 
 /*
  * Variant of the Cody-Waite argument reduction algorithm.
@@ -115,9 +116,32 @@ static const cw_parameters_double cw_parameters_pi_2_double = {
     .R3 = inv_pi_2_lo2(double),
 };
 
+// ln 2∕128, for exp.c
+static const cw_parameters_float cw_parameters_ln2_128_float = {
+    .C = ln2_128(float),
+    .C1 = ln2_128_hi(float),
+    .C2 = ln2_128_lo1(float),
+    .C3 = ln2_128_lo2(float),
+    .R = inv_ln2_128(float),
+    .R1 = inv_ln2_128_hi(float),
+    .R2 = inv_ln2_128_lo1(float),
+    .R3 = inv_ln2_128_lo2(float),
+};
+
+static const cw_parameters_double cw_parameters_ln2_128_double = {
+    .C = ln2_128(double),
+    .C1 = ln2_128_hi(double),
+    .C2 = ln2_128_lo1(double),
+    .C3 = ln2_128_lo2(double),
+    .R = inv_ln2_128(double),
+    .R1 = inv_ln2_128_hi(double),
+    .R2 = inv_ln2_128_lo1(double),
+    .R3 = inv_ln2_128_lo2(double),
+};
+
 static inline rem_result_float
 __attribute__((always_inline))
-__attribute__((const))
+COUNTERS_CONST
 _cw_correction_float(float x, const cw_parameters_float parameters, rem_result_float result)
 {
     const float C = parameters.C;
@@ -127,8 +151,10 @@ _cw_correction_float(float x, const cw_parameters_float parameters, rem_result_f
     float v1 = result.v1;
     float v2 = result.v2;
     float r = v1 + v2;
+    COUNT(COUNTER_CW_FLOAT);
     if (x >= 0.0f) {
         if (r < 0.0f) {
+            COUNT(COUNTER_CW_CORRECTION_FLOAT);
             // r += C;
             v1 += C1;
             v2 += C2;
@@ -138,6 +164,7 @@ _cw_correction_float(float x, const cw_parameters_float parameters, rem_result_f
         assert(r >= 0.0f && r <= C);
     } else {
         if (r > 0.0f) {
+            COUNT(COUNTER_CW_CORRECTION_FLOAT);
             // r -= C;
             v1 -= C1;
             v2 -= C2;
@@ -151,7 +178,7 @@ _cw_correction_float(float x, const cw_parameters_float parameters, rem_result_f
 
 static inline rem_result_double
 __attribute__((always_inline))
-__attribute__((const))
+COUNTERS_CONST
 _cw_correction_double(double x, const cw_parameters_double parameters, rem_result_double result)
 {
     const double C = parameters.C;
@@ -161,8 +188,10 @@ _cw_correction_double(double x, const cw_parameters_double parameters, rem_resul
     double v1 = result.v1;
     double v2 = result.v2;
     double r = v1 + v2;
+    COUNT(COUNTER_CW_DOUBLE);
     if (x >= 0.0) {
         if (r < 0.0) {
+            COUNT(COUNTER_CW_CORRECTION_DOUBLE);
             // r += C;
             v1 += C1;
             v2 += C2;
@@ -172,6 +201,7 @@ _cw_correction_double(double x, const cw_parameters_double parameters, rem_resul
         assert(r >= 0.0 && r <= C);
     } else {
         if (r > 0.0) {
+            COUNT(COUNTER_CW_CORRECTION_DOUBLE);
             // r -= C;
             v1 -= C1;
             v2 -= C2;
@@ -189,10 +219,73 @@ _cw_correction_double(double x, const cw_parameters_double parameters, rem_resul
         double: _cw_correction_double \
     )(x, parameters, result)
 
+/*
+ * Same as _cw_correction, without branches. The correction is selected
+ * rather than branched to, so that vectorized loops can blend it.
+ * Adding -0.0 leaves v₁ and v₂ unchanged, including the sign of zero,
+ * so the result is identical to that of _cw_correction.
+ */
+
+static inline rem_result_float
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_correction_select_float(float x, const cw_parameters_float parameters, rem_result_float result)
+{
+    const float C = parameters.C;
+    const float C1 = parameters.C1;
+    const float C2 = parameters.C2;
+    float v1 = result.v1;
+    float v2 = result.v2;
+    float r = v1 + v2;
+    int up = (x >= 0.0f) & (r < 0.0f); // r += C
+    int down = (x < 0.0f) & (r > 0.0f); // r -= C
+    COUNT(COUNTER_CW_FLOAT);
+    COUNT_IF(up | down, COUNTER_CW_CORRECTION_FLOAT);
+    v1 += up ? C1 : (down ? -C1 : -0.0f);
+    v2 += up ? C2 : (down ? -C2 : -0.0f);
+    int32_t z = result.z - up + down;
+    r = v1 + v2;
+    assert(x < 0.0f || (r >= 0.0f && r <= C));
+    assert(x >= 0.0f || (r >= -C && r <= 0.0f));
+    (void) C;
+    return (rem_result_float) {z, v1, v2};
+}
+
+static inline rem_result_double
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_correction_select_double(double x, const cw_parameters_double parameters, rem_result_double result)
+{
+    const double C = parameters.C;
+    const double C1 = parameters.C1;
+    const double C2 = parameters.C2;
+    double v1 = result.v1;
+    double v2 = result.v2;
+    double r = v1 + v2;
+    int up = (x >= 0.0) & (r < 0.0); // r += C
+    int down = (x < 0.0) & (r > 0.0); // r -= C
+    COUNT(COUNTER_CW_DOUBLE);
+    COUNT_IF(up | down, COUNTER_CW_CORRECTION_DOUBLE);
+    v1 += up ? C1 : (down ? -C1 : -0.0);
+    v2 += up ? C2 : (down ? -C2 : -0.0);
+    int64_t z = result.z - up + down;
+    r = v1 + v2;
+    assert(x < 0.0 || (r >= 0.0 && r <= C));
+    assert(x >= 0.0 || (r >= -C && r <= 0.0));
+    (void) C;
+    return (rem_result_double) {z, v1, v2};
+}
+
+#define _cw_correction_select(x, parameters, result) \
+    _Generic((x), \
+        float: _cw_correction_select_float, \
+        double: _cw_correction_select_double \
+    )(x, parameters, result)
+
 static inline tuple_float
 __attribute__((always_inline))
 __attribute__((const))
-cw_reduce_float(const cw_parameters_float parameters, float x, int32_t q)
+cw_reduce_float(const cw_parameters_float parameters, float x, float qf)
 {
     const float C1 = parameters.C1;
     const float C2 = parameters.C2;
@@ -207,7 +300,6 @@ cw_reduce_float(const cw_parameters_float parameters, float x, int32_t q)
     // r = fmaf(-q, C3, fmaf(-q, C2, fmaf(-q, C1, x)));
     // e = 0.0f;
 
-    float qf = (float) q;
     // r1 = x - q * C1
     tuple_float x1 = xfma(-qf, C1, x);
     float r1 = x1.a;
@@ -226,15 +318,85 @@ cw_reduce_float(const cw_parameters_float parameters, float x, int32_t q)
     return (tuple_float) {r, e};
 }
 
-static inline rem_result_float
+static inline tuple_double
 __attribute__((always_inline))
 __attribute__((const))
-_cw_rem_float(const cw_parameters_float parameters, float x)
+cw_reduce_double(const cw_parameters_double parameters, double x, double qd)
+{
+    const double C1 = parameters.C1;
+    const double C2 = parameters.C2;
+    const double C3 = parameters.C3;
+
+    // double r = x - (q * C1) - (q * C2);
+    // double r = fma(-q, C2, fma(-q, C1, x));
+
+    // double r = x - (q * C1) - (q * C2) - (q * C3);
+    // double r = fma(-q, C3, fma(-q, C2, fma(-q, C1, x)));
+    // double e = 0.0;
+
+    // r1 = x - q * C1
+    tuple_double x1 = xfma(-qd, C1, x);
+    double r1 = x1.a;
+    double e1 = x1.b;
+    // r2 = r1 - q * C2
+    tuple_double x2 = xfma(-qd, C2, r1);
+    double r2 = x2.a;
+    double e2 = x2.b;
+    // r3 = r2 - q * C3
+    tuple_double x3 = xfma(-qd, C3, r2);
+    double r3 = x3.a;
+    double e3 = x3.b;
+    double r = r3;
+    double e = e1 + e2 + e3;
+
+    return (tuple_double) {r, e};
+}
+
+/*
+ * Return t ≅ x⋅R, R = R₁ + R₂ + R₃, the estimate of the quotient. Without
+ * fma, x⋅R₁ is exact (mul_dekker) and its error is added to the rest, so
+ * that t is rounded about once, as with fma: rounded twice, t would be
+ * the next integer more often, where x is just below a multiple of C, and
+ * the correction of v₁ + v₂ (v₁ + C₁) would round the remainder.
+ */
+
+static inline float
+__attribute__((always_inline))
+__attribute__((const))
+cw_quotient_float(const cw_parameters_float parameters, float x)
 {
     const float R1 = parameters.R1;
     const float R2 = parameters.R2;
     const float R3 = parameters.R3;
+#if defined(ARITHMETIC_FMA)
+    return fmaf(x, R1, fmaf(x, R2, x * R3));
+#else
+    tuple_float p = mul_dekker_float(x, R1);
+    return p.a + (p.b + (x * R2 + x * R3));
+#endif
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+cw_quotient_double(const cw_parameters_double parameters, double x)
+{
+    const double R1 = parameters.R1;
+    const double R2 = parameters.R2;
+    const double R3 = parameters.R3;
+#if defined(ARITHMETIC_FMA)
+    return fma(x, R1, fma(x, R2, x * R3));
+#else
+    tuple_double p = mul_dekker_double(x, R1);
+    return p.a + (p.b + (x * R2 + x * R3));
+#endif
+}
 
+static inline rem_result_float
+__attribute__((always_inline))
+__attribute__((const))
+_cw_rem_uncorrected_float(const cw_parameters_float parameters, float x)
+{
     // const float C = parameters.C;
     // const float R = parameters.R;
     // float t = x * R;
@@ -246,31 +408,23 @@ _cw_rem_float(const cw_parameters_float parameters, float x)
     // float t = fmaf(x, R1, x * R2);
 
     // float t = (x * R1) + (x * R2) + (x * R3);
-    float t = fmaf(x, R1, fmaf(x, R2, x * R3));
+    float t = cw_quotient_float(parameters, x);
 
     int32_t q = (int32_t) t;
 
-    tuple_float rem = cw_reduce_float(parameters, x, q);
+    tuple_float rem = cw_reduce_float(parameters, x, (float) q);
     float r = rem.a;
     float e = rem.b;
 
     rem_result_float result = {q, r, e};
-    // return result;
-    return _cw_correction(x, parameters, result);
+    return result;
 }
 
 static inline rem_result_double
 __attribute__((always_inline))
 __attribute__((const))
-_cw_rem_double(const cw_parameters_double parameters, double x)
+_cw_rem_uncorrected_double(const cw_parameters_double parameters, double x)
 {
-    const double C1 = parameters.C1;
-    const double C2 = parameters.C2;
-    const double C3 = parameters.C3;
-    const double R1 = parameters.R1;
-    const double R2 = parameters.R2;
-    const double R3 = parameters.R3;
-
     // const double C = parameters.C;
     // const double R = parameters.R;
     // double t = x * R;
@@ -282,35 +436,33 @@ _cw_rem_double(const cw_parameters_double parameters, double x)
     // double t = fma(x, R1, x * R2);
 
     // double t = (x * R1) + (x * R2) + (x * R3);
-    double t = fma(x, R1, fma(x, R2, x * R3));
+    double t = cw_quotient_double(parameters, x);
 
     int64_t q = (int64_t) t;
 
-    // double r = x - (q * C1) - (q * C2);
-    // double r = fma(-q, C2, fma(-q, C1, x));
+    tuple_double rem = cw_reduce_double(parameters, x, (double) q);
+    double r = rem.a;
+    double e = rem.b;
 
-    // double r = x - (q * C1) - (q * C2) - (q * C3);
-    // double r = fma(-q, C3, fma(-q, C2, fma(-q, C1, x)));
-    // double e = 0.0;
+    rem_result_double result = {q, r, e};
+    return result;
+}
 
-    double qd = (double) q;
-    // r1 = x - q * C1
-    tuple_double x1 = xfma(-qd, C1, x);
-    double r1 = x1.a;
-    double e1 = x1.b;
-    // r2 = r1 - q * C2
-    tuple_double x2 = xfma(-qd, C2, r1);
-    double r2 = x2.a;
-    double e2 = x2.b;
-    // r3 = r2 - q * C3
-    tuple_double x3 = xfma(-qd, C3, r2);
-    double r3 = x3.a;
-    double e3 = x3.b;
-    double r = r3;
-    double e = e1 + e2 + e3;
+static inline rem_result_float
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_rem_float(const cw_parameters_float parameters, float x)
+{
+    rem_result_float result = _cw_rem_uncorrected_float(parameters, x);
+    return _cw_correction(x, parameters, result);
+}
 
-    rem_result_double result = {q, r, e};
-    // return result;
+static inline rem_result_double
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_rem_double(const cw_parameters_double parameters, double x)
+{
+    rem_result_double result = _cw_rem_uncorrected_double(parameters, x);
     return _cw_correction(x, parameters, result);
 }
 
@@ -320,9 +472,39 @@ _cw_rem_double(const cw_parameters_double parameters, double x)
         cw_parameters_double: _cw_rem_double \
     )(parameters, x)
 
+/*
+ * Same as _cw_rem, with a branchless correction, for vectorized loops.
+ * In scalar code, the branch of _cw_correction is cheaper, because it
+ * is rarely taken.
+ */
+
 static inline rem_result_float
 __attribute__((always_inline))
-__attribute__((const))
+COUNTERS_CONST
+_cw_rem_select_float(const cw_parameters_float parameters, float x)
+{
+    rem_result_float result = _cw_rem_uncorrected_float(parameters, x);
+    return _cw_correction_select(x, parameters, result);
+}
+
+static inline rem_result_double
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_rem_select_double(const cw_parameters_double parameters, double x)
+{
+    rem_result_double result = _cw_rem_uncorrected_double(parameters, x);
+    return _cw_correction_select(x, parameters, result);
+}
+
+#define _cw_rem_select(parameters, x) \
+    _Generic((parameters), \
+        cw_parameters_float: _cw_rem_select_float, \
+        cw_parameters_double: _cw_rem_select_double \
+    )(parameters, x)
+
+static inline rem_result_float
+__attribute__((always_inline))
+COUNTERS_CONST
 _cw_rem_pi_float(float x)
 {
     return _cw_rem(cw_parameters_pi_float, x);
@@ -330,7 +512,7 @@ _cw_rem_pi_float(float x)
 
 static inline rem_result_double
 __attribute__((always_inline))
-__attribute__((const))
+COUNTERS_CONST
 _cw_rem_pi_double(double x)
 {
     return _cw_rem(cw_parameters_pi_double, x);
@@ -344,7 +526,7 @@ _cw_rem_pi_double(double x)
 
 static inline rem_result_float
 __attribute__((always_inline))
-__attribute__((const))
+COUNTERS_CONST
 _cw_rem_2pi_float(float x)
 {
     return _cw_rem(cw_parameters_2pi_float, x);
@@ -352,7 +534,7 @@ _cw_rem_2pi_float(float x)
 
 static inline rem_result_double
 __attribute__((always_inline))
-__attribute__((const))
+COUNTERS_CONST
 _cw_rem_2pi_double(double x)
 {
     return _cw_rem(cw_parameters_2pi_double, x);
@@ -366,7 +548,7 @@ _cw_rem_2pi_double(double x)
 
 static inline rem_result_float
 __attribute__((always_inline))
-__attribute__((const))
+COUNTERS_CONST
 _cw_rem_pi_2_float(float x)
 {
     return _cw_rem(cw_parameters_pi_2_float, x);
@@ -374,7 +556,7 @@ _cw_rem_pi_2_float(float x)
 
 static inline rem_result_double
 __attribute__((always_inline))
-__attribute__((const))
+COUNTERS_CONST
 _cw_rem_pi_2_double(double x)
 {
     return _cw_rem(cw_parameters_pi_2_double, x);
@@ -385,3 +567,89 @@ _cw_rem_pi_2_double(double x)
         float: _cw_rem_pi_2_float, \
         double: _cw_rem_pi_2_double \
     )(x)
+
+static inline rem_result_float
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_rem_pi_2_select_float(float x)
+{
+    return _cw_rem_select(cw_parameters_pi_2_float, x);
+}
+
+static inline rem_result_double
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_rem_pi_2_select_double(double x)
+{
+    return _cw_rem_select(cw_parameters_pi_2_double, x);
+}
+
+#define _cw_rem_pi_2_select(x) \
+    _Generic((x), \
+        float: _cw_rem_pi_2_select_float, \
+        double: _cw_rem_pi_2_select_double \
+    )(x)
+
+/*
+ * Same as _cw_rem_pi_2, for x in [0, PH_THRESHOLD_*) (ph.h), in the
+ * quadrant form of reduce.h: the quotient q stays in the floating-point
+ * domain, and z = q + 2ᵖ⁻¹ holds it exactly (0 ≤ q < 2ᵖ⁻¹), so that the
+ * low bits of z are q mod 4 (_quadrant), without a conversion to an
+ * integer. The operations on v₁ and v₂ are those of _cw_rem_pi_2, and
+ * those of the vector kernels of sincos-simd.h, so they are the same.
+ * (bdl_reduce_quadrant, with two constants, is less accurate; see
+ * test-reduce-quadrant.txt.)
+ */
+
+#define CW_QUADRANT_BIAS_FLOAT  (0x1.0p+23f)
+#define CW_QUADRANT_BIAS_DOUBLE (0x1.0p+52)
+
+static inline quadrant_result_float
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_quadrant_pi_2_float(float x)
+{
+    const cw_parameters_float parameters = cw_parameters_pi_2_float;
+    assert(x >= 0.0f && x < CW_QUADRANT_BIAS_FLOAT);
+    float t = cw_quotient_float(parameters, x);
+    float q = truncf(t);
+    tuple_float rem = cw_reduce_float(parameters, x, q);
+    float v1 = rem.a;
+    float v2 = rem.b;
+    COUNT(COUNTER_CW_FLOAT);
+    if (v1 + v2 < 0.0f) { // see _cw_correction
+        COUNT(COUNTER_CW_CORRECTION_FLOAT);
+        v1 += parameters.C1;
+        v2 += parameters.C2;
+        q -= 1.0f;
+    }
+    return (quadrant_result_float) {q + CW_QUADRANT_BIAS_FLOAT, v1, v2};
+}
+
+static inline quadrant_result_double
+__attribute__((always_inline))
+COUNTERS_CONST
+_cw_quadrant_pi_2_double(double x)
+{
+    const cw_parameters_double parameters = cw_parameters_pi_2_double;
+    assert(x >= 0.0 && x < CW_QUADRANT_BIAS_DOUBLE);
+    double t = cw_quotient_double(parameters, x);
+    double q = trunc(t);
+    tuple_double rem = cw_reduce_double(parameters, x, q);
+    double v1 = rem.a;
+    double v2 = rem.b;
+    COUNT(COUNTER_CW_DOUBLE);
+    if (v1 + v2 < 0.0) { // see _cw_correction
+        COUNT(COUNTER_CW_CORRECTION_DOUBLE);
+        v1 += parameters.C1;
+        v2 += parameters.C2;
+        q -= 1.0;
+    }
+    return (quadrant_result_double) {q + CW_QUADRANT_BIAS_DOUBLE, v1, v2};
+}
+
+#define _cw_quadrant_pi_2(x) \
+    _Generic((x), \
+        float: _cw_quadrant_pi_2_float, \
+        double: _cw_quadrant_pi_2_double \
+    )(x)
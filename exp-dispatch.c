@@ -0,0 +1,147 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#include <stddef.h> // size_t
+
+#include "exp.h"
+#include "isa.h" // isa_level
+
+/*
+ * The public functions of exp.h, for a build of exp.c per level of isa.h
+ * (exp-v2.o, exp-v3.o, exp-v4.o), as in sincos-dispatch.c.
+ */
+
+#define EXP_DECLARE(level) \
+    float _exp_float_v##level(float x); \
+    double _exp_double_v##level(double x); \
+    void _exp_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _exp_array_double_v##level(double xs[], double ys[], size_t n); \
+    float _exp2_float_v##level(float x); \
+    double _exp2_double_v##level(double x); \
+    void _exp2_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _exp2_array_double_v##level(double xs[], double ys[], size_t n); \
+    float _expm1_float_v##level(float x); \
+    double _expm1_double_v##level(double x); \
+    void _expm1_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _expm1_array_double_v##level(double xs[], double ys[], size_t n);
+
+EXP_DECLARE(2)
+EXP_DECLARE(3)
+EXP_DECLARE(4)
+
+typedef struct {
+    float (*exp_float)(float);
+    double (*exp_double)(double);
+    void (*exp_array_float)(float *, float *, size_t);
+    void (*exp_array_double)(double *, double *, size_t);
+    float (*exp2_float)(float);
+    double (*exp2_double)(double);
+    void (*exp2_array_float)(float *, float *, size_t);
+    void (*exp2_array_double)(double *, double *, size_t);
+    float (*expm1_float)(float);
+    double (*expm1_double)(double);
+    void (*expm1_array_float)(float *, float *, size_t);
+    void (*expm1_array_double)(double *, double *, size_t);
+} exp_functions;
+
+#define EXP_FUNCTIONS(level) \
+    { \
+        &_exp_float_v##level, \
+        &_exp_double_v##level, \
+        &_exp_array_float_v##level, \
+        &_exp_array_double_v##level, \
+        &_exp2_float_v##level, \
+        &_exp2_double_v##level, \
+        &_exp2_array_float_v##level, \
+        &_exp2_array_double_v##level, \
+        &_expm1_float_v##level, \
+        &_expm1_double_v##level, \
+        &_expm1_array_float_v##level, \
+        &_expm1_array_double_v##level, \
+    }
+
+static const exp_functions levels[5] = {
+    [2] = EXP_FUNCTIONS(2),
+    [3] = EXP_FUNCTIONS(3),
+    [4] = EXP_FUNCTIONS(4),
+};
+
+static exp_functions f = EXP_FUNCTIONS(2);
+
+static void
+__attribute__((constructor))
+init(void)
+{
+    f = levels[isa_level()];
+}
+
+float
+_exp_float(float x)
+{
+    return (*f.exp_float)(x);
+}
+
+double
+_exp_double(double x)
+{
+    return (*f.exp_double)(x);
+}
+
+void
+_exp_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.exp_array_float)(xs, ys, n);
+}
+
+void
+_exp_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.exp_array_double)(xs, ys, n);
+}
+
+float
+_exp2_float(float x)
+{
+    return (*f.exp2_float)(x);
+}
+
+double
+_exp2_double(double x)
+{
+    return (*f.exp2_double)(x);
+}
+
+void
+_exp2_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.exp2_array_float)(xs, ys, n);
+}
+
+void
+_exp2_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.exp2_array_double)(xs, ys, n);
+}
+
+float
+_expm1_float(float x)
+{
+    return (*f.expm1_float)(x);
+}
+
+double
+_expm1_double(double x)
+{
+    return (*f.expm1_double)(x);
+}
+
+void
+_expm1_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.expm1_array_float)(xs, ys, n);
+}
+
+void
+_expm1_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.expm1_array_double)(xs, ys, n);
+}
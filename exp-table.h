@@ -0,0 +1,300 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/* Compile with -DNDEBUG, except for debugging. */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // int32_t, int64_t
+
+#include "arithmetic.h" // madd, mul
+#include "polynomial.h" // eval_polynomial_*1
+#include "types.h" // triple_double, tuple_float, tuple_double
+
+/*
+ * Table-driven exp(x), after the reduction x = q⋅ln 2∕128 + r of cw.h
+ * (or of exp.c, for exp2), with q = 128⋅e + j: [1]
+ *
+ *     exp(x) = 2ᵉ ⋅ 2^(j∕128) ⋅ exp(r),    |r| < ln 2∕128
+ *
+ * The tables hold 2^(j∕128) in double-double (float-float), and the short
+ * polynomial approximates exp(r) - 1 - r on [-ln 2∕128, ln 2∕128].
+ *
+ * The tables are generated by gen-exp-table.c, and the polynomials by
+ * remez.c (./remez exp float|double).
+ *
+ * [1] P. T. P. Tang. Table-driven implementation of the exponential
+ *     function in IEEE floating-point arithmetic. ACM Trans. Math. Softw.
+ *     15, 2 (June 1989), 144-157.
+ */
+
+// 2^(j∕128) ≅ _exp_table_float[j] + _exp_table_lo_float[j]
+static const float _exp_table_float[128] = {
+    1.000000000e+00f, 1.005429864e+00f, 1.010889292e+00f,
+    1.016378284e+00f, 1.021897197e+00f, 1.027445912e+00f,
+    1.033024907e+00f, 1.038634062e+00f, 1.044273734e+00f,
+    1.049944043e+00f, 1.055645227e+00f, 1.061377168e+00f,
+    1.067140460e+00f, 1.072934866e+00f, 1.078760743e+00f,
+    1.084618330e+00f, 1.090507746e+00f, 1.096429110e+00f,
+    1.102382541e+00f, 1.108368397e+00f, 1.114386797e+00f,
+    1.120437741e+00f, 1.126521587e+00f, 1.132638574e+00f,
+    1.138788581e+00f, 1.144972086e+00f, 1.151189208e+00f,
+    1.157440066e+00f, 1.163724899e+00f, 1.170043826e+00f,
+    1.176396966e+00f, 1.182784677e+00f, 1.189207077e+00f,
+    1.195664406e+00f, 1.202156782e+00f, 1.208684325e+00f,
+    1.215247393e+00f, 1.221845984e+00f, 1.228480577e+00f,
+    1.235151052e+00f, 1.241857767e+00f, 1.248600960e+00f,
+    1.255380750e+00f, 1.262197375e+00f, 1.269050956e+00f,
+    1.275941730e+00f, 1.282870054e+00f, 1.289835930e+00f,
+    1.296839595e+00f, 1.303881288e+00f, 1.310961246e+00f,
+    1.318079591e+00f, 1.325236678e+00f, 1.332432508e+00f,
+    1.339667559e+00f, 1.346941829e+00f, 1.354255557e+00f,
+    1.361608982e+00f, 1.369002461e+00f, 1.376435995e+00f,
+    1.383909941e+00f, 1.391424417e+00f, 1.398979664e+00f,
+    1.406576037e+00f, 1.414213538e+00f, 1.421892643e+00f,
+    1.429613352e+00f, 1.437376022e+00f, 1.445180774e+00f,
+    1.453027964e+00f, 1.460917830e+00f, 1.468850374e+00f,
+    1.476826191e+00f, 1.484845161e+00f, 1.492907763e+00f,
+    1.501014113e+00f, 1.509164453e+00f, 1.517359018e+00f,
+    1.525598168e+00f, 1.533882022e+00f, 1.542210817e+00f,
+    1.550584912e+00f, 1.559004426e+00f, 1.567469597e+00f,
+    1.575980902e+00f, 1.584538221e+00f, 1.593142152e+00f,
+    1.601792812e+00f, 1.610490322e+00f, 1.619235158e+00f,
+    1.628027439e+00f, 1.636867404e+00f, 1.645755529e+00f,
+    1.654691815e+00f, 1.663676620e+00f, 1.672710180e+00f,
+    1.681792855e+00f, 1.690924764e+00f, 1.700106382e+00f,
+    1.709337711e+00f, 1.718619347e+00f, 1.727951288e+00f,
+    1.737333894e+00f, 1.746767402e+00f, 1.756252170e+00f,
+    1.765788436e+00f, 1.775376439e+00f, 1.785016656e+00f,
+    1.794709086e+00f, 1.804454207e+00f, 1.814252138e+00f,
+    1.824103355e+00f, 1.834008098e+00f, 1.843966603e+00f,
+    1.853979111e+00f, 1.864046097e+00f, 1.874167681e+00f,
+    1.884344220e+00f, 1.894575953e+00f, 1.904863358e+00f,
+    1.915206552e+00f, 1.925605893e+00f, 1.936061740e+00f,
+    1.946574450e+00f, 1.957144141e+00f, 1.967771173e+00f,
+    1.978456020e+00f, 1.989198804e+00f,
+};
+static const float _exp_table_lo_float[128] = {
+    0.000000000e+00f, 3.718305308e-08f, -5.711605411e-09f,
+    3.141028060e-08f, -4.811559862e-08f, 3.675761917e-08f,
+    -2.809089317e-08f, 4.014802357e-08f, 4.833470157e-08f,
+    4.264120079e-08f, -4.907169426e-08f, 5.958754201e-08f,
+    -5.933751979e-08f, 1.574437469e-09f, 5.461594554e-08f,
+    3.221147793e-08f, -1.307753994e-08f, -2.775698782e-08f,
+    4.260501996e-08f, 1.496464463e-08f, -5.435540018e-08f,
+    1.113000447e-08f, 3.123641434e-08f, -5.404782755e-08f,
+    5.386222313e-08f, 5.847904561e-08f, 2.192228266e-08f,
+    7.296165450e-09f, -4.051441493e-08f, -5.641996026e-08f,
+    2.566975077e-08f, 3.443252083e-08f, 3.797635273e-08f,
+    -1.378292680e-08f, -5.069756526e-08f, -1.591619059e-09f,
+    -3.267394888e-08f, 4.851383295e-08f, -4.136200360e-08f,
+    1.146195761e-08f, 4.496838102e-08f, 1.741137190e-08f,
+    7.322237483e-09f, -2.490329543e-08f, 1.419333318e-09f,
+    4.885079719e-08f, -3.816621685e-08f, -5.646393930e-08f,
+    -4.018999533e-08f, -2.238283159e-08f, -3.496571566e-08f,
+    1.046863929e-08f, -3.496373324e-08f, 3.861453379e-08f,
+    -3.461673970e-08f, -4.249477570e-08f, -1.012334927e-08f,
+    3.855204156e-08f, -3.845881835e-08f, -2.434739876e-08f,
+    -5.875577358e-08f, -4.172380130e-08f, 8.689434061e-09f,
+    -4.358790662e-08f, 2.420323497e-08f, -4.080568772e-08f,
+    -1.342992917e-08f, -2.488988571e-08f, 3.324199938e-08f,
+    3.221074607e-08f, -3.628657552e-08f, 5.911518031e-08f,
+    -4.500898854e-08f, 4.434764111e-09f, -3.423620143e-08f,
+    -4.379978336e-08f, -2.495937323e-08f, 2.287240974e-08f,
+    -1.762856883e-08f, -2.406303601e-08f, 8.070904833e-09f,
+    -3.461510900e-08f, -2.576466507e-08f, 4.310275870e-08f,
+    -5.661025426e-08f, 4.389324104e-08f, -4.903136785e-10f,
+    -5.666471736e-08f, 9.836217174e-09f, -2.277175071e-08f,
+    -1.726008314e-08f, 4.578289392e-08f, -5.124972091e-08f,
+    -4.772008566e-08f, -3.920298752e-08f, -6.409962006e-10f,
+    -2.475532668e-08f, 3.558979955e-08f, -2.865147231e-08f,
+    5.176623574e-08f, -4.849617596e-08f, -5.726142760e-08f,
+    -5.850223417e-08f, -1.549608264e-08f, -9.235770371e-09f,
+    -2.701300121e-12f, 5.343197884e-08f, -4.460300218e-08f,
+    -1.141504491e-08f, -3.961372386e-08f, 3.736258236e-08f,
+    2.999933812e-08f, -1.123927795e-08f, -3.432048956e-08f,
+    1.436561181e-08f, -4.840396883e-08f, -4.663005626e-08f,
+    -4.112910190e-08f, 2.810338451e-08f, -1.572627184e-08f,
+    9.845328108e-09f, 5.050105401e-08f, 5.357072297e-08f,
+    -3.195995291e-08f, -1.702180441e-08f, 5.070967646e-08f,
+    6.032726318e-09f, 4.306559376e-08f,
+};
+
+// 2^(j∕128) ≅ _exp_table_double[j] + _exp_table_lo_double[j]
+static const double _exp_table_double[128] = {
+    1.00000000000000000e+00, 1.00542990111280273e+00, 1.01088928605170048e+00,
+    1.01637831491095310e+00, 1.02189714865411663e+00, 1.02744594911876375e+00,
+    1.03302487902122841e+00, 1.03863410196137873e+00, 1.04427378242741375e+00,
+    1.04994408580068721e+00, 1.05564517836055716e+00, 1.06137722728926209e+00,
+    1.06714040067682370e+00, 1.07293486752597556e+00, 1.07876079775711986e+00,
+    1.08461836221330921e+00, 1.09050773266525769e+00, 1.09642908181637688e+00,
+    1.10238258330784089e+00, 1.10836841172367873e+00, 1.11438674259589243e+00,
+    1.12043775240960675e+00, 1.12652161860824185e+00, 1.13263851959871920e+00,
+    1.13878863475669156e+00, 1.14497214443180417e+00, 1.15118922995298267e+00,
+    1.15744007363375112e+00, 1.16372485877757748e+00, 1.17004376968325019e+00,
+    1.17639699165028122e+00, 1.18278471098434101e+00, 1.18920711500272103e+00,
+    1.19566439203982733e+00, 1.20215673145270308e+00, 1.20868432362658162e+00,
+    1.21524735998046896e+00, 1.22184603297275762e+00, 1.22848053610687002e+00,
+    1.23515106393693341e+00, 1.24185781207348400e+00, 1.24860097718920482e+00,
+    1.25538075702469110e+00, 1.26219735039425074e+00, 1.26905095719173322e+00,
+    1.27594177839639200e+00, 1.28287001607877826e+00, 1.28983587340666572e+00,
+    1.29683955465100964e+00, 1.30388126519193581e+00, 1.31096121152476441e+00,
+    1.31807960126606405e+00, 1.32523664315974132e+00, 1.33243254708316150e+00,
+    1.33966752405330292e+00, 1.34694178623294580e+00, 1.35425554693689265e+00,
+    1.36160902063822475e+00, 1.36900242297459052e+00, 1.37643597075453017e+00,
+    1.38390988196383202e+00, 1.39142437577192624e+00, 1.39897967253831124e+00,
+    1.40657599381901544e+00, 1.41421356237309515e+00, 1.42189260216916558e+00,
+    1.42961333839197002e+00, 1.43737599744898237e+00, 1.44518080697704665e+00,
+    1.45302799584905262e+00, 1.46091779418064704e+00, 1.46885043333698184e+00,
+    1.47682614593949935e+00, 1.48484516587275239e+00, 1.49290772829126484e+00,
+    1.50101406962642558e+00, 1.50916442759342284e+00, 1.51735904119821474e+00,
+    1.52559815074453842e+00, 1.53388199784095591e+00, 1.54221082540794074e+00,
+    1.55058487768499997e+00, 1.55900440023783693e+00, 1.56746963996555300e+00,
+    1.57598084510788650e+00, 1.58453826525249375e+00, 1.59314215134226700e+00,
+    1.60179275568269341e+00, 1.61049033194925428e+00, 1.61923513519486373e+00,
+    1.62802742185734783e+00, 1.63686744976696441e+00, 1.64575547815396495e+00,
+    1.65469176765619430e+00, 1.66367658032673638e+00, 1.67271017964159663e+00,
+    1.68179283050742900e+00, 1.69092479926930528e+00, 1.70010635371852348e+00,
+    1.70933776310046293e+00, 1.71861929812247793e+00, 1.72795123096183767e+00,
+    1.73733383527370622e+00, 1.74676738619916905e+00, 1.75625216037329945e+00,
+    1.76578843593327273e+00, 1.77537649252652119e+00, 1.78501661131893496e+00,
+    1.79470907500310717e+00, 1.80445416780662393e+00, 1.81425217550039886e+00,
+    1.82410338540705341e+00, 1.83400808640934243e+00, 1.84396656895862598e+00,
+    1.85397912508338547e+00, 1.86404604839778898e+00, 1.87416763411029996e+00,
+    1.88434417903233453e+00, 1.89457598158696561e+00, 1.90486334181767414e+00,
+    1.91520656139714740e+00, 1.92560594363612503e+00, 1.93606179349229435e+00,
+    1.94657441757923322e+00, 1.95714412417540018e+00, 1.96777122323317588e+00,
+    1.97845602638795093e+00, 1.98919884696726634e+00,
+};
+static const double _exp_table_lo_double[128] = {
+    0.00000000000000000e+00, 9.49918653545503176e-17, -1.52347786033685772e-17,
+    -5.77217007319966003e-17, 5.10922502897344389e-17, -4.95607417464537044e-17,
+    7.60083887402708849e-18, 5.99627378885251062e-17, 8.55188970553796489e-17,
+    5.59293784812700259e-17, 1.75932573877209198e-18, -1.19735370853656576e-17,
+    -7.89985396684158212e-17, -3.83966884335882381e-18, -6.65666043605659260e-17,
+    3.16615284581634612e-17, -3.04678207981247115e-17, -5.91993348444931582e-17,
+    5.26603687157069439e-17, -8.78681384518052662e-17, 1.04102784568455710e-16,
+    -6.20108590655417875e-17, 5.16585675879545674e-17, 3.23735616673800026e-17,
+    8.91281267602540778e-17, 4.64128989217001066e-17, 3.25071021886382721e-17,
+    -9.12387123113440029e-17, 3.82920483692409350e-17, -1.84774420179000469e-18,
+    5.55420325421807896e-17, 1.54297543007907606e-17, 3.98201523146564611e-17,
+    4.61660367048148140e-17, 6.64498149925230124e-17, -4.74672594522898410e-17,
+    -7.71263069268148813e-17, -1.06110212114026912e-16, -1.89878163130252995e-17,
+    -1.07552443443078414e-16, 4.65802759183693679e-17, -8.26181099902196355e-17,
+    -6.71138982129687842e-18, -3.08446488747384647e-17, 2.66793213134218610e-18,
+    9.91543024421429033e-17, 1.71359491824356097e-17, 8.94925753089759172e-17,
+    2.53825027948883150e-17, 8.64767559826787118e-17, -7.18153613551945386e-17,
+    -5.45795582714915350e-17, -2.85873121003886137e-17, -5.10158663091674396e-17,
+    8.92728259483173198e-17, 3.22406510125467917e-17, 7.70094837980298946e-17,
+    1.53378766127066805e-18, 9.59379791911884877e-17, -6.89858893587180104e-17,
+    -6.77051165879478629e-17, -4.90617486528898932e-17, -9.61421320905132307e-17,
+    7.03491481213642219e-18, -9.66729331345291345e-17, -1.60778289158902441e-17,
+    -1.20316424890536552e-17, -4.20403401646755661e-17, -3.02375813499398732e-17,
+    -5.77994860939610610e-17, -5.60037718607521580e-17, 8.46588275653362761e-17,
+    -3.48399455689279580e-17, 1.07800867644074808e-16, 1.41929201542840358e-17,
+    -6.41376727579023504e-17, -1.01645532775429504e-16, -4.30869947204334080e-17,
+    -1.10249417123425609e-16, 8.87522684443844614e-17, 7.94983480969762086e-17,
+    -1.46007065906893852e-17, 3.78120705335752750e-17, -1.03520617688497220e-16,
+    -1.01369164712783040e-17, -1.93377170345857029e-17, -1.00944065423119637e-16,
+    -6.05491745352778434e-17, 2.47071925697978879e-17, 2.09413341542290924e-17,
+    -6.71295508470708409e-17, 7.69832507131987557e-17, -1.01256799136747726e-16,
+    9.64329430319602866e-17, 5.89099269671309967e-17, -5.47671596459956308e-17,
+    8.19901002058149652e-17, -9.66967147439488017e-17, -8.02371937039770025e-18,
+    -9.86877945663293108e-17, -1.85138041826311099e-17, -1.07509818612046424e-16,
+    3.16438929929295695e-17, -1.07522904835075145e-16, 2.96014069544887331e-17,
+    9.46131501808326787e-17, 6.42973179655657203e-17, 1.53304001210313138e-17,
+    1.82274584279120868e-17, -5.17722240879331788e-17, -9.96953153892034882e-17,
+    -1.01596278622770831e-16, 3.28310722424562720e-17, -5.93974202694996455e-17,
+    9.76188749072759354e-17, 6.54091268062057171e-17, -6.12276341300414256e-17,
+    -8.22659312553371091e-17, 3.40340353521652967e-17, 6.53385751471827863e-17,
+    -1.06199460561959626e-16, -9.91496376969374093e-17, 1.03323859606763257e-16,
+    6.81102234953387718e-17, 8.96076779103666777e-17, -1.03149280115311315e-16,
+    4.03887531092781666e-17, 8.20513263836919942e-18,
+};
+
+/*
+ * exp(x) ≅ 1 + x + x²⋅E(x) on [-ln 2∕128, ln 2∕128],
+ * relative error < 2^-29.5 (./remez exp float 2).
+ */
+
+static const float _exp_as_float[2] = {
+    /* x^2 */ 5.000010133e-01f,
+    /* x^3 */ 1.588808745e-01f,
+};
+
+/*
+ * exp(x) ≅ 1 + x + x²⋅E(x) on [-ln 2∕128, ln 2∕128],
+ * relative error < 2^-67.7 (./remez exp double 5).
+ */
+
+static const double _exp_as_double[5] = {
+    /* x^2 */ 5.00000000000000000e-01,
+    /* x^3 */ 1.66666666666577923e-01,
+    /* x^4 */ 4.16666666664843102e-02,
+    /* x^5 */ 8.33334171276609893e-03,
+    /* x^6 */ 1.38896024852490471e-03,
+};
+
+/*
+ * Return 2^(j∕128)⋅exp(v₁ + v₂), for |v₁ + v₂| < ln 2∕128 and a small v₂
+ * (v₂² and v₁⋅v₂ are negligible), as the sum of the table entry T and
+ * the rest:
+ *
+ *     2^(j∕128)⋅exp(v₁ + v₂) ≅ T + (T⋅(v₁ + v₂ + v₁²⋅E(v₁)) + Tₗ)
+ *
+ * The first term T is exact, and the rest is less than T∕128, so its
+ * rounding errors are less than about 0.01 ulp.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+_exp_kernel_float(int32_t j, float v1, float v2)
+{
+    const size_t n = sizeof _exp_as_float / sizeof _exp_as_float[0];
+    float t = _exp_table_float[j];
+    float tl = _exp_table_lo_float[j];
+    float p = eval_polynomial_float1(_exp_as_float, n, v1);
+    float m = v1 + madd(v1 * v1, p, v2);
+    return (tuple_float) {t, madd(t, m, tl)};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_exp_kernel_double(int64_t j, double v1, double v2)
+{
+    const size_t n = sizeof _exp_as_double / sizeof _exp_as_double[0];
+    double t = _exp_table_double[j];
+    double tl = _exp_table_lo_double[j];
+    double p = eval_polynomial_double1(_exp_as_double, n, v1);
+    double m = v1 + madd(v1 * v1, p, v2);
+    return (tuple_double) {t, madd(t, m, tl)};
+}
+
+#define _exp_kernel(j, v1, v2) \
+    _Generic((v1), \
+        float: _exp_kernel_float, \
+        double: _exp_kernel_double \
+    )(j, v1, v2)
+
+/*
+ * Same as _exp_kernel_double, with the product T⋅v₁ exact, for expm1,
+ * where the rest is not small against the result: return {T, T⋅v₁, rest}
+ * (the rest being T⋅(v₂ + v₁²⋅E(v₁)) + Tₗ⋅(1 + v₁) and the error of T⋅v₁;
+ * Tₗ⋅v₁ is a third of an ulp of exp(x) - 1 near ±ln 2∕128).
+ */
+
+static inline triple_double
+__attribute__((always_inline))
+__attribute__((const))
+_expm1_kernel_double(int64_t j, double v1, double v2)
+{
+    const size_t n = sizeof _exp_as_double / sizeof _exp_as_double[0];
+    double t = _exp_table_double[j];
+    double tl = _exp_table_lo_double[j];
+    double p = eval_polynomial_double1(_exp_as_double, n, v1);
+    tuple_double tv = mul(t, v1);
+    double rest = madd(t, madd(v1 * v1, p, v2), madd(tl, v1, tl));
+    return (triple_double) {t, tv.a, rest + tv.b};
+}
@@ -0,0 +1,316 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#include <assert.h>
+#include <math.h> // fabs, isnan
+#include <stddef.h> // size_t
+#include <stdint.h> // int32_t, int64_t, uint32_t, uint64_t
+#include <string.h> // memcpy
+
+#include "arithmetic.h" // add, madd, mul
+#include "constants.h" // ln2, etc.
+#include "counters.h" // COUNTERS_CONST
+#include "cw.h" // _cw_rem, cw_parameters_ln2_128_*
+#include "exp-table.h" // _exp_kernel
+#include "isa.h" // ISA_NAME
+#include "types.h" // rem_result_float, rem_result_double, triple_double, tuple_float, tuple_double
+
+/*
+ * Compiled with -DISA=N, for exp-dispatch.c, this file defines
+ * _exp_float_vN, etc., instead of the public functions (see isa.h).
+ */
+
+#if defined(ISA)
+#define _exp_float ISA_NAME(_exp_float)
+#define _exp_double ISA_NAME(_exp_double)
+#define _exp_array_float ISA_NAME(_exp_array_float)
+#define _exp_array_double ISA_NAME(_exp_array_double)
+#define _exp2_float ISA_NAME(_exp2_float)
+#define _exp2_double ISA_NAME(_exp2_double)
+#define _exp2_array_float ISA_NAME(_exp2_array_float)
+#define _exp2_array_double ISA_NAME(_exp2_array_double)
+#define _expm1_float ISA_NAME(_expm1_float)
+#define _expm1_double ISA_NAME(_expm1_double)
+#define _expm1_array_float ISA_NAME(_expm1_array_float)
+#define _expm1_array_double ISA_NAME(_expm1_array_double)
+#endif
+
+#include "exp.h"
+
+/*
+ * Return y⋅2ᵉ, as y⋅2^⌊e∕2⌋⋅2^(e - ⌊e∕2⌋), so that both powers of two are
+ * normal for the exponents of exp, from below the subnormals to above the
+ * overflow threshold. For y in [1∕2, 2], the first product is exact, and
+ * the second rounds once, to a subnormal, or to infinity.
+ */
+
+static inline float
+__attribute__((always_inline))
+__attribute__((const))
+_exp_scale_float(float y, int32_t e)
+{
+    int32_t e1 = e / 2;
+    int32_t e2 = e - e1;
+    uint32_t b1 = (uint32_t) (e1 + 127) << 23;
+    uint32_t b2 = (uint32_t) (e2 + 127) << 23;
+    float s1, s2;
+    memcpy(&s1, &b1, sizeof s1);
+    memcpy(&s2, &b2, sizeof s2);
+    return y * s1 * s2;
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+_exp_scale_double(double y, int64_t e)
+{
+    int64_t e1 = e / 2;
+    int64_t e2 = e - e1;
+    uint64_t b1 = (uint64_t) (e1 + 1023) << 52;
+    uint64_t b2 = (uint64_t) (e2 + 1023) << 52;
+    double s1, s2;
+    memcpy(&s1, &b1, sizeof s1);
+    memcpy(&s2, &b2, sizeof s2);
+    return y * s1 * s2;
+}
+
+#define _exp_scale(y, e) \
+    _Generic((y), \
+        float: _exp_scale_float, \
+        double: _exp_scale_double \
+    )(y, e)
+
+/*
+ * exp(x), with the Cody-Waite reduction of cw.h by ln 2∕128:
+ *
+ *     x = q⋅ln 2∕128 + r,    q = 128⋅e + j,    0 ≤ j < 128
+ *     exp(x) = 2ᵉ⋅2^(j∕128)⋅exp(r)
+ *
+ * where r = v₁ + v₂ has the sign of x and |r| < ln 2∕128; then the kernel
+ * of exp-table.h. x is clamped beyond the thresholds of overflow and
+ * underflow, so that e is small, and the result is ∞ or 0, as it should.
+ */
+
+static inline float
+__attribute__((always_inline))
+COUNTERS_CONST
+_exp_ln2_128_float(float x)
+{
+    if (isnan(x))
+        return x + x;
+    // exp(x) overflows above 88.73, and rounds to 0 below -103.98
+    x = x > 89.0f ? 89.0f : x;
+    x = x < -104.0f ? -104.0f : x;
+    rem_result_float rem = _cw_rem(cw_parameters_ln2_128_float, x);
+    int32_t j = rem.z & 127;
+    int32_t e = (rem.z - j) / 128;
+    tuple_float y = _exp_kernel(j, rem.v1, rem.v2);
+    return _exp_scale(y.a + y.b, e);
+}
+
+static inline double
+__attribute__((always_inline))
+COUNTERS_CONST
+_exp_ln2_128_double(double x)
+{
+    if (isnan(x))
+        return x + x;
+    // exp(x) overflows above 709.79, and rounds to 0 below -745.14
+    x = x > 710.0 ? 710.0 : x;
+    x = x < -746.0 ? -746.0 : x;
+    rem_result_double rem = _cw_rem(cw_parameters_ln2_128_double, x);
+    int64_t j = rem.z & 127;
+    int64_t e = (rem.z - j) / 128;
+    tuple_double y = _exp_kernel(j, rem.v1, rem.v2);
+    return _exp_scale(y.a + y.b, e);
+}
+
+#define _exp_ln2_128(x) \
+    _Generic((x), \
+        float: _exp_ln2_128_float, \
+        double: _exp_ln2_128_double \
+    )(x)
+
+/*
+ * 2ˣ, with an exact reduction: x = q∕128 + s, where q = ⌊128⋅x⌉ toward
+ * zero, and s = x - q∕128 is exact (128⋅x is exact, and so is the
+ * difference, by Sterbenz's lemma); then r = s⋅ln 2 ≅ v₁ + v₂, with the
+ * error of the product, and the kernel of exp, as for exp(x).
+ */
+
+static inline float
+__attribute__((always_inline))
+__attribute__((const))
+_exp2_128_float(float x)
+{
+    if (isnan(x))
+        return x + x;
+    // 2ˣ overflows at 128, and rounds to 0 below -150
+    x = x > 129.0f ? 129.0f : x;
+    x = x < -151.0f ? -151.0f : x;
+    int32_t q = (int32_t) (x * 128.0f);
+    float s = x - (float) q * 0x1.0p-7f;
+    tuple_float r = mul(s, ln2_hi(float));
+    float v1 = r.a;
+    float v2 = madd(s, ln2_lo(float), r.b);
+    int32_t j = q & 127;
+    int32_t e = (q - j) / 128;
+    tuple_float y = _exp_kernel(j, v1, v2);
+    return _exp_scale(y.a + y.b, e);
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+_exp2_128_double(double x)
+{
+    if (isnan(x))
+        return x + x;
+    // 2ˣ overflows at 1024, and rounds to 0 below -1075
+    x = x > 1025.0 ? 1025.0 : x;
+    x = x < -1076.0 ? -1076.0 : x;
+    int64_t q = (int64_t) (x * 128.0);
+    double s = x - (double) q * 0x1.0p-7;
+    tuple_double r = mul(s, ln2_hi(double));
+    double v1 = r.a;
+    double v2 = madd(s, ln2_lo(double), r.b);
+    int64_t j = q & 127;
+    int64_t e = (q - j) / 128;
+    tuple_double y = _exp_kernel(j, v1, v2);
+    return _exp_scale(y.a + y.b, e);
+}
+
+#define _exp2_128(x) \
+    _Generic((x), \
+        float: _exp2_128_float, \
+        double: _exp2_128_double \
+    )(x)
+
+/*
+ * exp(x) - 1, with the reduction of exp(x), and its kernel with the
+ * product T⋅v₁ exact:
+ *
+ *     exp(x) - 1 = (2ᵉ⋅T - 1) + 2ᵉ⋅T⋅v₁ + 2ᵉ⋅rest
+ *
+ * where 2ᵉ⋅T - 1 is exact as a sum of two (TwoSum). r has the sign of x,
+ * so the first two terms have the same sign, and do not cancel; for
+ * |x| < ln 2∕128, q = 0 and T = 1, so the result is v₁ + rest, with its
+ * relative error. The float version is the double version, rounded: in
+ * float, the rest is as large as the ulp of the result.
+ */
+
+static inline double
+__attribute__((always_inline))
+COUNTERS_CONST
+_expm1_ln2_128_double(double x)
+{
+    if (isnan(x))
+        return x + x;
+    // |expm1(x) - x| < x² < ulp(x)∕2, including ±0
+    if (fabs(x) < 0x1.0p-54)
+        return x;
+    // exp(x) < ulp(1)∕4, below 1
+    if (x < -38.0)
+        return -1.0;
+    // 1 < ulp(exp(x))∕2¹¹, and exp(x) may overflow
+    if (x > 44.0)
+        return _exp_ln2_128(x);
+    rem_result_double rem = _cw_rem(cw_parameters_ln2_128_double, x);
+    int64_t j = rem.z & 127;
+    int64_t e = (rem.z - j) / 128;
+    triple_double y = _expm1_kernel_double(j, rem.v1, rem.v2);
+    tuple_double s = add(_exp_scale(y.a, e), -1.0);
+    tuple_double u = add(s.a, _exp_scale(y.b, e));
+    return u.a + ((u.b + s.b) + _exp_scale(y.c, e));
+}
+
+static inline float
+__attribute__((always_inline))
+COUNTERS_CONST
+_expm1_ln2_128_float(float x)
+{
+    return (float) _expm1_ln2_128_double((double) x);
+}
+
+#define _expm1_ln2_128(x) \
+    _Generic((x), \
+        float: _expm1_ln2_128_float, \
+        double: _expm1_ln2_128_double \
+    )(x)
+
+float
+_exp_float(float x)
+{
+    return _exp_ln2_128(x);
+}
+
+double
+_exp_double(double x)
+{
+    return _exp_ln2_128(x);
+}
+
+void
+_exp_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _exp_ln2_128(xs[i]);
+}
+
+void
+_exp_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _exp_ln2_128(xs[i]);
+}
+
+float
+_exp2_float(float x)
+{
+    return _exp2_128(x);
+}
+
+double
+_exp2_double(double x)
+{
+    return _exp2_128(x);
+}
+
+void
+_exp2_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _exp2_128(xs[i]);
+}
+
+void
+_exp2_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _exp2_128(xs[i]);
+}
+
+float
+_expm1_float(float x)
+{
+    return _expm1_ln2_128(x);
+}
+
+double
+_expm1_double(double x)
+{
+    return _expm1_ln2_128(x);
+}
+
+void
+_expm1_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _expm1_ln2_128(xs[i]);
+}
+
+void
+_expm1_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _expm1_ln2_128(xs[i]);
+}
@@ -0,0 +1,50 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#pragma once
+
+#include <stddef.h> // size_t
+
+float _exp_float(float x);
+double _exp_double(double x);
+#define _exp(x) \
+    _Generic((x), \
+        float: _exp_float, \
+        double: _exp_double \
+    )(x)
+void _exp_array_float(float xs[], float ys[], size_t n);
+void _exp_array_double(double xs[], double ys[], size_t n);
+#define _exp_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _exp_array_float, \
+        double: _exp_array_double \
+    )(xs, ys, n)
+
+float _exp2_float(float x);
+double _exp2_double(double x);
+#define _exp2(x) \
+    _Generic((x), \
+        float: _exp2_float, \
+        double: _exp2_double \
+    )(x)
+void _exp2_array_float(float xs[], float ys[], size_t n);
+void _exp2_array_double(double xs[], double ys[], size_t n);
+#define _exp2_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _exp2_array_float, \
+        double: _exp2_array_double \
+    )(xs, ys, n)
+
+float _expm1_float(float x);
+double _expm1_double(double x);
+#define _expm1(x) \
+    _Generic((x), \
+        float: _expm1_float, \
+        double: _expm1_double \
+    )(x)
+void _expm1_array_float(float xs[], float ys[], size_t n);
+void _expm1_array_double(double xs[], double ys[], size_t n);
+#define _expm1_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _expm1_array_float, \
+        double: _expm1_array_double \
+    )(xs, ys, n)
@@ -0,0 +1,150 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/* Compile with -DNDEBUG, except for debugging. */
+
+#pragma once
+
+#include "arithmetic.h" // add, madd, mul
+#include "types.h" // tuple_double, triple_double
+
+/*
+ * Double-double and triple-double arithmetic, on the error-free
+ * transformations of arithmetic.h, for the accurate paths of sincos-cr.h.
+ * A double-double is an unevaluated sum a + b with |b| ≤ ulp(a)∕2,
+ * a triple-double a + b + c, with |c| ≤ ulp(b)∕2 as well. [1] [2]
+ *
+ * The relative errors are about 2⁻¹⁰⁰ for the double-double operations,
+ * and 2⁻¹⁵⁰ for the triple-double operations, as long as a sum does not
+ * cancel; renormalize_td is exact. [2]
+ *
+ * [1] T. J. Dekker. A floating-point technique for extending the available
+ *     precision. Numerische Mathematik 18, 3 (June 1971), 224–242.
+ *
+ * [2] C. Lauter. Basic building blocks for a triple-double intermediate
+ *     format. Research report RR2005-38, LIP, ENS Lyon, 2005.
+ *     https://hal.science/inria-00070314
+ */
+
+/*
+ * Return the sum and its error, for |a| ≥ |b| or a = 0. See Fast2Sum. [1]
+ */
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+fast_add_double(double a, double b)
+{
+    double x = a + b;
+    return (tuple_double) {x, b - (x - a)};
+}
+
+/*
+ * Double-double
+ */
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+add_dd(tuple_double a, tuple_double b)
+{
+    tuple_double s = add(a.a, b.a);
+    tuple_double t = add(a.b, b.b);
+    s.b += t.a;
+    s = fast_add_double(s.a, s.b);
+    s.b += t.b;
+    return fast_add_double(s.a, s.b);
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+mul_dd(tuple_double a, tuple_double b)
+{
+    tuple_double p = mul(a.a, b.a);
+    p.b += a.a * b.b + a.b * b.a;
+    return fast_add_double(p.a, p.b);
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+mul_dd_double(tuple_double a, double b)
+{
+    tuple_double p = mul(a.a, b);
+    p.b = madd(a.b, b, p.b);
+    return fast_add_double(p.a, p.b);
+}
+
+/*
+ * Triple-double
+ */
+
+static inline triple_double
+__attribute__((always_inline))
+__attribute__((const))
+renormalize_td(double a, double b, double c)
+{
+    tuple_double s = add(b, c);
+    tuple_double t = add(a, s.a);
+    tuple_double u = add(t.b, s.b);
+    tuple_double v = fast_add_double(t.a, u.a);
+    tuple_double w = add(v.b, u.b);
+    return (triple_double) {v.a, w.a, w.b};
+}
+
+static inline triple_double
+__attribute__((always_inline))
+__attribute__((const))
+add_td(triple_double a, triple_double b)
+{
+    tuple_double s0 = add(a.a, b.a);
+    tuple_double s1 = add(a.b, b.b);
+    tuple_double s2 = add(s1.a, s0.b);
+    double s3 = (a.c + b.c) + (s1.b + s2.b);
+    return renormalize_td(s0.a, s2.a, s3);
+}
+
+// Add a double: a + b, exactly but for the last term.
+static inline triple_double
+__attribute__((always_inline))
+__attribute__((const))
+add_td_double(triple_double a, double b)
+{
+    tuple_double s0 = add(a.a, b);
+    tuple_double s1 = add(a.b, s0.b);
+    return renormalize_td(s0.a, s1.a, a.c + s1.b);
+}
+
+static inline triple_double
+__attribute__((always_inline))
+__attribute__((const))
+mul_td(triple_double a, triple_double b)
+{
+    tuple_double p0 = mul(a.a, b.a);
+    tuple_double p1 = mul(a.a, b.b);
+    tuple_double p2 = mul(a.b, b.a);
+    tuple_double s1 = add(p1.a, p2.a);
+    tuple_double s2 = add(s1.a, p0.b);
+    double s3 = (a.a * b.c + a.b * b.b + a.c * b.a)
+        + ((p1.b + p2.b) + (s1.b + s2.b));
+    return renormalize_td(p0.a, s2.a, s3);
+}
+
+/*
+ * Return a + b + c rounded to nearest, for a triple-double.
+ * a + b rounds to x, with x + e = a + b exactly; c only matters if a + b
+ * is a tie, half-way from x to its neighbour x + 2e, to break it.
+ */
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+round_td(triple_double a)
+{
+    tuple_double s = add(a.a, a.b);
+    double x = s.a;
+    double e = s.b;
+    double y = x + 2.0 * e;
+    int tie = e != 0.0 && y - x == 2.0 * e;
+    return tie && a.c != 0.0 && (a.c > 0.0) == (e > 0.0) ? y : x;
+}
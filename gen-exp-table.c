@@ -0,0 +1,85 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Generate the tables of exp-table.h:
+ *
+ *     2^(j∕128) ≅ Tⱼ + Tₗⱼ
+ *
+ * for j = 0, 1, …, 127, where Tⱼ is 2^(j∕128) rounded to nearest
+ * and Tₗⱼ is the rest rounded to nearest (double-double or float-float).
+ *
+ * Usage: ./gen-exp-table float|double
+ */
+
+#include <stdio.h>
+#include <string.h> // strcmp
+
+#include <mpfr.h>
+
+static const mpfr_prec_t mp_precision = 256;
+
+#define TABLE_SIZE 128
+
+static void
+print_table(const char *type, mpfr_prec_t p)
+{
+    mpfr_t x, y, hi;
+    mpfr_init2(x, mp_precision);
+    mpfr_init2(y, mp_precision);
+    mpfr_init2(hi, p);
+
+    double his[TABLE_SIZE];
+    double los[TABLE_SIZE];
+    for (int j = 0; j < TABLE_SIZE; j++) {
+        mpfr_set_ui(x, (unsigned long) j, MPFR_RNDN);
+        mpfr_div_ui(x, x, TABLE_SIZE, MPFR_RNDN);
+        mpfr_exp2(y, x, MPFR_RNDN);
+        mpfr_set(hi, y, MPFR_RNDN);
+        mpfr_sub(y, y, hi, MPFR_RNDN);
+        his[j] = mpfr_get_d(hi, MPFR_RNDN);
+        mpfr_set(hi, y, MPFR_RNDN);
+        los[j] = mpfr_get_d(hi, MPFR_RNDN);
+    }
+
+    for (int k = 0; k < 2; k++) {
+        const double *values = k == 0 ? his : los;
+        printf("static const %s _exp_table%s_%s[%i] = {\n",
+            type, k == 0 ? "" : "_lo", type, TABLE_SIZE);
+        for (int j = 0; j < TABLE_SIZE; j++) {
+            printf(j % 3 == 0 ? "   " : "");
+            if (p == 24)
+                printf(" %.9ef,", values[j]);
+            else
+                printf(" %.17e,", values[j]);
+            printf(j % 3 == 2 || j == TABLE_SIZE - 1 ? "\n" : "");
+        }
+        printf("};\n");
+    }
+
+    mpfr_clear(hi);
+    mpfr_clear(y);
+    mpfr_clear(x);
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s float|double\n", argv[0]);
+        return 1;
+    }
+    const char *type = argv[1];
+    mpfr_prec_t p = 0;
+    if (strcmp(type, "float") == 0)
+        p = 24;
+    else if (strcmp(type, "double") == 0)
+        p = 53;
+    if (p == 0) {
+        fprintf(stderr, "usage: %s float|double\n", argv[0]);
+        return 1;
+    }
+
+    printf("// 2^(j∕128) ≅ _exp_table_%s[j] + _exp_table_lo_%s[j]\n", type, type);
+    print_table(type, p);
+    return 0;
+}
@@ -0,0 +1,202 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Generate the reference file of test-reference.c (see reference.h),
+ * with MPFR, on all processors (harness.h):
+ *
+ *     ./gen-reference reference.bin
+ *
+ * The arguments depend only on TEST_SEED, not on the number of threads.
+ */
+
+#include <assert.h>
+#include <stddef.h> // size_t, NULL
+#include <stdint.h> // int32_t, int64_t
+#include <stdio.h> // fopen, fwrite
+#include <stdlib.h> // calloc
+#include <string.h> // memcpy
+
+#include <mpfr.h>
+
+#include "harness.h"
+#include "reference.h"
+
+/*
+ * x⋅2∕π needs about 1100 bits to be represented exactly, up to 2¹⁰²³
+ * (as in test-reduce.c), and so does the remainder r.
+ */
+
+static const mpfr_prec_t mp_precision = 2048;
+
+// The number of arguments of each magnitude.
+static const size_t n_per_magnitude = 1 << 16;
+
+// The size of the chunks (harness.h).
+static const size_t chunk_size = 1 << 12;
+
+static size_t
+chunks_per_magnitude(void)
+{
+    return (n_per_magnitude + chunk_size - 1) / chunk_size;
+}
+
+/*
+ * The MPFR variables of a thread: the argument, π∕2 and the quotient in
+ * high precision, and the results in the precision of the type.
+ */
+
+typedef struct {
+    mpfr_t x;
+    mpfr_t pi_2;
+    mpfr_t q;
+    mpfr_t y;
+} mp_local;
+
+typedef struct {
+    mpfr_prec_t precision; // of the type
+    reference_float *records_float;
+    reference_double *records_double;
+} gen_context;
+
+static void
+mp_local_init(const void *context, void *local)
+{
+    const gen_context *gen = context;
+    mp_local *mp = local;
+    mpfr_init2(mp->x, mp_precision);
+    mpfr_init2(mp->pi_2, mp_precision);
+    mpfr_init2(mp->q, mp_precision);
+    mpfr_init2(mp->y, gen->precision);
+    mpfr_const_pi(mp->pi_2, MPFR_RNDN);
+    mpfr_div_ui(mp->pi_2, mp->pi_2, 2, MPFR_RNDN);
+}
+
+static void
+mp_local_clear(void *local)
+{
+    mp_local *mp = local;
+    mpfr_clear(mp->y);
+    mpfr_clear(mp->q);
+    mpfr_clear(mp->pi_2);
+    mpfr_clear(mp->x);
+    mpfr_free_cache();
+}
+
+static void
+gen_float_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    (void) stats;
+    const gen_context *gen = context;
+    mp_local *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+    size_t j = chunk / chunks_per_magnitude();
+    size_t first = (chunk % chunks_per_magnitude()) * chunk_size;
+    for (size_t i = first; i < n_per_magnitude && i < first + chunk_size; i++) {
+        reference_float *record = &gen->records_float[j * n_per_magnitude + i];
+        float x = (harness_uniform(&g) - 0.5) * 2.0f * magnitudes_float[j];
+        mpfr_set_flt(mp->x, x, MPFR_RNDN);
+        record->x = x;
+        mpfr_sin(mp->y, mp->x, MPFR_RNDN);
+        record->sin = mpfr_get_flt(mp->y, MPFR_RNDN);
+        mpfr_cos(mp->y, mp->x, MPFR_RNDN);
+        record->cos = mpfr_get_flt(mp->y, MPFR_RNDN);
+        mpfr_fmod(mp->y, mp->x, mp->pi_2, MPFR_RNDN);
+        record->r = mpfr_get_flt(mp->y, MPFR_RNDN);
+        mpfr_div(mp->q, mp->x, mp->pi_2, MPFR_RNDN);
+        mpfr_trunc(mp->q, mp->q);
+        if (j >= N_CW_MAGNITUDES_FLOAT)
+            mpfr_fmod_ui(mp->q, mp->q, 4, MPFR_RNDN);
+        record->q = (int32_t) mpfr_get_si(mp->q, MPFR_RNDN);
+    }
+}
+
+static void
+gen_double_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    (void) stats;
+    const gen_context *gen = context;
+    mp_local *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+    size_t j = chunk / chunks_per_magnitude();
+    size_t first = (chunk % chunks_per_magnitude()) * chunk_size;
+    for (size_t i = first; i < n_per_magnitude && i < first + chunk_size; i++) {
+        reference_double *record = &gen->records_double[j * n_per_magnitude + i];
+        double x = (harness_uniform(&g) - 0.5) * 2.0 * magnitudes_double[j];
+        mpfr_set_d(mp->x, x, MPFR_RNDN);
+        record->x = x;
+        mpfr_sin(mp->y, mp->x, MPFR_RNDN);
+        record->sin = mpfr_get_d(mp->y, MPFR_RNDN);
+        mpfr_cos(mp->y, mp->x, MPFR_RNDN);
+        record->cos = mpfr_get_d(mp->y, MPFR_RNDN);
+        mpfr_fmod(mp->y, mp->x, mp->pi_2, MPFR_RNDN);
+        record->r = mpfr_get_d(mp->y, MPFR_RNDN);
+        mpfr_div(mp->q, mp->x, mp->pi_2, MPFR_RNDN);
+        mpfr_trunc(mp->q, mp->q);
+        if (j >= N_CW_MAGNITUDES_DOUBLE)
+            mpfr_fmod_ui(mp->q, mp->q, 4, MPFR_RNDN);
+        record->q = (int64_t) mpfr_get_si(mp->q, MPFR_RNDN);
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s file\n", argv[0]);
+        return 1;
+    }
+
+    reference_header header = {0};
+    memcpy(header.magic, REFERENCE_MAGIC, sizeof REFERENCE_MAGIC);
+    header.version = REFERENCE_VERSION;
+    header.record_size_float = sizeof (reference_float);
+    header.record_size_double = sizeof (reference_double);
+    header.n_per_magnitude = n_per_magnitude;
+    header.n_float = N_MAGNITUDES_FLOAT * n_per_magnitude;
+    header.n_double = N_MAGNITUDES_DOUBLE * n_per_magnitude;
+
+    reference_float *records_float = calloc(header.n_float, sizeof (reference_float));
+    reference_double *records_double = calloc(header.n_double, sizeof (reference_double));
+    assert(records_float != NULL && records_double != NULL);
+
+    // Correctly rounded: the results in the precision of the type
+    // (the exponent range of MPFR is wider, but these are not subnormal).
+    gen_context context_float = {24, records_float, NULL};
+    harness_job job_float = {
+        .context = &context_float,
+        .n_chunks = N_MAGNITUDES_FLOAT * chunks_per_magnitude(),
+        .local_size = sizeof (mp_local),
+        .init = &mp_local_init,
+        .clear = &mp_local_clear,
+        .chunk = &gen_float_chunk,
+    };
+    gen_context context_double = {53, NULL, records_double};
+    harness_job job_double = {
+        .context = &context_double,
+        .n_chunks = N_MAGNITUDES_DOUBLE * chunks_per_magnitude(),
+        .local_size = sizeof (mp_local),
+        .init = &mp_local_init,
+        .clear = &mp_local_clear,
+        .chunk = &gen_double_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job_float, &stats);
+    harness_run(&job_double, &stats);
+
+    FILE *f = fopen(argv[1], "wb");
+    if (f == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    int ok = fwrite(&header, sizeof header, 1, f) == 1
+        && fwrite(records_float, sizeof (reference_float), header.n_float, f) == header.n_float
+        && fwrite(records_double, sizeof (reference_double), header.n_double, f) == header.n_double;
+    if (fclose(f) != 0 || !ok) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    free(records_double);
+    free(records_float);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Generate the tables of exceptions of sincos-cr.h, for float: sweep every
+ * float x ≥ 2⁻¹², and evaluate y = _sincos_cr_kernel_float(x). If y is near
+ * the midpoint of two floats (_sincos_cr_near_midpoint_float), compare
+ * (float) y with sin(x) (or cos(x)) rounded by MPFR, and if they differ,
+ * x is an exception. Otherwise, (float) y is correctly rounded if the error
+ * of y is less than 32 ulp (of double), which is checked for every x
+ * against _sincos_cr_pi_2_double (correctly rounded).
+ * By symmetry, x < 0 needs no table, and x < 2⁻¹² rounds to x (sin) or 1.
+ *
+ * Usage: ./gen-sincos-cr-float
+ *
+ * It takes about a minute, and prints the maximum error of y on stderr.
+ */
+
+#include <math.h> // fabs, ldexp
+#include <stdint.h> // uint32_t
+#include <stdio.h>
+#include <stdlib.h> // exit
+#include <string.h> // memcpy
+
+#include <mpfr.h>
+
+#include "sincos-cr.h"
+
+#define MAX_EXCEPTIONS 4096
+
+typedef int (*mpfr_function_t)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+
+typedef struct {
+    const char *name;
+    mpfr_function_t mpfr_function;
+    size_t n;
+    float xs[MAX_EXCEPTIONS];
+    float ys[MAX_EXCEPTIONS];
+    size_t near; // the number of results near a midpoint
+    double max_error; // ulp
+} exceptions;
+
+static exceptions sin_exceptions = {"sin", &mpfr_sin, 0, {0}, {0}, 0, 0.0};
+static exceptions cos_exceptions = {"cos", &mpfr_cos, 0, {0}, {0}, 0, 0.0};
+
+static float
+bits_float(uint32_t u)
+{
+    float x;
+    memcpy(&x, &u, sizeof x);
+    return x;
+}
+
+static void
+check(exceptions *e, float x, double y, double z)
+{
+    double error = fabs(y - z) / ldexp(0x1.0p-52, ilogb(z));
+    if (error > e->max_error)
+        e->max_error = error;
+    if (error >= 32.0) {
+        fprintf(stderr, "%s(%a): error of %g ulp\n", e->name, x, error);
+        exit(1);
+    }
+    if (!_sincos_cr_near_midpoint_float(y))
+        return;
+    e->near++;
+    mpfr_t mx, my;
+    mpfr_init2(mx, 24);
+    mpfr_init2(my, 24);
+    mpfr_set_flt(mx, x, MPFR_RNDN);
+    (*e->mpfr_function)(my, mx, MPFR_RNDN);
+    float r = mpfr_get_flt(my, MPFR_RNDN);
+    mpfr_clear(mx);
+    mpfr_clear(my);
+    if ((float) y == r)
+        return;
+    if (e->n == MAX_EXCEPTIONS) {
+        fprintf(stderr, "%s: too many exceptions\n", e->name);
+        exit(1);
+    }
+    e->xs[e->n] = x;
+    e->ys[e->n] = r;
+    e->n++;
+}
+
+static void
+print_table(const exceptions *e)
+{
+    printf("// {x, %s(x)}, for the floats x > 0 at which (float) y is wrong\n", e->name);
+    printf("static const float _%s_cr_exceptions_float[%zu][2] = {\n", e->name, e->n);
+    for (size_t i = 0; i < e->n; i++)
+        printf("    {%af, %af},\n", (double) e->xs[i], (double) e->ys[i]);
+    printf("};\n");
+}
+
+int
+main(void)
+{
+    uint32_t first = 0x39800000; // 2⁻¹²
+    uint32_t last = 0x7f7fffff; // the largest float
+    for (uint32_t u = first; u <= last; u++) {
+        float x = bits_float(u);
+        tuple_double y = _sincos_cr_kernel_float(x);
+        tuple_double z = _sincos_cr_pi_2_double((double) x, 1, 1);
+        check(&sin_exceptions, x, y.a, z.a);
+        check(&cos_exceptions, x, y.b, z.b);
+    }
+    for (int i = 0; i < 2; i++) {
+        const exceptions *e = i == 0 ? &sin_exceptions : &cos_exceptions;
+        fprintf(stderr, "%s: maximum error %.2f ulp, %zu near a midpoint, %zu exceptions\n",
+            e->name, e->max_error, e->near, e->n);
+    }
+    print_table(&sin_exceptions);
+    print_table(&cos_exceptions);
+    return 0;
+}
@@ -0,0 +1,65 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Generate the constants of sincos-cr.h:
+ *
+ *     π∕2 ≅ P₀ + P₁ + P₂ + P₃ + P₄
+ *     1∕n! ≅ Fₙ + Fₗₙ + Fₗₗₙ    (triple-double), n = 0, 1, …, 38
+ *
+ * where each term is the rest rounded to nearest. They are printed in
+ * hexadecimal, so that they are read back exactly.
+ *
+ * Usage: ./gen-sincos-cr
+ */
+
+#include <stdio.h>
+
+#include <mpfr.h>
+
+static const mpfr_prec_t mp_precision = 512;
+
+#define N_PI_2 5
+#define N_FACTORIALS 39
+
+// Print y as n doubles, each the rest rounded to nearest.
+static void
+print_doubles(mpfr_t y, int n)
+{
+    mpfr_t hi;
+    mpfr_init2(hi, 53);
+    for (int i = 0; i < n; i++) {
+        mpfr_set(hi, y, MPFR_RNDN);
+        mpfr_sub(y, y, hi, MPFR_RNDN);
+        printf("%s%a", i == 0 ? "" : ", ", mpfr_get_d(hi, MPFR_RNDN));
+    }
+    mpfr_clear(hi);
+}
+
+int
+main(void)
+{
+    mpfr_t y;
+    mpfr_init2(y, mp_precision);
+
+    printf("// π∕2 ≅ Σ _sincos_cr_pi_2[i]\n");
+    printf("static const double _sincos_cr_pi_2[%i] = {\n    ", N_PI_2);
+    mpfr_const_pi(y, MPFR_RNDN);
+    mpfr_div_ui(y, y, 2, MPFR_RNDN);
+    print_doubles(y, N_PI_2);
+    printf(",\n};\n");
+    printf("\n");
+
+    printf("// 1∕n! ≅ _sincos_cr_inv_factorials[n]\n");
+    printf("static const triple_double _sincos_cr_inv_factorials[%i] = {\n", N_FACTORIALS);
+    for (int n = 0; n < N_FACTORIALS; n++) {
+        mpfr_fac_ui(y, (unsigned long) n, MPFR_RNDN);
+        mpfr_ui_div(y, 1, y, MPFR_RNDN);
+        printf("    {");
+        print_doubles(y, 3);
+        printf("}, // 1∕%i!\n", n);
+    }
+    printf("};\n");
+
+    mpfr_clear(y);
+    return 0;
+}
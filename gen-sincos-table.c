@@ -0,0 +1,93 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Generate the tables of sincos-table.h:
+ *
+ *     sin(j⋅π∕64) ≅ Sⱼ + Sₗⱼ
+ *     cos(j⋅π∕64) ≅ Cⱼ + Cₗⱼ
+ *
+ * for j = 0, 1, …, 32, where Sⱼ is sin(j⋅π∕64) rounded to nearest
+ * and Sₗⱼ is the rest rounded to nearest (double-double or float-float).
+ * cos(j⋅π∕64) = sin((32 - j)⋅π∕64), so that cos(π∕2) is exactly 0.
+ *
+ * Usage: ./gen-sincos-table float|double
+ */
+
+#include <stdio.h>
+#include <string.h> // strcmp
+
+#include <mpfr.h>
+
+static const mpfr_prec_t mp_precision = 256;
+
+#define TABLE_SIZE 33
+
+static void
+print_table(const char *name, const char *type, mpfr_prec_t p, int cos)
+{
+    mpfr_t pi, x, y, hi;
+    mpfr_init2(pi, mp_precision);
+    mpfr_init2(x, mp_precision);
+    mpfr_init2(y, mp_precision);
+    mpfr_init2(hi, p);
+    mpfr_const_pi(pi, MPFR_RNDN);
+
+    double his[TABLE_SIZE];
+    double los[TABLE_SIZE];
+    for (int j = 0; j < TABLE_SIZE; j++) {
+        mpfr_mul_ui(x, pi, cos ? TABLE_SIZE - 1 - j : j, MPFR_RNDN);
+        mpfr_div_ui(x, x, 64, MPFR_RNDN);
+        mpfr_sin(y, x, MPFR_RNDN);
+        mpfr_set(hi, y, MPFR_RNDN);
+        mpfr_sub(y, y, hi, MPFR_RNDN);
+        his[j] = mpfr_get_d(hi, MPFR_RNDN);
+        mpfr_set(hi, y, MPFR_RNDN);
+        los[j] = mpfr_get_d(hi, MPFR_RNDN);
+    }
+
+    for (int k = 0; k < 2; k++) {
+        const double *values = k == 0 ? his : los;
+        printf("static const %s _%s_table%s_%s[%i] = {\n",
+            type, name, k == 0 ? "" : "_lo", type, TABLE_SIZE);
+        for (int j = 0; j < TABLE_SIZE; j++) {
+            printf(j % 3 == 0 ? "   " : "");
+            if (p == 24)
+                printf(" %.9ef,", values[j]);
+            else
+                printf(" %.17e,", values[j]);
+            printf(j % 3 == 2 || j == TABLE_SIZE - 1 ? "\n" : "");
+        }
+        printf("};\n");
+    }
+
+    mpfr_clear(hi);
+    mpfr_clear(y);
+    mpfr_clear(x);
+    mpfr_clear(pi);
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s float|double\n", argv[0]);
+        return 1;
+    }
+    const char *type = argv[1];
+    mpfr_prec_t p = 0;
+    if (strcmp(type, "float") == 0)
+        p = 24;
+    else if (strcmp(type, "double") == 0)
+        p = 53;
+    if (p == 0) {
+        fprintf(stderr, "usage: %s float|double\n", argv[0]);
+        return 1;
+    }
+
+    printf("// sin(j⋅π∕64) ≅ _sin_table_%s[j] + _sin_table_lo_%s[j]\n", type, type);
+    print_table("sin", type, p, 0);
+    printf("\n");
+    printf("// cos(j⋅π∕64) ≅ _cos_table_%s[j] + _cos_table_lo_%s[j]\n", type, type);
+    print_table("cos", type, p, 1);
+    return 0;
+}
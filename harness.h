@@ -0,0 +1,292 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#pragma once
+
+/*
+ * A parallel engine for the accuracy tests (test-reduce.c, test-sincos.c,
+ * test-tan.c, test-exp.c), and the fixture that they share: the MPFR
+ * variables of a thread, and the printing of the error statistics.
+ *
+ * The samples of a test are cut into chunks. The threads take the chunks
+ * in turn, and each chunk draws its arguments from its own generator,
+ * seeded by the chunk number, so that the samples, and the results, do
+ * not depend on the number of threads or on the order of the chunks.
+ * Each thread keeps its MPFR variables (its local state) for all of its
+ * chunks, and its own error statistics, merged at the end.
+ *
+ * The environment variable TEST_THREADS sets the number of threads
+ * (by default, one per processor), and TEST_SEED the seed.
+ */
+
+#include <assert.h>
+#include <pthread.h> // pthread_create, pthread_join
+#include <stddef.h> // size_t, NULL
+#include <stdint.h> // uint64_t
+#include <stdio.h> // printf
+#include <stdlib.h> // calloc, getenv, strtoull
+#include <unistd.h> // sysconf
+
+/*
+ * SplitMix64.
+ *
+ * Guy L. Steele, Doug Lea, and Christine H. Flood. 2014. Fast splittable
+ * pseudorandom number generators. SIGPLAN Not. 49, 10 (October 2014),
+ * 453–472. https://doi.org/10.1145/2714064.2660195
+ */
+
+typedef struct {
+    uint64_t state;
+} harness_random;
+
+static inline uint64_t
+harness_next(harness_random *g)
+{
+    uint64_t z = (g->state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+// Uniform in [0, 1), like drand48.
+static inline double
+harness_uniform(harness_random *g)
+{
+    return (double) (harness_next(g) >> 11) * 0x1.0p-53;
+}
+
+static inline uint64_t
+harness_seed(void)
+{
+    const char *seed = getenv("TEST_SEED");
+    if (seed != NULL && seed[0] != '\0')
+        return strtoull(seed, NULL, 0);
+    return 1;
+}
+
+static inline harness_random
+harness_chunk_random(size_t chunk)
+{
+    harness_random g = {harness_seed()};
+    g.state = harness_next(&g) ^ (uint64_t) chunk;
+    (void) harness_next(&g);
+    return g;
+}
+
+/*
+ * The error statistics: the distribution of the errors in ulp, and the
+ * maximum absolute and relative errors by magnitude of the argument.
+ */
+
+#define HARNESS_MAX_MAGNITUDES 24
+
+typedef struct {
+    size_t error_dist[4];
+    double max_abs_error[HARNESS_MAX_MAGNITUDES];
+    double max_rel_error[HARNESS_MAX_MAGNITUDES];
+} harness_stats;
+
+static inline void
+harness_count(harness_stats *stats, size_t magnitude, double abs_error, double rel_error)
+{
+    assert(magnitude < HARNESS_MAX_MAGNITUDES);
+    if (rel_error >= 3.0)
+        stats->error_dist[3]++;
+    else if (rel_error >= 2.0)
+        stats->error_dist[2]++;
+    else if (rel_error >= 1.0)
+        stats->error_dist[1]++;
+    else
+        stats->error_dist[0]++;
+    if (abs_error > stats->max_abs_error[magnitude])
+        stats->max_abs_error[magnitude] = abs_error;
+    if (rel_error > stats->max_rel_error[magnitude])
+        stats->max_rel_error[magnitude] = rel_error;
+}
+
+static inline void
+harness_merge(harness_stats *stats, const harness_stats *other)
+{
+    for (size_t i = 0; i < 4; i++)
+        stats->error_dist[i] += other->error_dist[i];
+    for (size_t j = 0; j < HARNESS_MAX_MAGNITUDES; j++) {
+        if (other->max_abs_error[j] > stats->max_abs_error[j])
+            stats->max_abs_error[j] = other->max_abs_error[j];
+        if (other->max_rel_error[j] > stats->max_rel_error[j])
+            stats->max_rel_error[j] = other->max_rel_error[j];
+    }
+}
+
+static inline size_t
+harness_total(const harness_stats *stats)
+{
+    return stats->error_dist[0] + stats->error_dist[1] + stats->error_dist[2] + stats->error_dist[3];
+}
+
+static inline void
+harness_print_distribution(const harness_stats *stats, int indent)
+{
+    const size_t *error_dist = stats->error_dist;
+    size_t m = harness_total(stats);
+    printf("%*serror distribution:\n", indent, "");
+    printf("%*s 0 ulp %zu (%.2f%%)\n", indent, "", error_dist[0], (double) error_dist[0] / m * 100.0);
+    printf("%*s 1 ulp %zu (%.2f%%)\n", indent, "", error_dist[1], (double) error_dist[1] / m * 100.0);
+    printf("%*s 2 ulp %zu (%.2f%%)\n", indent, "", error_dist[2], (double) error_dist[2] / m * 100.0);
+    printf("%*s≥3 ulp %zu (%.2f%%)\n", indent, "", error_dist[3], (double) error_dist[3] / m * 100.0);
+    printf("\n");
+}
+
+/*
+ * Print the distribution, and the maximum error in ulp by magnitude,
+ * with the given number of digits.
+ */
+
+static inline void
+harness_print_stats(const harness_stats *stats, const double *magnitudes, size_t n_magnitudes, int digits, int indent)
+{
+    harness_print_distribution(stats, indent);
+    printf("%*smaximum error (ulp) by magnitude:\n", indent, "");
+    for (size_t j = 0; j < n_magnitudes; j++)
+        printf("%*s%14a %14.*f\n", indent, "", magnitudes[j], digits, stats->max_rel_error[j]);
+    printf("\n");
+}
+
+/*
+ * The number of chunks of chunk_size samples for n samples, that is, of
+ * each magnitude (or interval) of a test.
+ */
+
+static inline size_t
+harness_chunks(size_t n, size_t chunk_size)
+{
+    return (n + chunk_size - 1) / chunk_size;
+}
+
+/*
+ * A test: n_chunks chunks, run by chunk(context, local, chunk, stats),
+ * where local is the state of the thread, of local_size bytes, set up by
+ * init(context, local) and torn down by clear(local).
+ */
+
+typedef struct {
+    const void *context;
+    size_t n_chunks;
+    size_t local_size;
+    void (*init)(const void *context, void *local);
+    void (*clear)(void *local);
+    void (*chunk)(const void *context, void *local, size_t chunk, harness_stats *stats);
+} harness_job;
+
+typedef struct {
+    const harness_job *job;
+    size_t *next;
+    harness_stats stats;
+} harness_thread;
+
+static void *
+harness_worker(void *argument)
+{
+    harness_thread *thread = argument;
+    const harness_job *job = thread->job;
+    void *local = calloc(1, job->local_size > 0 ? job->local_size : 1);
+    assert(local != NULL);
+    if (job->init != NULL)
+        (*job->init)(job->context, local);
+    for (;;) {
+        size_t chunk = __atomic_fetch_add(thread->next, 1, __ATOMIC_RELAXED);
+        if (chunk >= job->n_chunks)
+            break;
+        (*job->chunk)(job->context, local, chunk, &thread->stats);
+    }
+    if (job->clear != NULL)
+        (*job->clear)(local);
+    free(local);
+    return NULL;
+}
+
+static inline size_t
+harness_threads(void)
+{
+    const char *threads = getenv("TEST_THREADS");
+    long int k = 0;
+    if (threads != NULL && threads[0] != '\0')
+        k = strtol(threads, NULL, 10);
+    else
+        k = sysconf(_SC_NPROCESSORS_ONLN);
+    if (k < 1)
+        k = 1;
+    if (k > 256)
+        k = 256;
+    return (size_t) k;
+}
+
+static inline void
+harness_run(const harness_job *job, harness_stats *stats)
+{
+    size_t k = harness_threads();
+    if (k > job->n_chunks)
+        k = job->n_chunks > 0 ? job->n_chunks : 1;
+    harness_thread *threads = calloc(k, sizeof (harness_thread));
+    pthread_t *ids = calloc(k, sizeof (pthread_t));
+    assert(threads != NULL && ids != NULL);
+    size_t next = 0;
+    for (size_t i = 0; i < k; i++) {
+        threads[i].job = job;
+        threads[i].next = &next;
+        int error = pthread_create(&ids[i], NULL, &harness_worker, &threads[i]);
+        assert(error == 0);
+        (void) error;
+    }
+    for (size_t i = 0; i < k; i++) {
+        pthread_join(ids[i], NULL);
+        harness_merge(stats, &threads[i].stats);
+    }
+    free(ids);
+    free(threads);
+}
+
+/*
+ * The MPFR variables of a thread, for the tests that include mpfr.h
+ * (before harness.h): the argument, the expected result, and the error,
+ * of HARNESS_MP_PRECISION bits, as local state of a harness_job:
+ *
+ *     .local_size = sizeof (harness_mp),
+ *     .init = &harness_mp_init,
+ *     .clear = &harness_mp_clear,
+ */
+
+#if defined(MPFR_VERSION_MAJOR)
+
+#define HARNESS_MP_PRECISION 128
+
+typedef struct {
+    mpfr_t x;
+    mpfr_t result;
+    mpfr_t error;
+} harness_mp;
+
+static inline void
+harness_mp_init2(harness_mp *mp, mpfr_prec_t precision)
+{
+    mpfr_init2(mp->x, precision);
+    mpfr_init2(mp->result, precision);
+    mpfr_init2(mp->error, precision);
+}
+
+static inline void
+harness_mp_init(const void *context, void *local)
+{
+    (void) context;
+    harness_mp_init2(local, HARNESS_MP_PRECISION);
+}
+
+static inline void
+harness_mp_clear(void *local)
+{
+    harness_mp *mp = local;
+    mpfr_clear(mp->error);
+    mpfr_clear(mp->result);
+    mpfr_clear(mp->x);
+    mpfr_free_cache();
+}
+
+#endif
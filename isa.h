@@ -0,0 +1,63 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#pragma once
+
+/*
+ * Runtime dispatch on the microarchitecture levels of the x86-64 psABI:
+ *
+ *  - x86-64-v2: SSE4.2, POPCNT;
+ *  - x86-64-v3: AVX2, FMA, BMI2;
+ *  - x86-64-v4: AVX-512 (F, BW, CD, DQ, VL).
+ *
+ * sincos.c, exp.c and reduce.c are compiled once per level, with
+ * -march=x86-64-vN -DISA=N, and name their functions with ISA_NAME, as
+ * _sin_float_vN, etc. sincos-dispatch.c, exp-dispatch.c and
+ * reduce-dispatch.c define the public functions, which call the build
+ * chosen by isa_level at load time.
+ */
+
+#if defined(ISA)
+#define ISA_NAME(f) _ISA_NAME(f, ISA)
+#define _ISA_NAME(f, level) __ISA_NAME(f, level)
+#define __ISA_NAME(f, level) f##_v##level
+#else
+#define ISA_NAME(f) f
+#endif
+
+// The levels chosen by sincos-dispatch.c and reduce-dispatch.c.
+int _sincos_isa_level(void);
+int _reduce_isa_level(void);
+
+/*
+ * Return the highest level (2, 3 or 4) this processor supports.
+ * Below x86-64-v2, return 2 anyway: that is the lowest level we build.
+ * The environment variable ISA_LEVEL lowers it, for testing.
+ */
+
+#if defined(__x86_64__)
+
+#include <stdlib.h> // atoi, getenv
+
+static inline int
+isa_level(void)
+{
+    __builtin_cpu_init();
+    int level = 2;
+    if (__builtin_cpu_supports("avx2")
+        && __builtin_cpu_supports("fma")
+        && __builtin_cpu_supports("bmi2"))
+        level = 3;
+    if (level == 3
+        && __builtin_cpu_supports("avx512f")
+        && __builtin_cpu_supports("avx512bw")
+        && __builtin_cpu_supports("avx512cd")
+        && __builtin_cpu_supports("avx512dq")
+        && __builtin_cpu_supports("avx512vl"))
+        level = 4;
+    const char *env = getenv("ISA_LEVEL");
+    if (env != NULL && atoi(env) >= 2 && atoi(env) < level)
+        level = atoi(env);
+    return level;
+}
+
+#endif
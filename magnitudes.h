@@ -0,0 +1,29 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#pragma once
+
+/*
+ * The magnitudes of the tests, the benchmarks and the reference file:
+ * arguments x in [-m, m], for each magnitude m, up to the thresholds of
+ * Payne-Hanek (ph.h), then beyond, up to the largest finite values.
+ */
+
+static const float magnitudes_float[] = {
+    0x1.0p+00f, 0x1.0p+01f, 0x1.0p+02f, 0x1.0p+04f, 0x1.0p+08f, 0x1.0p+16f,
+    0x1.0p+20f, 0x1.0p+23f, 0x1.0p+24f, 0x1.0p+32f, 0x1.0p+48f, 0x1.0p+64f,
+    0x1.0p+96f, 0x1.0p+127f,
+};
+
+static const double magnitudes_double[] = {
+    0x1.0p+00, 0x1.0p+01, 0x1.0p+02, 0x1.0p+04, 0x1.0p+08, 0x1.0p+16,
+    0x1.0p+24, 0x1.0p+32, 0x1.0p+40, 0x1.0p+48, 0x1.0p+52, 0x1.0p+53,
+    0x1.0p+64, 0x1.0p+128, 0x1.0p+256, 0x1.0p+512, 0x1.0p+768, 0x1.0p+1023,
+};
+
+#define N_MAGNITUDES_FLOAT (sizeof magnitudes_float / sizeof magnitudes_float[0])
+#define N_MAGNITUDES_DOUBLE (sizeof magnitudes_double / sizeof magnitudes_double[0])
+
+// The first magnitudes, up to the thresholds of Payne-Hanek, 2²³ and 2⁵²,
+// where the quotient of Cody-Waite is exact (cw.h).
+#define N_CW_MAGNITUDES_FLOAT 8
+#define N_CW_MAGNITUDES_DOUBLE 11
@@ -0,0 +1,227 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/* Compile with -DNDEBUG, except for debugging. */
+
+#pragma once
+
+#include <assert.h>
+#include <math.h> // frexp, isfinite, ldexp
+#include <stdint.h> // int32_t, int64_t, uint32_t, uint64_t
+
+#include "arithmetic.h" // add, madd, mul
+#include "constants.h" // pi_2, etc.
+#include "types.h" // rem_result_float, rem_result_double
+
+/*
+ * Variant of the Payne-Hanek argument reduction algorithm.
+ *
+ * M. Payne and R. Hanek. Radian reduction for trigonometric functions.
+ * SIGNUM Newsletter 18, 1 (January 1983), 19-24.
+ *
+ * The functions ph_rem_pi_2_float and ph_rem_pi_2_double are declared
+ * in reduce.h.
+ */
+
+/*
+ * Above these magnitudes, the Cody-Waite quotient is no longer exact
+ * (see test-reduce-cw.txt), so use Payne-Hanek instead.
+ */
+
+#define PH_THRESHOLD_FLOAT  (0x1.0p23f)
+#define PH_THRESHOLD_DOUBLE (0x1.0p52)
+
+/*
+ * 2∕π = 0.a2f9836e 4e441529 fc2757d1 … (1280 bits)
+ *
+ * The product of a double (at most 2¹⁰²⁴) with 2∕π needs the bits
+ * at positions 2⁹⁷⁰ down to 2⁻¹⁷⁰ of x⋅2∕π, that is, at most
+ * 38 words of 2∕π (40 for _ph_fraction7_double).
+ */
+
+static const uint32_t ph_inv_pi_2_bits[40] = {
+    0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599, 0x3c439041,
+    0xfe5163ab, 0xdebbc561, 0xb7246e3a, 0x424dd2e0, 0x06492eea, 0x09d1921c,
+    0xfe1deb1c, 0xb129a73e, 0xe88235f5, 0x2ebb4484, 0xe99c7026, 0xb45f7e41,
+    0x3991d639, 0x835339f4, 0x9c845f8b, 0xbdf9283b, 0x1ff897ff, 0xde05980f,
+    0xef2f118b, 0x5a0a6d1f, 0x6d367ecf, 0x27cb09b7, 0x4f463f66, 0x9e5fea2d,
+    0x7527bac7, 0xebe5f17b, 0x3d0739f7, 0x8a5292ea, 0x6bfb5fb1, 0x1f8d5d08,
+    0x56033046, 0xfc7b6bab, 0xf0cfbc20, 0x9af4361d,
+};
+
+/*
+ * Return the 32 bits [b, b + 32) of the integer P,
+ * stored as n 32-bit words, least significant first.
+ */
+
+static inline uint32_t
+__attribute__((always_inline))
+_ph_bits(const uint32_t P[], int n, int b)
+{
+    if (b <= -32)
+        return 0;
+    if (b < 0)
+        return P[0] << -b;
+    int i = b / 32;
+    int o = b % 32;
+    uint64_t w = P[i];
+    if (i + 1 < n)
+        w |= (uint64_t) P[i + 1] << 32;
+    return (uint32_t) (w >> o);
+}
+
+/*
+ * Compute x⋅2∕π for 1 ≤ x < ∞, using only the words of 2∕π
+ * that contribute to the result modulo 4.
+ * Returns the integer part modulo 4, and stores the fraction
+ * as five 32-bit words f, most significant first,
+ * such that x⋅2∕π = 4⋅k + z + Σ fᵢ⋅2⁻³²⁽ⁱ⁺¹⁾ + ε, 0 ≤ ε < 2⁻¹⁵⁹.
+ *
+ * With x = m⋅2ˢ and the first word read at k = (s - 2)∕32, the words of
+ * 2∕π after the last one read add less than 2⁵³⁺ˢ⁻³²⁽ᵏ⁺⁸⁾ ≤ 2⁻¹⁷⁰ to
+ * x⋅2∕π: hence eight words, as with six it would be up to 2⁻¹⁰⁶, too
+ * much near the multiples of π∕2, where the remainder is as small as
+ * 2⁻⁶¹. The rest of ε is the truncation of the fraction to five words.
+ */
+
+static inline int
+_ph_fraction_double(double x, uint32_t f[5])
+{
+    assert(x >= 1.0 && isfinite(x));
+
+    // x = m⋅2ˢ, m < 2⁵³
+    int e = 0;
+    uint64_t m = (uint64_t) ldexp(frexp(x, &e), 53);
+    int s = e - 53;
+
+    // Skip the words of 2∕π whose products with x are multiples of 4.
+    int k = s > 2 ? (s - 2) / 32 : 0;
+    const uint32_t *w = &ph_inv_pi_2_bits[k];
+
+    // P = m⋅(w₀…w₇), exactly
+    uint32_t P[10] = {0};
+    uint64_t ml = m & 0xffffffff;
+    uint64_t mh = m >> 32;
+    uint64_t carry = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t t = ml * w[7 - i] + carry;
+        P[i] = (uint32_t) t;
+        carry = t >> 32;
+    }
+    P[8] = (uint32_t) carry;
+    carry = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t t = mh * w[7 - i] + P[i + 1] + carry;
+        P[i + 1] = (uint32_t) t;
+        carry = t >> 32;
+    }
+    P[9] = (uint32_t) carry;
+
+    // x⋅2∕π ≅ P⋅2⁻ᴱ
+    int E = 32 * (k + 8) - s;
+    for (int i = 0; i < 5; i++)
+        f[i] = _ph_bits(P, 10, E - 32 * (i + 1));
+    return (int) (_ph_bits(P, 10, E) & 3);
+}
+
+/*
+ * Same as _ph_fraction_double, with ten words of 2∕π rather than eight,
+ * for the triple-double reduction of sincos-cr.h: stores seven words of
+ * the fraction, such that x⋅2∕π = 4⋅k + z + Σ fᵢ⋅2⁻³²⁽ⁱ⁺¹⁾ + ε, |ε| < 2⁻²²³.
+ * The last word of 2∕π read is at most ph_inv_pi_2_bits[39].
+ */
+
+static inline int
+_ph_fraction7_double(double x, uint32_t f[7])
+{
+    assert(x >= 1.0 && isfinite(x));
+
+    int e = 0;
+    uint64_t m = (uint64_t) ldexp(frexp(x, &e), 53);
+    int s = e - 53;
+
+    int k = s > 2 ? (s - 2) / 32 : 0;
+    const uint32_t *w = &ph_inv_pi_2_bits[k];
+
+    // P = m⋅(w₀…w₉), exactly
+    uint32_t P[12] = {0};
+    uint64_t ml = m & 0xffffffff;
+    uint64_t mh = m >> 32;
+    uint64_t carry = 0;
+    for (int i = 0; i < 10; i++) {
+        uint64_t t = ml * w[9 - i] + carry;
+        P[i] = (uint32_t) t;
+        carry = t >> 32;
+    }
+    P[10] = (uint32_t) carry;
+    carry = 0;
+    for (int i = 0; i < 10; i++) {
+        uint64_t t = mh * w[9 - i] + P[i + 1] + carry;
+        P[i + 1] = (uint32_t) t;
+        carry = t >> 32;
+    }
+    P[11] = (uint32_t) carry;
+
+    int E = 32 * (k + 10) - s;
+    for (int i = 0; i < 7; i++)
+        f[i] = _ph_bits(P, 12, E - 32 * (i + 1));
+    return (int) (_ph_bits(P, 12, E) & 3);
+}
+
+/*
+ * Return the quotient z modulo 4 and remainder (v₁+v₂) of x∕(π∕2)
+ * as {z, v₁, v₂}, such that x = (4⋅k + z)⋅π∕2 + v₁+v₂ and
+ * 0 ≤ |v₁+v₂| < π∕2, for all |x| ≥ 1.
+ * If x < 0, then z ≤ 0 and v₁+v₂ ≤ 0.
+ */
+
+static inline rem_result_double
+_ph_rem_pi_2_double(double x)
+{
+    if (!isfinite(x))
+        return (rem_result_double) {0, x - x, 0.0};
+    double sign = 1.0;
+    if (x < 0.0) {
+        x = -x;
+        sign = -1.0;
+    }
+
+    uint32_t f[5];
+    int z = _ph_fraction_double(x, f);
+
+    // fraction = Σ fᵢ⋅2⁻³²⁽ⁱ⁺¹⁾
+    double hi = 0.0;
+    double lo = 0.0;
+    double scale = 0x1.0p-32;
+    for (int i = 0; i < 5; i++) {
+        tuple_double s = add(hi, (double) f[i] * scale);
+        hi = s.a;
+        lo += s.b;
+        scale *= 0x1.0p-32;
+    }
+    tuple_double t = add(hi, lo);
+    hi = t.a;
+    lo = t.b;
+
+    // r = fraction⋅π∕2
+    tuple_double p = mul(hi, pi_2_hi(double));
+    double e = p.b + madd(hi, pi_2_lo(double), lo * pi_2_hi(double));
+    tuple_double r = add(p.a, e);
+
+    int64_t q = sign < 0.0 ? -z : z;
+    return (rem_result_double) {q, sign * r.a, sign * r.b};
+}
+
+static inline rem_result_float
+_ph_rem_pi_2_float(float x)
+{
+    rem_result_double result = _ph_rem_pi_2_double((double) x);
+    float v1 = (float) result.v1;
+    float v2 = (float) ((result.v1 - (double) v1) + result.v2);
+    return (rem_result_float) {(int32_t) result.z, v1, v2};
+}
+
+#define _ph_rem_pi_2(x) \
+    _Generic((x), \
+        float: _ph_rem_pi_2_float, \
+        double: _ph_rem_pi_2_double \
+    )(x)
@@ -2,10 +2,10 @@
 
 #pragma once
 
-#include <math.h> // fma
+#include <assert.h>
 #include <stddef.h> // size_t
 
-#include "arithmetic.h" // add, mul
+#include "arithmetic.h" // add, madd, mul
 #include "types.h" // tuple_double, tuple_float
 
 static inline float
@@ -16,7 +16,19 @@ eval_polynomial_float1(const float as[], size_t n, float x)
     float r = as[n - 1];
     #pragma unroll
     for (size_t i = 1; i < n; i++)
-        r = fmaf(r, x, as[n - 1 - i]);
+        r = madd(r, x, as[n - 1 - i]);
+    return r;
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial_double1(const double as[], size_t n, double x)
+{
+    double r = as[n - 1];
+    #pragma unroll
+    for (size_t i = 1; i < n; i++)
+        r = madd(r, x, as[n - 1 - i]);
     return r;
 }
 
@@ -50,7 +62,7 @@ eval_polynomial_float(const float as[], size_t n, float x)
         s = add(r, as[n - 1 - i]);
         r = s.a;
         se = s.b;
-        e = fmaf(e, x, pe + se);
+        e = madd(e, x, pe + se);
     }
     return r + e;
 }
@@ -75,7 +87,7 @@ eval_polynomial_double(const double as[], size_t n, double x)
         s = add(r, as[n - 1 - i]);
         r = s.a;
         se = s.b;
-        e = fma(e, x, pe + se);
+        e = madd(e, x, pe + se);
     }
     return r + e;
 }
@@ -85,3 +97,233 @@ eval_polynomial_double(const double as[], size_t n, double x)
         float: eval_polynomial_float, \
         double: eval_polynomial_double \
     )(as, n, x)
+
+/*
+ * Evaluate two polynomials a and b of the same degree at the same x,
+ * and return {a(x), b(x)}.
+ * The two Horner chains are independent, so interleaving them lets
+ * the processor overlap their latencies. The results are the same as
+ * those of two separate evaluations.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial2_float1(const float as[], const float bs[], size_t n, float x)
+{
+    float ra = as[n - 1];
+    float rb = bs[n - 1];
+    #pragma unroll
+    for (size_t i = 1; i < n; i++) {
+        ra = madd(ra, x, as[n - 1 - i]);
+        rb = madd(rb, x, bs[n - 1 - i]);
+    }
+    return (tuple_float) {ra, rb};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial2_double1(const double as[], const double bs[], size_t n, double x)
+{
+    double ra = as[n - 1];
+    double rb = bs[n - 1];
+    #pragma unroll
+    for (size_t i = 1; i < n; i++) {
+        ra = madd(ra, x, as[n - 1 - i]);
+        rb = madd(rb, x, bs[n - 1 - i]);
+    }
+    return (tuple_double) {ra, rb};
+}
+
+/*
+ * Same as eval_polynomial (compensated Horner), for two polynomials.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial2_float(const float as[], const float bs[], size_t n, float x)
+{
+    float ra = as[n - 1];
+    float rb = bs[n - 1];
+    float ea = 0.0f;
+    float eb = 0.0f;
+    #pragma unroll
+    for (size_t i = 1; i < n; i++) {
+        tuple_float pa = mul(ra, x);
+        tuple_float pb = mul(rb, x);
+        tuple_float sa = add(pa.a, as[n - 1 - i]);
+        tuple_float sb = add(pb.a, bs[n - 1 - i]);
+        ra = sa.a;
+        rb = sb.a;
+        ea = madd(ea, x, pa.b + sa.b);
+        eb = madd(eb, x, pb.b + sb.b);
+    }
+    return (tuple_float) {ra + ea, rb + eb};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial2_double(const double as[], const double bs[], size_t n, double x)
+{
+    double ra = as[n - 1];
+    double rb = bs[n - 1];
+    double ea = 0.0;
+    double eb = 0.0;
+    #pragma unroll
+    for (size_t i = 1; i < n; i++) {
+        tuple_double pa = mul(ra, x);
+        tuple_double pb = mul(rb, x);
+        tuple_double sa = add(pa.a, as[n - 1 - i]);
+        tuple_double sb = add(pb.a, bs[n - 1 - i]);
+        ra = sa.a;
+        rb = sb.a;
+        ea = madd(ea, x, pa.b + sa.b);
+        eb = madd(eb, x, pb.b + sb.b);
+    }
+    return (tuple_double) {ra + ea, rb + eb};
+}
+
+#define eval_polynomial2(as, bs, n, x) \
+    _Generic((as)[0], \
+        float: eval_polynomial2_float, \
+        double: eval_polynomial2_double \
+    )(as, bs, n, x)
+
+/*
+ * Estrin's scheme: evaluate the pairs aᵢ + aᵢ₊₁⋅x, then the pairs of
+ * pairs with x², and so on, with x⁴, x⁸, …
+ * The depth of the evaluation is about log₂(n) rather than n,
+ * so the latency is lower than Horner's scheme, for more operations.
+ * The loops have constant bounds so that they are unrolled completely
+ * (clang also understands #pragma GCC unroll).
+ */
+
+#define ESTRIN_LEVELS 5
+#define ESTRIN_MAX_N (1 << ESTRIN_LEVELS)
+
+static inline float
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial_estrin_float1(const float as[], size_t n, float x)
+{
+    assert(n <= ESTRIN_MAX_N);
+    float c[ESTRIN_MAX_N];
+    #pragma GCC unroll 32
+    for (size_t i = 0; i < n; i++)
+        c[i] = as[i];
+    float y = x; // x, x², x⁴, …
+    #pragma GCC unroll 32
+    for (size_t k = 0; k < ESTRIN_LEVELS; k++) {
+        size_t h = (size_t) 1 << k;
+        #pragma GCC unroll 32
+        for (size_t i = 0; i + h < n; i += 2 * h)
+            c[i] = madd(c[i + h], y, c[i]);
+        y = y * y;
+    }
+    return c[0];
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial_estrin_double1(const double as[], size_t n, double x)
+{
+    assert(n <= ESTRIN_MAX_N);
+    double c[ESTRIN_MAX_N];
+    #pragma GCC unroll 32
+    for (size_t i = 0; i < n; i++)
+        c[i] = as[i];
+    double y = x; // x, x², x⁴, …
+    #pragma GCC unroll 32
+    for (size_t k = 0; k < ESTRIN_LEVELS; k++) {
+        size_t h = (size_t) 1 << k;
+        #pragma GCC unroll 32
+        for (size_t i = 0; i + h < n; i += 2 * h)
+            c[i] = madd(c[i + h], y, c[i]);
+        y = y * y;
+    }
+    return c[0];
+}
+
+/*
+ * Compensated Estrin's scheme: as in eval_polynomial, keep the errors
+ * of every product and sum (mul, add), and keep the powers of x as
+ * unevaluated sums y + yₑ. The errors are propagated to first order:
+ * (cᵢ + eᵢ) + (cᵢ₊ₕ + eᵢ₊ₕ)⋅(y + yₑ)
+ *     ≅ cᵢ + cᵢ₊ₕ⋅y + (eᵢ + eᵢ₊ₕ⋅y + cᵢ₊ₕ⋅yₑ)
+ */
+
+static inline float
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial_estrin_float(const float as[], size_t n, float x)
+{
+    assert(n <= ESTRIN_MAX_N);
+    float c[ESTRIN_MAX_N];
+    float e[ESTRIN_MAX_N];
+    #pragma GCC unroll 32
+    for (size_t i = 0; i < n; i++) {
+        c[i] = as[i];
+        e[i] = 0.0f;
+    }
+    float y = x;
+    float ye = 0.0f;
+    #pragma GCC unroll 32
+    for (size_t k = 0; k < ESTRIN_LEVELS; k++) {
+        size_t h = (size_t) 1 << k;
+        #pragma GCC unroll 32
+        for (size_t i = 0; i + h < n; i += 2 * h) {
+            tuple_float p = mul(c[i + h], y);
+            tuple_float s = add(p.a, c[i]);
+            float pe = madd(c[i + h], ye, p.b + s.b);
+            e[i] = madd(e[i + h], y, e[i] + pe);
+            c[i] = s.a;
+        }
+        tuple_float yy = mul(y, y);
+        ye = madd(2.0f * y, ye, yy.b);
+        y = yy.a;
+    }
+    return c[0] + e[0];
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+eval_polynomial_estrin_double(const double as[], size_t n, double x)
+{
+    assert(n <= ESTRIN_MAX_N);
+    double c[ESTRIN_MAX_N];
+    double e[ESTRIN_MAX_N];
+    #pragma GCC unroll 32
+    for (size_t i = 0; i < n; i++) {
+        c[i] = as[i];
+        e[i] = 0.0;
+    }
+    double y = x;
+    double ye = 0.0;
+    #pragma GCC unroll 32
+    for (size_t k = 0; k < ESTRIN_LEVELS; k++) {
+        size_t h = (size_t) 1 << k;
+        #pragma GCC unroll 32
+        for (size_t i = 0; i + h < n; i += 2 * h) {
+            tuple_double p = mul(c[i + h], y);
+            tuple_double s = add(p.a, c[i]);
+            double pe = madd(c[i + h], ye, p.b + s.b);
+            e[i] = madd(e[i + h], y, e[i] + pe);
+            c[i] = s.a;
+        }
+        tuple_double yy = mul(y, y);
+        ye = madd(2.0 * y, ye, yy.b);
+        y = yy.a;
+    }
+    return c[0] + e[0];
+}
+
+#define eval_polynomial_estrin(as, n, x) \
+    _Generic((as)[0], \
+        float: eval_polynomial_estrin_float, \
+        double: eval_polynomial_estrin_double \
+    )(as, n, x)
@@ -0,0 +1,367 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * A shim to use this library in place of libm, in a program as it is:
+ *
+ *     make DEBUG=0 preload.so
+ *     LD_PRELOAD=./preload.so ./program
+ *
+ * It defines sin, cos, sincos, sinf, cosf and sincosf with the functions
+ * of sincos.h. With the environment variable FUNLIBM_STATS set to a file
+ * name (or to "-" for stderr), it also counts, for each function, the
+ * calls by reduction path and by magnitude of the argument, the latency
+ * in cycles, and the latency of the libm function for one call in 64,
+ * and writes them to that file at exit.
+ */
+
+#define _GNU_SOURCE // RTLD_NEXT, sincos
+
+#include <dlfcn.h> // dlsym, RTLD_NEXT
+#include <math.h> // frexp, isfinite
+#include <stdint.h> // uint64_t
+#include <stdio.h> // fopen, fprintf
+#include <stdlib.h> // getenv
+#include <string.h> // strcmp
+#include <time.h> // clock_gettime
+
+#if defined(__x86_64__)
+#include <x86intrin.h> // __rdtsc
+#endif
+
+#include "ph.h" // PH_THRESHOLD_*
+#include "sincos.h"
+
+/*
+ * Reduction paths, as in _sincos_pi_2 (sincos.c): sin(x) = x for tiny x,
+ * no reduction up to π∕2, Cody-Waite, then Payne-Hanek.
+ */
+
+enum {
+    PATH_TINY,
+    PATH_NONE,
+    PATH_CW,
+    PATH_PH,
+    PATH_NONFINITE,
+    N_PATHS,
+};
+
+static const char *path_names[N_PATHS] = {
+    "tiny", "|x| <= pi/2", "cody-waite", "payne-hanek", "inf or nan",
+};
+
+// Magnitudes: the binary exponent of |x|, from 2⁻³² (and below) to 2¹⁰²⁴.
+#define MIN_EXPONENT (-32)
+#define N_MAGNITUDES (1024 - MIN_EXPONENT + 1)
+
+// Latencies: the binary logarithm of the number of cycles.
+#define N_LATENCIES 64
+
+// Time libm for one call in LIBM_SAMPLE.
+#define LIBM_SAMPLE 64
+
+typedef struct {
+    const char *name;
+    uint64_t calls;
+    uint64_t paths[N_PATHS];
+    uint64_t magnitudes[N_MAGNITUDES];
+    uint64_t latencies[N_LATENCIES];
+    uint64_t libm_latencies[N_LATENCIES];
+} preload_stats;
+
+enum {
+    SIN,
+    COS,
+    SINCOS,
+    SINF,
+    COSF,
+    SINCOSF,
+    N_FUNCTIONS,
+};
+
+static preload_stats stats[N_FUNCTIONS] = {
+    [SIN] = {.name = "sin"},
+    [COS] = {.name = "cos"},
+    [SINCOS] = {.name = "sincos"},
+    [SINF] = {.name = "sinf"},
+    [COSF] = {.name = "cosf"},
+    [SINCOSF] = {.name = "sincosf"},
+};
+
+static int enabled = 0;
+static uint64_t overhead = 0; // of a pair of cycles()
+
+static double (*libm_sin)(double);
+static double (*libm_cos)(double);
+static void (*libm_sincos)(double, double *, double *);
+static float (*libm_sinf)(float);
+static float (*libm_cosf)(float);
+static void (*libm_sincosf)(float, float *, float *);
+
+static inline uint64_t
+__attribute__((always_inline))
+cycles(void)
+{
+#if defined(__x86_64__)
+    return __rdtsc();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t) t.tv_sec * 1000000000 + (uint64_t) t.tv_nsec;
+#endif
+}
+
+static inline void
+__attribute__((always_inline))
+count(uint64_t *counter)
+{
+    __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+}
+
+static int
+path(double x, double tiny, double large)
+{
+    x = fabs(x);
+    if (!isfinite(x))
+        return PATH_NONFINITE;
+    if (x <= tiny)
+        return PATH_TINY;
+    if (x <= M_PI_2)
+        return PATH_NONE;
+    if (x < large)
+        return PATH_CW;
+    return PATH_PH;
+}
+
+static int
+magnitude(double x)
+{
+    int e = 0;
+    frexp(fabs(x), &e);
+    if (x == 0.0 || e < MIN_EXPONENT)
+        e = MIN_EXPONENT;
+    return e - MIN_EXPONENT;
+}
+
+static int
+latency(uint64_t t)
+{
+    t = t > overhead ? t - overhead : 0;
+    int i = 0;
+    while (t > 1 && i < N_LATENCIES - 1) {
+        t >>= 1;
+        i++;
+    }
+    return i;
+}
+
+static void
+record(preload_stats *s, double x, double tiny, double large, uint64_t t)
+{
+    count(&s->calls);
+    count(&s->paths[path(x, tiny, large)]);
+    count(&s->magnitudes[magnitude(x)]);
+    count(&s->latencies[latency(t)]);
+}
+
+static inline int
+__attribute__((always_inline))
+sample(preload_stats *s)
+{
+    return __atomic_load_n(&s->calls, __ATOMIC_RELAXED) % LIBM_SAMPLE == 0;
+}
+
+// The thresholds of _sincos_pi_2 for float and double.
+#define TINY_FLOAT 2.7e-4f
+#define TINY_DOUBLE 2.1e-8f
+
+double
+sin(double x)
+{
+    if (!enabled)
+        return _sin_double(x);
+    preload_stats *s = &stats[SIN];
+    if (libm_sin != NULL && sample(s)) {
+        uint64_t t0 = cycles();
+        volatile double y = (*libm_sin)(x);
+        (void) y;
+        count(&s->libm_latencies[latency(cycles() - t0)]);
+    }
+    uint64_t t0 = cycles();
+    double y = _sin_double(x);
+    record(s, x, TINY_DOUBLE, PH_THRESHOLD_DOUBLE, cycles() - t0);
+    return y;
+}
+
+double
+cos(double x)
+{
+    if (!enabled)
+        return _cos_double(x);
+    preload_stats *s = &stats[COS];
+    if (libm_cos != NULL && sample(s)) {
+        uint64_t t0 = cycles();
+        volatile double y = (*libm_cos)(x);
+        (void) y;
+        count(&s->libm_latencies[latency(cycles() - t0)]);
+    }
+    uint64_t t0 = cycles();
+    double y = _cos_double(x);
+    record(s, x, TINY_DOUBLE, PH_THRESHOLD_DOUBLE, cycles() - t0);
+    return y;
+}
+
+void
+sincos(double x, double *sin_x, double *cos_x)
+{
+    if (!enabled) {
+        _sincos_double(x, sin_x, cos_x);
+        return;
+    }
+    preload_stats *s = &stats[SINCOS];
+    if (libm_sincos != NULL && sample(s)) {
+        double sx, cx;
+        uint64_t t0 = cycles();
+        (*libm_sincos)(x, &sx, &cx);
+        count(&s->libm_latencies[latency(cycles() - t0)]);
+    }
+    uint64_t t0 = cycles();
+    _sincos_double(x, sin_x, cos_x);
+    record(s, x, TINY_DOUBLE, PH_THRESHOLD_DOUBLE, cycles() - t0);
+}
+
+float
+sinf(float x)
+{
+    if (!enabled)
+        return _sin_float(x);
+    preload_stats *s = &stats[SINF];
+    if (libm_sinf != NULL && sample(s)) {
+        uint64_t t0 = cycles();
+        volatile float y = (*libm_sinf)(x);
+        (void) y;
+        count(&s->libm_latencies[latency(cycles() - t0)]);
+    }
+    uint64_t t0 = cycles();
+    float y = _sin_float(x);
+    record(s, x, TINY_FLOAT, PH_THRESHOLD_FLOAT, cycles() - t0);
+    return y;
+}
+
+float
+cosf(float x)
+{
+    if (!enabled)
+        return _cos_float(x);
+    preload_stats *s = &stats[COSF];
+    if (libm_cosf != NULL && sample(s)) {
+        uint64_t t0 = cycles();
+        volatile float y = (*libm_cosf)(x);
+        (void) y;
+        count(&s->libm_latencies[latency(cycles() - t0)]);
+    }
+    uint64_t t0 = cycles();
+    float y = _cos_float(x);
+    record(s, x, TINY_FLOAT, PH_THRESHOLD_FLOAT, cycles() - t0);
+    return y;
+}
+
+void
+sincosf(float x, float *sin_x, float *cos_x)
+{
+    if (!enabled) {
+        _sincos_float(x, sin_x, cos_x);
+        return;
+    }
+    preload_stats *s = &stats[SINCOSF];
+    if (libm_sincosf != NULL && sample(s)) {
+        float sx, cx;
+        uint64_t t0 = cycles();
+        (*libm_sincosf)(x, &sx, &cx);
+        count(&s->libm_latencies[latency(cycles() - t0)]);
+    }
+    uint64_t t0 = cycles();
+    _sincos_float(x, sin_x, cos_x);
+    record(s, x, TINY_FLOAT, PH_THRESHOLD_FLOAT, cycles() - t0);
+}
+
+static void
+__attribute__((constructor))
+init(void)
+{
+    const char *file = getenv("FUNLIBM_STATS");
+    if (file == NULL || file[0] == '\0')
+        return;
+    *(void **) &libm_sin = dlsym(RTLD_NEXT, "sin");
+    *(void **) &libm_cos = dlsym(RTLD_NEXT, "cos");
+    *(void **) &libm_sincos = dlsym(RTLD_NEXT, "sincos");
+    *(void **) &libm_sinf = dlsym(RTLD_NEXT, "sinf");
+    *(void **) &libm_cosf = dlsym(RTLD_NEXT, "cosf");
+    *(void **) &libm_sincosf = dlsym(RTLD_NEXT, "sincosf");
+    // The least of a few empty measurements.
+    overhead = UINT64_MAX;
+    for (int i = 0; i < 100; i++) {
+        uint64_t t0 = cycles();
+        uint64_t t = cycles() - t0;
+        if (t < overhead)
+            overhead = t;
+    }
+    enabled = 1;
+}
+
+static void
+print_histogram(FILE *f, const char *title, const uint64_t *counts, int n, uint64_t total)
+{
+    fprintf(f, "    %s:\n", title);
+    for (int i = 0; i < n; i++) {
+        if (counts[i] == 0)
+            continue;
+        fprintf(f, "        2^%-6d %12llu (%6.2f%%)\n", i, (unsigned long long) counts[i],
+            100.0 * (double) counts[i] / (double) total);
+    }
+}
+
+static void
+__attribute__((destructor))
+fini(void)
+{
+    if (!enabled)
+        return;
+    enabled = 0;
+    const char *file = getenv("FUNLIBM_STATS");
+    FILE *f = strcmp(file, "-") == 0 ? stderr : fopen(file, "w");
+    if (f == NULL)
+        return;
+#if defined(__x86_64__)
+    fprintf(f, "latency unit: cycles (rdtsc), less %llu\n\n", (unsigned long long) overhead);
+#else
+    fprintf(f, "latency unit: nanoseconds, less %llu\n\n", (unsigned long long) overhead);
+#endif
+    for (int j = 0; j < N_FUNCTIONS; j++) {
+        const preload_stats *s = &stats[j];
+        if (s->calls == 0)
+            continue;
+        fprintf(f, "%s: %llu calls\n\n", s->name, (unsigned long long) s->calls);
+        fprintf(f, "    paths:\n");
+        for (int i = 0; i < N_PATHS; i++)
+            fprintf(f, "        %-12s %12llu (%6.2f%%)\n", path_names[i],
+                (unsigned long long) s->paths[i],
+                100.0 * (double) s->paths[i] / (double) s->calls);
+        fprintf(f, "    magnitudes (|x| < 2^e):\n");
+        for (int i = 0; i < N_MAGNITUDES; i++) {
+            if (s->magnitudes[i] == 0)
+                continue;
+            fprintf(f, "        2^%-6d %12llu (%6.2f%%)\n", i + MIN_EXPONENT,
+                (unsigned long long) s->magnitudes[i],
+                100.0 * (double) s->magnitudes[i] / (double) s->calls);
+        }
+        print_histogram(f, "latency", s->latencies, N_LATENCIES, s->calls);
+        uint64_t libm_calls = 0;
+        for (int i = 0; i < N_LATENCIES; i++)
+            libm_calls += s->libm_latencies[i];
+        if (libm_calls > 0)
+            print_histogram(f, "libm latency (sampled)", s->libm_latencies, N_LATENCIES, libm_calls);
+        fprintf(f, "\n");
+    }
+    if (f != stderr)
+        fclose(f);
+}
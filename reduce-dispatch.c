@@ -0,0 +1,369 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#include <stddef.h> // size_t
+#include <stdint.h> // int32_t, int64_t
+
+#include "isa.h" // isa_level
+#include "reduce.h"
+#include "types.h" // quadrant_result_double, rem_result_double, etc.
+
+/*
+ * The public functions of reduce.h, for a build of reduce.c per level of
+ * isa.h (reduce-v2.o, reduce-v3.o, reduce-v4.o), as in sincos-dispatch.c:
+ * the reductions of Boldo-Daumas-Li use fma from x86-64-v3 on, and the
+ * array functions are vectorized for the level.
+ */
+
+#define REDUCE_DECLARE(level) \
+    rem_result_float naive_rem_pi_float_v##level(float x); \
+    rem_result_double naive_rem_pi_double_v##level(double x); \
+    rem_result_float naive_rem_2pi_float_v##level(float x); \
+    rem_result_double naive_rem_2pi_double_v##level(double x); \
+    rem_result_float naive_rem_pi_2_float_v##level(float x); \
+    rem_result_double naive_rem_pi_2_double_v##level(double x); \
+    rem_result_float cw_rem_pi_float_v##level(float x); \
+    rem_result_double cw_rem_pi_double_v##level(double x); \
+    rem_result_float cw_rem_2pi_float_v##level(float x); \
+    rem_result_double cw_rem_2pi_double_v##level(double x); \
+    rem_result_float cw_rem_pi_2_float_v##level(float x); \
+    rem_result_double cw_rem_pi_2_double_v##level(double x); \
+    rem_result_float bdl_rem_pi_float_v##level(float x); \
+    rem_result_double bdl_rem_pi_double_v##level(double x); \
+    rem_result_float bdl_rem_2pi_float_v##level(float x); \
+    rem_result_double bdl_rem_2pi_double_v##level(double x); \
+    rem_result_float bdl_rem_pi_2_float_v##level(float x); \
+    rem_result_double bdl_rem_pi_2_double_v##level(double x); \
+    quadrant_result_float bdl_quadrant_pi_2_float_v##level(float x); \
+    quadrant_result_double bdl_quadrant_pi_2_double_v##level(double x); \
+    rem_result_float bdl_dekker_rem_pi_2_float_v##level(float x); \
+    rem_result_double bdl_dekker_rem_pi_2_double_v##level(double x); \
+    quadrant_result_float bdl_dekker_quadrant_pi_2_float_v##level(float x); \
+    quadrant_result_double bdl_dekker_quadrant_pi_2_double_v##level(double x); \
+    rem_result_float ph_rem_pi_2_float_v##level(float x); \
+    rem_result_double ph_rem_pi_2_double_v##level(double x); \
+    void cw_rem_pi_2_array_float_v##level(const float *restrict xs, size_t n, int32_t *restrict zs, float *restrict v1s, float *restrict v2s); \
+    void cw_rem_pi_2_array_double_v##level(const double *restrict xs, size_t n, int64_t *restrict zs, double *restrict v1s, double *restrict v2s); \
+    void bdl_rem_pi_2_array_float_v##level(const float *restrict xs, size_t n, int32_t *restrict zs, float *restrict v1s, float *restrict v2s); \
+    void bdl_rem_pi_2_array_double_v##level(const double *restrict xs, size_t n, int64_t *restrict zs, double *restrict v1s, double *restrict v2s); \
+    void bdl_quadrant_pi_2_array_float_v##level(const float *restrict xs, size_t n, float *restrict zs, float *restrict v1s, float *restrict v2s); \
+    void bdl_quadrant_pi_2_array_double_v##level(const double *restrict xs, size_t n, double *restrict zs, double *restrict v1s, double *restrict v2s);
+
+REDUCE_DECLARE(2)
+REDUCE_DECLARE(3)
+REDUCE_DECLARE(4)
+
+typedef struct {
+    rem_result_float (*naive_rem_pi_float)(float);
+    rem_result_double (*naive_rem_pi_double)(double);
+    rem_result_float (*naive_rem_2pi_float)(float);
+    rem_result_double (*naive_rem_2pi_double)(double);
+    rem_result_float (*naive_rem_pi_2_float)(float);
+    rem_result_double (*naive_rem_pi_2_double)(double);
+    rem_result_float (*cw_rem_pi_float)(float);
+    rem_result_double (*cw_rem_pi_double)(double);
+    rem_result_float (*cw_rem_2pi_float)(float);
+    rem_result_double (*cw_rem_2pi_double)(double);
+    rem_result_float (*cw_rem_pi_2_float)(float);
+    rem_result_double (*cw_rem_pi_2_double)(double);
+    rem_result_float (*bdl_rem_pi_float)(float);
+    rem_result_double (*bdl_rem_pi_double)(double);
+    rem_result_float (*bdl_rem_2pi_float)(float);
+    rem_result_double (*bdl_rem_2pi_double)(double);
+    rem_result_float (*bdl_rem_pi_2_float)(float);
+    rem_result_double (*bdl_rem_pi_2_double)(double);
+    quadrant_result_float (*bdl_quadrant_pi_2_float)(float);
+    quadrant_result_double (*bdl_quadrant_pi_2_double)(double);
+    rem_result_float (*bdl_dekker_rem_pi_2_float)(float);
+    rem_result_double (*bdl_dekker_rem_pi_2_double)(double);
+    quadrant_result_float (*bdl_dekker_quadrant_pi_2_float)(float);
+    quadrant_result_double (*bdl_dekker_quadrant_pi_2_double)(double);
+    rem_result_float (*ph_rem_pi_2_float)(float);
+    rem_result_double (*ph_rem_pi_2_double)(double);
+    void (*cw_rem_pi_2_array_float)(const float *, size_t, int32_t *, float *, float *);
+    void (*cw_rem_pi_2_array_double)(const double *, size_t, int64_t *, double *, double *);
+    void (*bdl_rem_pi_2_array_float)(const float *, size_t, int32_t *, float *, float *);
+    void (*bdl_rem_pi_2_array_double)(const double *, size_t, int64_t *, double *, double *);
+    void (*bdl_quadrant_pi_2_array_float)(const float *, size_t, float *, float *, float *);
+    void (*bdl_quadrant_pi_2_array_double)(const double *, size_t, double *, double *, double *);
+} reduce_functions;
+
+#define REDUCE_FUNCTIONS(level) \
+    { \
+        &naive_rem_pi_float_v##level, \
+        &naive_rem_pi_double_v##level, \
+        &naive_rem_2pi_float_v##level, \
+        &naive_rem_2pi_double_v##level, \
+        &naive_rem_pi_2_float_v##level, \
+        &naive_rem_pi_2_double_v##level, \
+        &cw_rem_pi_float_v##level, \
+        &cw_rem_pi_double_v##level, \
+        &cw_rem_2pi_float_v##level, \
+        &cw_rem_2pi_double_v##level, \
+        &cw_rem_pi_2_float_v##level, \
+        &cw_rem_pi_2_double_v##level, \
+        &bdl_rem_pi_float_v##level, \
+        &bdl_rem_pi_double_v##level, \
+        &bdl_rem_2pi_float_v##level, \
+        &bdl_rem_2pi_double_v##level, \
+        &bdl_rem_pi_2_float_v##level, \
+        &bdl_rem_pi_2_double_v##level, \
+        &bdl_quadrant_pi_2_float_v##level, \
+        &bdl_quadrant_pi_2_double_v##level, \
+        &bdl_dekker_rem_pi_2_float_v##level, \
+        &bdl_dekker_rem_pi_2_double_v##level, \
+        &bdl_dekker_quadrant_pi_2_float_v##level, \
+        &bdl_dekker_quadrant_pi_2_double_v##level, \
+        &ph_rem_pi_2_float_v##level, \
+        &ph_rem_pi_2_double_v##level, \
+        &cw_rem_pi_2_array_float_v##level, \
+        &cw_rem_pi_2_array_double_v##level, \
+        &bdl_rem_pi_2_array_float_v##level, \
+        &bdl_rem_pi_2_array_double_v##level, \
+        &bdl_quadrant_pi_2_array_float_v##level, \
+        &bdl_quadrant_pi_2_array_double_v##level, \
+    }
+
+static const reduce_functions levels[5] = {
+    [2] = REDUCE_FUNCTIONS(2),
+    [3] = REDUCE_FUNCTIONS(3),
+    [4] = REDUCE_FUNCTIONS(4),
+};
+
+static int level = 2;
+static reduce_functions f = REDUCE_FUNCTIONS(2);
+
+static void
+__attribute__((constructor))
+init(void)
+{
+    level = isa_level();
+    f = levels[level];
+}
+
+int
+_reduce_isa_level(void)
+{
+    return level;
+}
+
+rem_result_float
+naive_rem_pi_float(float x)
+{
+    return (*f.naive_rem_pi_float)(x);
+}
+
+rem_result_double
+naive_rem_pi_double(double x)
+{
+    return (*f.naive_rem_pi_double)(x);
+}
+
+rem_result_float
+naive_rem_2pi_float(float x)
+{
+    return (*f.naive_rem_2pi_float)(x);
+}
+
+rem_result_double
+naive_rem_2pi_double(double x)
+{
+    return (*f.naive_rem_2pi_double)(x);
+}
+
+rem_result_float
+naive_rem_pi_2_float(float x)
+{
+    return (*f.naive_rem_pi_2_float)(x);
+}
+
+rem_result_double
+naive_rem_pi_2_double(double x)
+{
+    return (*f.naive_rem_pi_2_double)(x);
+}
+
+rem_result_float
+cw_rem_pi_float(float x)
+{
+    return (*f.cw_rem_pi_float)(x);
+}
+
+rem_result_double
+cw_rem_pi_double(double x)
+{
+    return (*f.cw_rem_pi_double)(x);
+}
+
+rem_result_float
+cw_rem_2pi_float(float x)
+{
+    return (*f.cw_rem_2pi_float)(x);
+}
+
+rem_result_double
+cw_rem_2pi_double(double x)
+{
+    return (*f.cw_rem_2pi_double)(x);
+}
+
+rem_result_float
+cw_rem_pi_2_float(float x)
+{
+    return (*f.cw_rem_pi_2_float)(x);
+}
+
+rem_result_double
+cw_rem_pi_2_double(double x)
+{
+    return (*f.cw_rem_pi_2_double)(x);
+}
+
+rem_result_float
+bdl_rem_pi_float(float x)
+{
+    return (*f.bdl_rem_pi_float)(x);
+}
+
+rem_result_double
+bdl_rem_pi_double(double x)
+{
+    return (*f.bdl_rem_pi_double)(x);
+}
+
+rem_result_float
+bdl_rem_2pi_float(float x)
+{
+    return (*f.bdl_rem_2pi_float)(x);
+}
+
+rem_result_double
+bdl_rem_2pi_double(double x)
+{
+    return (*f.bdl_rem_2pi_double)(x);
+}
+
+rem_result_float
+bdl_rem_pi_2_float(float x)
+{
+    return (*f.bdl_rem_pi_2_float)(x);
+}
+
+rem_result_double
+bdl_rem_pi_2_double(double x)
+{
+    return (*f.bdl_rem_pi_2_double)(x);
+}
+
+quadrant_result_float
+bdl_quadrant_pi_2_float(float x)
+{
+    return (*f.bdl_quadrant_pi_2_float)(x);
+}
+
+quadrant_result_double
+bdl_quadrant_pi_2_double(double x)
+{
+    return (*f.bdl_quadrant_pi_2_double)(x);
+}
+
+rem_result_float
+bdl_dekker_rem_pi_2_float(float x)
+{
+    return (*f.bdl_dekker_rem_pi_2_float)(x);
+}
+
+rem_result_double
+bdl_dekker_rem_pi_2_double(double x)
+{
+    return (*f.bdl_dekker_rem_pi_2_double)(x);
+}
+
+quadrant_result_float
+bdl_dekker_quadrant_pi_2_float(float x)
+{
+    return (*f.bdl_dekker_quadrant_pi_2_float)(x);
+}
+
+quadrant_result_double
+bdl_dekker_quadrant_pi_2_double(double x)
+{
+    return (*f.bdl_dekker_quadrant_pi_2_double)(x);
+}
+
+rem_result_float
+ph_rem_pi_2_float(float x)
+{
+    return (*f.ph_rem_pi_2_float)(x);
+}
+
+rem_result_double
+ph_rem_pi_2_double(double x)
+{
+    return (*f.ph_rem_pi_2_double)(x);
+}
+
+void
+cw_rem_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    int32_t *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+    (*f.cw_rem_pi_2_array_float)(xs, n, zs, v1s, v2s);
+}
+
+void
+cw_rem_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    int64_t *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+    (*f.cw_rem_pi_2_array_double)(xs, n, zs, v1s, v2s);
+}
+
+void
+bdl_rem_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    int32_t *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+    (*f.bdl_rem_pi_2_array_float)(xs, n, zs, v1s, v2s);
+}
+
+void
+bdl_rem_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    int64_t *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+    (*f.bdl_rem_pi_2_array_double)(xs, n, zs, v1s, v2s);
+}
+
+void
+bdl_quadrant_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    float *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+    (*f.bdl_quadrant_pi_2_array_float)(xs, n, zs, v1s, v2s);
+}
+
+void
+bdl_quadrant_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    double *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+    (*f.bdl_quadrant_pi_2_array_double)(xs, n, zs, v1s, v2s);
+}
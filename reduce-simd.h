@@ -0,0 +1,603 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/* Compile with -DNDEBUG, except for debugging. */
+
+#pragma once
+
+/*
+ * Vector kernels for the array functions of reduce.c, with AVX-512F or
+ * AVX2 and FMA intrinsics (simd.h). They perform the same operations as
+ * the scalar reductions, lane by lane and in the same order, so the
+ * results are identical bit for bit: _cw_rem_pi_2_select (cw.h),
+ * _bdl_rem_pi_2 and _bdl_quadrant_pi_2 (reduce.h), with fma.
+ *
+ * _cw_rem_pi_2_simd_*, _bdl_rem_pi_2_simd_* and _bdl_quadrant_pi_2_simd_*
+ * reduce at most REDUCE_SIMD_LANES_* elements, with masked loads and
+ * stores for the tail, and return 0 without storing anything if a lane
+ * needs the scalar path: Payne-Hanek (|x| ≥ PH_THRESHOLD_*), infinities
+ * and NaN. The quotients are integers in the floating-point domain until
+ * they are stored.
+ *
+ * The corrections are counted by the scalar path only, so COUNTERS
+ * disables these kernels, and so does REDUCE_NO_SIMD (make SIMD=0).
+ */
+
+#include <stddef.h> // size_t
+#include <stdint.h> // int32_t, int64_t
+
+#include "cw.h" // cw_parameters_pi_2_*
+#include "ph.h" // PH_THRESHOLD_*
+#include "reduce.h" // bdl_parameters_pi_2_*, QUADRANT_BIAS_*
+#include "simd.h" // SIMD_WIDTH, _cw_quotient_avx512_ps, etc.
+
+#if !defined(REDUCE_NO_SIMD) && !defined(COUNTERS) && defined(SIMD_WIDTH)
+#define REDUCE_SIMD SIMD_WIDTH
+#endif
+
+#if defined(REDUCE_SIMD) && REDUCE_SIMD == 512
+
+#define REDUCE_SIMD_LANES_FLOAT 16
+#define REDUCE_SIMD_LANES_DOUBLE 8
+
+// Returns the integers q, |q| < 2⁵², as 64-bit integers: the low bits
+// of |q| + 2⁵², with the sign of q (x86 converts doubles to 64-bit
+// integers only with AVX-512DQ).
+
+static inline __m512i
+__attribute__((always_inline))
+_cvt_avx512_epi64(__m512d q)
+{
+    const __m512d magic = _mm512_set1_pd(0x1.0p52);
+    __m512i bits = _mm512_castpd_si512(_mm512_add_pd(_mm512_abs_pd(q), magic));
+    bits = _mm512_sub_epi64(bits, _mm512_castpd_si512(magic));
+    __mmask8 negative = _mm512_cmp_pd_mask(q, _mm512_setzero_pd(), _CMP_LT_OQ);
+    return _mm512_mask_sub_epi64(bits, negative, _mm512_setzero_si512(), bits);
+}
+
+static inline int
+__attribute__((always_inline))
+_cw_rem_pi_2_simd_float(const float *xs, size_t n, int32_t *zs, float *v1s, float *v2s)
+{
+    const cw_parameters_float cw = cw_parameters_pi_2_float;
+    const __m512 zero = _mm512_setzero_ps();
+    __mmask16 k = (__mmask16) ((1u << n) - 1);
+    __m512 x = _mm512_maskz_loadu_ps(k, xs);
+    __mmask16 ok = _mm512_cmp_ps_mask(_mm512_abs_ps(x), _mm512_set1_ps(PH_THRESHOLD_FLOAT), _CMP_LT_OQ);
+    if ((ok & k) != k)
+        return 0;
+    __mmask16 positive = _mm512_cmp_ps_mask(x, zero, _CMP_GE_OQ);
+    __mmask16 negative = _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ);
+
+    // _cw_rem_uncorrected, q = (float) (int32_t) t, where -0 + 0 = +0
+    __m512 t = _cw_quotient_avx512_ps(cw, x);
+    __m512 q = _mm512_add_ps(_mm512_roundscale_ps(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), zero);
+    __m512 v2;
+    __m512 v1 = _cw_reduce_avx512_ps(cw, _neg_avx512_ps(0xffff, q), x, &v2);
+
+    // _cw_correction_select
+    __m512 r = _mm512_add_ps(v1, v2);
+    __mmask16 up = positive & _mm512_cmp_ps_mask(r, zero, _CMP_LT_OQ);
+    __mmask16 down = negative & _mm512_cmp_ps_mask(r, zero, _CMP_GT_OQ);
+    __m512 c1 = _mm512_mask_mov_ps(_mm512_mask_mov_ps(_mm512_set1_ps(-0.0f), up, _mm512_set1_ps(cw.C1)), down, _mm512_set1_ps(-cw.C1));
+    __m512 c2 = _mm512_mask_mov_ps(_mm512_mask_mov_ps(_mm512_set1_ps(-0.0f), up, _mm512_set1_ps(cw.C2)), down, _mm512_set1_ps(-cw.C2));
+    v1 = _mm512_add_ps(v1, c1);
+    v2 = _mm512_add_ps(v2, c2);
+    q = _mm512_mask_mov_ps(q, up, _mm512_sub_ps(q, _mm512_set1_ps(1.0f)));
+    q = _mm512_mask_mov_ps(q, down, _mm512_add_ps(q, _mm512_set1_ps(1.0f)));
+
+    _mm512_mask_storeu_epi32(zs, k, _mm512_cvttps_epi32(q));
+    _mm512_mask_storeu_ps(v1s, k, v1);
+    _mm512_mask_storeu_ps(v2s, k, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_bdl_rem_pi_2_simd_float(const float *xs, size_t n, int32_t *zs, float *v1s, float *v2s)
+{
+    const bdl_parameters_float bdl = bdl_parameters_pi_2_float;
+    const __m512 bias = _mm512_set1_ps(BIAS_FLOAT);
+    const __m512 zero = _mm512_setzero_ps();
+    __mmask16 k = (__mmask16) ((1u << n) - 1);
+    __m512 x = _mm512_maskz_loadu_ps(k, xs);
+    __mmask16 ok = _mm512_cmp_ps_mask(_mm512_abs_ps(x), _mm512_set1_ps(PH_THRESHOLD_FLOAT), _CMP_LT_OQ);
+    if ((ok & k) != k)
+        return 0;
+    __mmask16 negative = _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ);
+
+    // bdl_reduce, q = (float) z and nq = (float) -z, where -0 + 0 = +0
+    __m512 q = _mm512_sub_ps(_mm512_fmadd_ps(x, _mm512_set1_ps(bdl.R), bias), bias);
+    q = _mm512_add_ps(_mm512_roundscale_ps(q, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), zero);
+    __m512 nq = _mm512_sub_ps(zero, q);
+    __m512 u = _mm512_fmadd_ps(nq, _mm512_set1_ps(bdl.C1), x);
+    __m512 v1 = _mm512_fmadd_ps(nq, _mm512_set1_ps(bdl.C2), u);
+    __m512 p = _mm512_mul_ps(q, _mm512_set1_ps(bdl.C2));
+    __m512 pe = _mm512_fmsub_ps(q, _mm512_set1_ps(bdl.C2), p);
+    __m512 te;
+    __m512 t = _add_avx512_ps(u, _neg_avx512_ps(0xffff, p), &te);
+    __m512 v2 = _mm512_sub_ps(_mm512_add_ps(_mm512_sub_ps(t, v1), te), pe);
+
+    // _bdl_correction_select
+    __mmask16 correct = _mm512_cmp_ps_mask(x, _mm512_set1_ps(-0.0f), _CMP_LE_OQ)
+        | _mm512_cmp_ps_mask(x, _mm512_set1_ps(0.0f), _CMP_GE_OQ);
+    __m512 lower = _mm512_mask_mov_ps(zero, negative, _mm512_set1_ps(-bdl.C));
+    __m512 upper = _mm512_mask_mov_ps(_mm512_set1_ps(bdl.C), negative, zero);
+    __m512 r = _mm512_add_ps(v1, v2);
+    __mmask16 below = correct & _mm512_cmp_ps_mask(r, lower, _CMP_LT_OQ);
+    v1 = _mm512_add_ps(v1, _mm512_mask_mov_ps(_mm512_set1_ps(-0.0f), below, _mm512_set1_ps(bdl.C1)));
+    v2 = _mm512_add_ps(v2, _mm512_mask_mov_ps(_mm512_set1_ps(-0.0f), below, _mm512_set1_ps(bdl.C2)));
+    q = _mm512_mask_mov_ps(q, below, _mm512_sub_ps(q, _mm512_set1_ps(1.0f)));
+    r = _mm512_add_ps(v1, v2);
+    __mmask16 above = correct & _mm512_cmp_ps_mask(r, upper, _CMP_GT_OQ);
+    v1 = _mm512_sub_ps(v1, _mm512_mask_mov_ps(zero, above, _mm512_set1_ps(bdl.C1)));
+    v2 = _mm512_sub_ps(v2, _mm512_mask_mov_ps(zero, above, _mm512_set1_ps(bdl.C2)));
+    q = _mm512_mask_mov_ps(q, above, _mm512_add_ps(q, _mm512_set1_ps(1.0f)));
+
+    _mm512_mask_storeu_epi32(zs, k, _mm512_cvttps_epi32(q));
+    _mm512_mask_storeu_ps(v1s, k, v1);
+    _mm512_mask_storeu_ps(v2s, k, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_bdl_quadrant_pi_2_simd_float(const float *xs, size_t n, float *zs, float *v1s, float *v2s)
+{
+    const bdl_parameters_float bdl = bdl_parameters_pi_2_float;
+    const __m512 bias = _mm512_set1_ps(QUADRANT_BIAS_FLOAT);
+    const __m512 zero = _mm512_setzero_ps();
+    __mmask16 k = (__mmask16) ((1u << n) - 1);
+    __m512 x = _mm512_maskz_loadu_ps(k, xs);
+    __mmask16 ok = _mm512_cmp_ps_mask(_mm512_abs_ps(x), _mm512_set1_ps(PH_THRESHOLD_FLOAT), _CMP_LT_OQ);
+    if ((ok & k) != k)
+        return 0;
+    __mmask16 positive = _mm512_cmp_ps_mask(x, zero, _CMP_GE_OQ);
+    __mmask16 negative = _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ);
+
+    // bdl_reduce_quadrant
+    __m512 z = _mm512_fmadd_ps(x, _mm512_set1_ps(bdl.R), bias);
+    __m512 q = _mm512_sub_ps(z, bias);
+    __m512 nq = _neg_avx512_ps(0xffff, q);
+    __m512 u = _mm512_fmadd_ps(nq, _mm512_set1_ps(bdl.C1), x);
+    __m512 v1 = _mm512_fmadd_ps(nq, _mm512_set1_ps(bdl.C2), u);
+    __m512 p = _mm512_mul_ps(q, _mm512_set1_ps(bdl.C2));
+    __m512 pe = _mm512_fmsub_ps(q, _mm512_set1_ps(bdl.C2), p);
+    __m512 te;
+    __m512 t = _add_avx512_ps(u, _neg_avx512_ps(0xffff, p), &te);
+    __m512 v2 = _mm512_sub_ps(_mm512_add_ps(_mm512_sub_ps(t, v1), te), pe);
+
+    // the sign of v₁+v₂
+    __m512 r = _mm512_add_ps(v1, v2);
+    __mmask16 up = positive & _mm512_cmp_ps_mask(r, zero, _CMP_LT_OQ);
+    __mmask16 down = negative & _mm512_cmp_ps_mask(r, zero, _CMP_GT_OQ);
+    __m512 c1 = _mm512_mask_mov_ps(_mm512_mask_mov_ps(_mm512_set1_ps(-0.0f), up, _mm512_set1_ps(bdl.C1)), down, _mm512_set1_ps(-bdl.C1));
+    __m512 c2 = _mm512_mask_mov_ps(_mm512_mask_mov_ps(_mm512_set1_ps(-0.0f), up, _mm512_set1_ps(bdl.C2)), down, _mm512_set1_ps(-bdl.C2));
+    __m512 dz = _mm512_mask_mov_ps(_mm512_mask_mov_ps(zero, up, _mm512_set1_ps(-1.0f)), down, _mm512_set1_ps(1.0f));
+    v1 = _mm512_add_ps(v1, c1);
+    v2 = _mm512_add_ps(v2, c2);
+    z = _mm512_add_ps(z, dz);
+
+    _mm512_mask_storeu_ps(zs, k, z);
+    _mm512_mask_storeu_ps(v1s, k, v1);
+    _mm512_mask_storeu_ps(v2s, k, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_cw_rem_pi_2_simd_double(const double *xs, size_t n, int64_t *zs, double *v1s, double *v2s)
+{
+    const cw_parameters_double cw = cw_parameters_pi_2_double;
+    const __m512d zero = _mm512_setzero_pd();
+    __mmask8 k = (__mmask8) ((1u << n) - 1);
+    __m512d x = _mm512_maskz_loadu_pd(k, xs);
+    __mmask8 ok = _mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(PH_THRESHOLD_DOUBLE), _CMP_LT_OQ);
+    if ((ok & k) != k)
+        return 0;
+    __mmask8 positive = _mm512_cmp_pd_mask(x, zero, _CMP_GE_OQ);
+    __mmask8 negative = _mm512_cmp_pd_mask(x, zero, _CMP_LT_OQ);
+
+    // _cw_rem_uncorrected, q = (double) (int64_t) t, where -0 + 0 = +0
+    __m512d t = _cw_quotient_avx512_pd(cw, x);
+    __m512d q = _mm512_add_pd(_mm512_roundscale_pd(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), zero);
+    __m512d v2;
+    __m512d v1 = _cw_reduce_avx512_pd(cw, _neg_avx512_pd(0xff, q), x, &v2);
+
+    // _cw_correction_select
+    __m512d r = _mm512_add_pd(v1, v2);
+    __mmask8 up = positive & _mm512_cmp_pd_mask(r, zero, _CMP_LT_OQ);
+    __mmask8 down = negative & _mm512_cmp_pd_mask(r, zero, _CMP_GT_OQ);
+    __m512d c1 = _mm512_mask_mov_pd(_mm512_mask_mov_pd(_mm512_set1_pd(-0.0), up, _mm512_set1_pd(cw.C1)), down, _mm512_set1_pd(-cw.C1));
+    __m512d c2 = _mm512_mask_mov_pd(_mm512_mask_mov_pd(_mm512_set1_pd(-0.0), up, _mm512_set1_pd(cw.C2)), down, _mm512_set1_pd(-cw.C2));
+    v1 = _mm512_add_pd(v1, c1);
+    v2 = _mm512_add_pd(v2, c2);
+    q = _mm512_mask_mov_pd(q, up, _mm512_sub_pd(q, _mm512_set1_pd(1.0)));
+    q = _mm512_mask_mov_pd(q, down, _mm512_add_pd(q, _mm512_set1_pd(1.0)));
+
+    _mm512_mask_storeu_epi64(zs, k, _cvt_avx512_epi64(q));
+    _mm512_mask_storeu_pd(v1s, k, v1);
+    _mm512_mask_storeu_pd(v2s, k, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_bdl_rem_pi_2_simd_double(const double *xs, size_t n, int64_t *zs, double *v1s, double *v2s)
+{
+    const bdl_parameters_double bdl = bdl_parameters_pi_2_double;
+    const __m512d bias = _mm512_set1_pd(BIAS_DOUBLE);
+    const __m512d zero = _mm512_setzero_pd();
+    __mmask8 k = (__mmask8) ((1u << n) - 1);
+    __m512d x = _mm512_maskz_loadu_pd(k, xs);
+    __mmask8 ok = _mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(PH_THRESHOLD_DOUBLE), _CMP_LT_OQ);
+    if ((ok & k) != k)
+        return 0;
+    __mmask8 negative = _mm512_cmp_pd_mask(x, zero, _CMP_LT_OQ);
+
+    // bdl_reduce, q = (double) z and nq = (double) -z, where -0 + 0 = +0
+    __m512d q = _mm512_sub_pd(_mm512_fmadd_pd(x, _mm512_set1_pd(bdl.R), bias), bias);
+    q = _mm512_add_pd(_mm512_roundscale_pd(q, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), zero);
+    __m512d nq = _mm512_sub_pd(zero, q);
+    __m512d u = _mm512_fmadd_pd(nq, _mm512_set1_pd(bdl.C1), x);
+    __m512d v1 = _mm512_fmadd_pd(nq, _mm512_set1_pd(bdl.C2), u);
+    __m512d p = _mm512_mul_pd(q, _mm512_set1_pd(bdl.C2));
+    __m512d pe = _mm512_fmsub_pd(q, _mm512_set1_pd(bdl.C2), p);
+    __m512d te;
+    __m512d t = _add_avx512_pd(u, _neg_avx512_pd(0xff, p), &te);
+    __m512d v2 = _mm512_sub_pd(_mm512_add_pd(_mm512_sub_pd(t, v1), te), pe);
+
+    // _bdl_correction_select
+    __mmask8 correct = _mm512_cmp_pd_mask(x, _mm512_set1_pd(-0x1.0p24), _CMP_LE_OQ)
+        | _mm512_cmp_pd_mask(x, _mm512_set1_pd(0x1.0p24), _CMP_GE_OQ);
+    __m512d lower = _mm512_mask_mov_pd(zero, negative, _mm512_set1_pd(-bdl.C));
+    __m512d upper = _mm512_mask_mov_pd(_mm512_set1_pd(bdl.C), negative, zero);
+    __m512d r = _mm512_add_pd(v1, v2);
+    __mmask8 below = correct & _mm512_cmp_pd_mask(r, lower, _CMP_LT_OQ);
+    v1 = _mm512_add_pd(v1, _mm512_mask_mov_pd(_mm512_set1_pd(-0.0), below, _mm512_set1_pd(bdl.C1)));
+    v2 = _mm512_add_pd(v2, _mm512_mask_mov_pd(_mm512_set1_pd(-0.0), below, _mm512_set1_pd(bdl.C2)));
+    q = _mm512_mask_mov_pd(q, below, _mm512_sub_pd(q, _mm512_set1_pd(1.0)));
+    r = _mm512_add_pd(v1, v2);
+    __mmask8 above = correct & _mm512_cmp_pd_mask(r, upper, _CMP_GT_OQ);
+    v1 = _mm512_sub_pd(v1, _mm512_mask_mov_pd(zero, above, _mm512_set1_pd(bdl.C1)));
+    v2 = _mm512_sub_pd(v2, _mm512_mask_mov_pd(zero, above, _mm512_set1_pd(bdl.C2)));
+    q = _mm512_mask_mov_pd(q, above, _mm512_add_pd(q, _mm512_set1_pd(1.0)));
+
+    _mm512_mask_storeu_epi64(zs, k, _cvt_avx512_epi64(q));
+    _mm512_mask_storeu_pd(v1s, k, v1);
+    _mm512_mask_storeu_pd(v2s, k, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_bdl_quadrant_pi_2_simd_double(const double *xs, size_t n, double *zs, double *v1s, double *v2s)
+{
+    const bdl_parameters_double bdl = bdl_parameters_pi_2_double;
+    const __m512d bias = _mm512_set1_pd(QUADRANT_BIAS_DOUBLE);
+    const __m512d zero = _mm512_setzero_pd();
+    __mmask8 k = (__mmask8) ((1u << n) - 1);
+    __m512d x = _mm512_maskz_loadu_pd(k, xs);
+    __mmask8 ok = _mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(PH_THRESHOLD_DOUBLE), _CMP_LT_OQ);
+    if ((ok & k) != k)
+        return 0;
+    __mmask8 positive = _mm512_cmp_pd_mask(x, zero, _CMP_GE_OQ);
+    __mmask8 negative = _mm512_cmp_pd_mask(x, zero, _CMP_LT_OQ);
+
+    // bdl_reduce_quadrant
+    __m512d z = _mm512_fmadd_pd(x, _mm512_set1_pd(bdl.R), bias);
+    __m512d q = _mm512_sub_pd(z, bias);
+    __m512d nq = _neg_avx512_pd(0xff, q);
+    __m512d u = _mm512_fmadd_pd(nq, _mm512_set1_pd(bdl.C1), x);
+    __m512d v1 = _mm512_fmadd_pd(nq, _mm512_set1_pd(bdl.C2), u);
+    __m512d p = _mm512_mul_pd(q, _mm512_set1_pd(bdl.C2));
+    __m512d pe = _mm512_fmsub_pd(q, _mm512_set1_pd(bdl.C2), p);
+    __m512d te;
+    __m512d t = _add_avx512_pd(u, _neg_avx512_pd(0xff, p), &te);
+    __m512d v2 = _mm512_sub_pd(_mm512_add_pd(_mm512_sub_pd(t, v1), te), pe);
+
+    // the sign of v₁+v₂
+    __m512d r = _mm512_add_pd(v1, v2);
+    __mmask8 up = positive & _mm512_cmp_pd_mask(r, zero, _CMP_LT_OQ);
+    __mmask8 down = negative & _mm512_cmp_pd_mask(r, zero, _CMP_GT_OQ);
+    __m512d c1 = _mm512_mask_mov_pd(_mm512_mask_mov_pd(_mm512_set1_pd(-0.0), up, _mm512_set1_pd(bdl.C1)), down, _mm512_set1_pd(-bdl.C1));
+    __m512d c2 = _mm512_mask_mov_pd(_mm512_mask_mov_pd(_mm512_set1_pd(-0.0), up, _mm512_set1_pd(bdl.C2)), down, _mm512_set1_pd(-bdl.C2));
+    __m512d dz = _mm512_mask_mov_pd(_mm512_mask_mov_pd(zero, up, _mm512_set1_pd(-1.0)), down, _mm512_set1_pd(1.0));
+    v1 = _mm512_add_pd(v1, c1);
+    v2 = _mm512_add_pd(v2, c2);
+    z = _mm512_add_pd(z, dz);
+
+    _mm512_mask_storeu_pd(zs, k, z);
+    _mm512_mask_storeu_pd(v1s, k, v1);
+    _mm512_mask_storeu_pd(v2s, k, v2);
+    return 1;
+}
+
+#elif defined(REDUCE_SIMD) && REDUCE_SIMD == 256
+
+#define REDUCE_SIMD_LANES_FLOAT 8
+#define REDUCE_SIMD_LANES_DOUBLE 4
+
+// See _cvt_avx512_epi64.
+
+static inline __m256i
+__attribute__((always_inline))
+_cvt_avx2_epi64(__m256d q)
+{
+    const __m256d magic = _mm256_set1_pd(0x1.0p52);
+    __m256i bits = _mm256_castpd_si256(_mm256_add_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), q), magic));
+    bits = _mm256_sub_epi64(bits, _mm256_castpd_si256(magic));
+    __m256i negative = _mm256_castpd_si256(_mm256_cmp_pd(q, _mm256_setzero_pd(), _CMP_LT_OQ));
+    return _mm256_sub_epi64(_mm256_xor_si256(bits, negative), negative);
+}
+
+static inline int
+__attribute__((always_inline))
+_cw_rem_pi_2_simd_float(const float *xs, size_t n, int32_t *zs, float *v1s, float *v2s)
+{
+    const cw_parameters_float cw = cw_parameters_pi_2_float;
+    const __m256 all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    const __m256 zero = _mm256_setzero_ps();
+    __m256i ki = _mm256_cmpgt_epi32(_mm256_set1_epi32((int) n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256 k = _mm256_castsi256_ps(ki);
+    __m256 x = _mm256_maskload_ps(xs, ki);
+    __m256 ok = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), x), _mm256_set1_ps(PH_THRESHOLD_FLOAT), _CMP_LT_OQ);
+    if (_mm256_movemask_ps(_mm256_andnot_ps(ok, k)) != 0)
+        return 0;
+    __m256 positive = _mm256_cmp_ps(x, zero, _CMP_GE_OQ);
+    __m256 negative = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+
+    // _cw_rem_uncorrected, q = (float) (int32_t) t, where -0 + 0 = +0
+    __m256 t = _cw_quotient_avx2_ps(cw, x);
+    __m256 q = _mm256_add_ps(_mm256_round_ps(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), zero);
+    __m256 v2;
+    __m256 v1 = _cw_reduce_avx2_ps(cw, _neg_avx2_ps(all, q), x, &v2);
+
+    // _cw_correction_select
+    __m256 r = _mm256_add_ps(v1, v2);
+    __m256 up = _mm256_and_ps(positive, _mm256_cmp_ps(r, zero, _CMP_LT_OQ));
+    __m256 down = _mm256_and_ps(negative, _mm256_cmp_ps(r, zero, _CMP_GT_OQ));
+    __m256 c1 = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_set1_ps(-0.0f), _mm256_set1_ps(cw.C1), up), _mm256_set1_ps(-cw.C1), down);
+    __m256 c2 = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_set1_ps(-0.0f), _mm256_set1_ps(cw.C2), up), _mm256_set1_ps(-cw.C2), down);
+    v1 = _mm256_add_ps(v1, c1);
+    v2 = _mm256_add_ps(v2, c2);
+    q = _mm256_blendv_ps(q, _mm256_sub_ps(q, _mm256_set1_ps(1.0f)), up);
+    q = _mm256_blendv_ps(q, _mm256_add_ps(q, _mm256_set1_ps(1.0f)), down);
+
+    _mm256_maskstore_epi32((int *) zs, ki, _mm256_cvttps_epi32(q));
+    _mm256_maskstore_ps(v1s, ki, v1);
+    _mm256_maskstore_ps(v2s, ki, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_bdl_rem_pi_2_simd_float(const float *xs, size_t n, int32_t *zs, float *v1s, float *v2s)
+{
+    const bdl_parameters_float bdl = bdl_parameters_pi_2_float;
+    const __m256 bias = _mm256_set1_ps(BIAS_FLOAT);
+    const __m256 all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    const __m256 zero = _mm256_setzero_ps();
+    __m256i ki = _mm256_cmpgt_epi32(_mm256_set1_epi32((int) n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256 k = _mm256_castsi256_ps(ki);
+    __m256 x = _mm256_maskload_ps(xs, ki);
+    __m256 ok = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), x), _mm256_set1_ps(PH_THRESHOLD_FLOAT), _CMP_LT_OQ);
+    if (_mm256_movemask_ps(_mm256_andnot_ps(ok, k)) != 0)
+        return 0;
+    __m256 negative = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+
+    // bdl_reduce, q = (float) z and nq = (float) -z, where -0 + 0 = +0
+    __m256 q = _mm256_sub_ps(_mm256_fmadd_ps(x, _mm256_set1_ps(bdl.R), bias), bias);
+    q = _mm256_add_ps(_mm256_round_ps(q, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), zero);
+    __m256 nq = _mm256_sub_ps(zero, q);
+    __m256 u = _mm256_fmadd_ps(nq, _mm256_set1_ps(bdl.C1), x);
+    __m256 v1 = _mm256_fmadd_ps(nq, _mm256_set1_ps(bdl.C2), u);
+    __m256 p = _mm256_mul_ps(q, _mm256_set1_ps(bdl.C2));
+    __m256 pe = _mm256_fmsub_ps(q, _mm256_set1_ps(bdl.C2), p);
+    __m256 te;
+    __m256 t = _add_avx2_ps(u, _neg_avx2_ps(all, p), &te);
+    __m256 v2 = _mm256_sub_ps(_mm256_add_ps(_mm256_sub_ps(t, v1), te), pe);
+
+    // _bdl_correction_select
+    __m256 correct = _mm256_or_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-0.0f), _CMP_LE_OQ),
+        _mm256_cmp_ps(x, _mm256_set1_ps(0.0f), _CMP_GE_OQ));
+    __m256 lower = _mm256_blendv_ps(zero, _mm256_set1_ps(-bdl.C), negative);
+    __m256 upper = _mm256_blendv_ps(_mm256_set1_ps(bdl.C), zero, negative);
+    __m256 r = _mm256_add_ps(v1, v2);
+    __m256 below = _mm256_and_ps(correct, _mm256_cmp_ps(r, lower, _CMP_LT_OQ));
+    v1 = _mm256_add_ps(v1, _mm256_blendv_ps(_mm256_set1_ps(-0.0f), _mm256_set1_ps(bdl.C1), below));
+    v2 = _mm256_add_ps(v2, _mm256_blendv_ps(_mm256_set1_ps(-0.0f), _mm256_set1_ps(bdl.C2), below));
+    q = _mm256_blendv_ps(q, _mm256_sub_ps(q, _mm256_set1_ps(1.0f)), below);
+    r = _mm256_add_ps(v1, v2);
+    __m256 above = _mm256_and_ps(correct, _mm256_cmp_ps(r, upper, _CMP_GT_OQ));
+    v1 = _mm256_sub_ps(v1, _mm256_blendv_ps(zero, _mm256_set1_ps(bdl.C1), above));
+    v2 = _mm256_sub_ps(v2, _mm256_blendv_ps(zero, _mm256_set1_ps(bdl.C2), above));
+    q = _mm256_blendv_ps(q, _mm256_add_ps(q, _mm256_set1_ps(1.0f)), above);
+
+    _mm256_maskstore_epi32((int *) zs, ki, _mm256_cvttps_epi32(q));
+    _mm256_maskstore_ps(v1s, ki, v1);
+    _mm256_maskstore_ps(v2s, ki, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_bdl_quadrant_pi_2_simd_float(const float *xs, size_t n, float *zs, float *v1s, float *v2s)
+{
+    const bdl_parameters_float bdl = bdl_parameters_pi_2_float;
+    const __m256 bias = _mm256_set1_ps(QUADRANT_BIAS_FLOAT);
+    const __m256 all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    const __m256 zero = _mm256_setzero_ps();
+    __m256i ki = _mm256_cmpgt_epi32(_mm256_set1_epi32((int) n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256 k = _mm256_castsi256_ps(ki);
+    __m256 x = _mm256_maskload_ps(xs, ki);
+    __m256 ok = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), x), _mm256_set1_ps(PH_THRESHOLD_FLOAT), _CMP_LT_OQ);
+    if (_mm256_movemask_ps(_mm256_andnot_ps(ok, k)) != 0)
+        return 0;
+    __m256 positive = _mm256_cmp_ps(x, zero, _CMP_GE_OQ);
+    __m256 negative = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+
+    // bdl_reduce_quadrant
+    __m256 z = _mm256_fmadd_ps(x, _mm256_set1_ps(bdl.R), bias);
+    __m256 q = _mm256_sub_ps(z, bias);
+    __m256 nq = _neg_avx2_ps(all, q);
+    __m256 u = _mm256_fmadd_ps(nq, _mm256_set1_ps(bdl.C1), x);
+    __m256 v1 = _mm256_fmadd_ps(nq, _mm256_set1_ps(bdl.C2), u);
+    __m256 p = _mm256_mul_ps(q, _mm256_set1_ps(bdl.C2));
+    __m256 pe = _mm256_fmsub_ps(q, _mm256_set1_ps(bdl.C2), p);
+    __m256 te;
+    __m256 t = _add_avx2_ps(u, _neg_avx2_ps(all, p), &te);
+    __m256 v2 = _mm256_sub_ps(_mm256_add_ps(_mm256_sub_ps(t, v1), te), pe);
+
+    // the sign of v₁+v₂
+    __m256 r = _mm256_add_ps(v1, v2);
+    __m256 up = _mm256_and_ps(positive, _mm256_cmp_ps(r, zero, _CMP_LT_OQ));
+    __m256 down = _mm256_and_ps(negative, _mm256_cmp_ps(r, zero, _CMP_GT_OQ));
+    __m256 c1 = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_set1_ps(-0.0f), _mm256_set1_ps(bdl.C1), up), _mm256_set1_ps(-bdl.C1), down);
+    __m256 c2 = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_set1_ps(-0.0f), _mm256_set1_ps(bdl.C2), up), _mm256_set1_ps(-bdl.C2), down);
+    __m256 dz = _mm256_blendv_ps(_mm256_blendv_ps(zero, _mm256_set1_ps(-1.0f), up), _mm256_set1_ps(1.0f), down);
+    v1 = _mm256_add_ps(v1, c1);
+    v2 = _mm256_add_ps(v2, c2);
+    z = _mm256_add_ps(z, dz);
+
+    _mm256_maskstore_ps(zs, ki, z);
+    _mm256_maskstore_ps(v1s, ki, v1);
+    _mm256_maskstore_ps(v2s, ki, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_cw_rem_pi_2_simd_double(const double *xs, size_t n, int64_t *zs, double *v1s, double *v2s)
+{
+    const cw_parameters_double cw = cw_parameters_pi_2_double;
+    const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    const __m256d zero = _mm256_setzero_pd();
+    __m256i ki = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long) n), _mm256_setr_epi64x(0, 1, 2, 3));
+    __m256d k = _mm256_castsi256_pd(ki);
+    __m256d x = _mm256_maskload_pd(xs, ki);
+    __m256d ok = _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), x), _mm256_set1_pd(PH_THRESHOLD_DOUBLE), _CMP_LT_OQ);
+    if (_mm256_movemask_pd(_mm256_andnot_pd(ok, k)) != 0)
+        return 0;
+    __m256d positive = _mm256_cmp_pd(x, zero, _CMP_GE_OQ);
+    __m256d negative = _mm256_cmp_pd(x, zero, _CMP_LT_OQ);
+
+    // _cw_rem_uncorrected, q = (double) (int64_t) t, where -0 + 0 = +0
+    __m256d t = _cw_quotient_avx2_pd(cw, x);
+    __m256d q = _mm256_add_pd(_mm256_round_pd(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), zero);
+    __m256d v2;
+    __m256d v1 = _cw_reduce_avx2_pd(cw, _neg_avx2_pd(all, q), x, &v2);
+
+    // _cw_correction_select
+    __m256d r = _mm256_add_pd(v1, v2);
+    __m256d up = _mm256_and_pd(positive, _mm256_cmp_pd(r, zero, _CMP_LT_OQ));
+    __m256d down = _mm256_and_pd(negative, _mm256_cmp_pd(r, zero, _CMP_GT_OQ));
+    __m256d c1 = _mm256_blendv_pd(_mm256_blendv_pd(_mm256_set1_pd(-0.0), _mm256_set1_pd(cw.C1), up), _mm256_set1_pd(-cw.C1), down);
+    __m256d c2 = _mm256_blendv_pd(_mm256_blendv_pd(_mm256_set1_pd(-0.0), _mm256_set1_pd(cw.C2), up), _mm256_set1_pd(-cw.C2), down);
+    v1 = _mm256_add_pd(v1, c1);
+    v2 = _mm256_add_pd(v2, c2);
+    q = _mm256_blendv_pd(q, _mm256_sub_pd(q, _mm256_set1_pd(1.0)), up);
+    q = _mm256_blendv_pd(q, _mm256_add_pd(q, _mm256_set1_pd(1.0)), down);
+
+    _mm256_maskstore_epi64((long long *) zs, ki, _cvt_avx2_epi64(q));
+    _mm256_maskstore_pd(v1s, ki, v1);
+    _mm256_maskstore_pd(v2s, ki, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_bdl_rem_pi_2_simd_double(const double *xs, size_t n, int64_t *zs, double *v1s, double *v2s)
+{
+    const bdl_parameters_double bdl = bdl_parameters_pi_2_double;
+    const __m256d bias = _mm256_set1_pd(BIAS_DOUBLE);
+    const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    const __m256d zero = _mm256_setzero_pd();
+    __m256i ki = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long) n), _mm256_setr_epi64x(0, 1, 2, 3));
+    __m256d k = _mm256_castsi256_pd(ki);
+    __m256d x = _mm256_maskload_pd(xs, ki);
+    __m256d ok = _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), x), _mm256_set1_pd(PH_THRESHOLD_DOUBLE), _CMP_LT_OQ);
+    if (_mm256_movemask_pd(_mm256_andnot_pd(ok, k)) != 0)
+        return 0;
+    __m256d negative = _mm256_cmp_pd(x, zero, _CMP_LT_OQ);
+
+    // bdl_reduce, q = (double) z and nq = (double) -z, where -0 + 0 = +0
+    __m256d q = _mm256_sub_pd(_mm256_fmadd_pd(x, _mm256_set1_pd(bdl.R), bias), bias);
+    q = _mm256_add_pd(_mm256_round_pd(q, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), zero);
+    __m256d nq = _mm256_sub_pd(zero, q);
+    __m256d u = _mm256_fmadd_pd(nq, _mm256_set1_pd(bdl.C1), x);
+    __m256d v1 = _mm256_fmadd_pd(nq, _mm256_set1_pd(bdl.C2), u);
+    __m256d p = _mm256_mul_pd(q, _mm256_set1_pd(bdl.C2));
+    __m256d pe = _mm256_fmsub_pd(q, _mm256_set1_pd(bdl.C2), p);
+    __m256d te;
+    __m256d t = _add_avx2_pd(u, _neg_avx2_pd(all, p), &te);
+    __m256d v2 = _mm256_sub_pd(_mm256_add_pd(_mm256_sub_pd(t, v1), te), pe);
+
+    // _bdl_correction_select
+    __m256d correct = _mm256_or_pd(_mm256_cmp_pd(x, _mm256_set1_pd(-0x1.0p24), _CMP_LE_OQ),
+        _mm256_cmp_pd(x, _mm256_set1_pd(0x1.0p24), _CMP_GE_OQ));
+    __m256d lower = _mm256_blendv_pd(zero, _mm256_set1_pd(-bdl.C), negative);
+    __m256d upper = _mm256_blendv_pd(_mm256_set1_pd(bdl.C), zero, negative);
+    __m256d r = _mm256_add_pd(v1, v2);
+    __m256d below = _mm256_and_pd(correct, _mm256_cmp_pd(r, lower, _CMP_LT_OQ));
+    v1 = _mm256_add_pd(v1, _mm256_blendv_pd(_mm256_set1_pd(-0.0), _mm256_set1_pd(bdl.C1), below));
+    v2 = _mm256_add_pd(v2, _mm256_blendv_pd(_mm256_set1_pd(-0.0), _mm256_set1_pd(bdl.C2), below));
+    q = _mm256_blendv_pd(q, _mm256_sub_pd(q, _mm256_set1_pd(1.0)), below);
+    r = _mm256_add_pd(v1, v2);
+    __m256d above = _mm256_and_pd(correct, _mm256_cmp_pd(r, upper, _CMP_GT_OQ));
+    v1 = _mm256_sub_pd(v1, _mm256_blendv_pd(zero, _mm256_set1_pd(bdl.C1), above));
+    v2 = _mm256_sub_pd(v2, _mm256_blendv_pd(zero, _mm256_set1_pd(bdl.C2), above));
+    q = _mm256_blendv_pd(q, _mm256_add_pd(q, _mm256_set1_pd(1.0)), above);
+
+    _mm256_maskstore_epi64((long long *) zs, ki, _cvt_avx2_epi64(q));
+    _mm256_maskstore_pd(v1s, ki, v1);
+    _mm256_maskstore_pd(v2s, ki, v2);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_bdl_quadrant_pi_2_simd_double(const double *xs, size_t n, double *zs, double *v1s, double *v2s)
+{
+    const bdl_parameters_double bdl = bdl_parameters_pi_2_double;
+    const __m256d bias = _mm256_set1_pd(QUADRANT_BIAS_DOUBLE);
+    const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    const __m256d zero = _mm256_setzero_pd();
+    __m256i ki = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long) n), _mm256_setr_epi64x(0, 1, 2, 3));
+    __m256d k = _mm256_castsi256_pd(ki);
+    __m256d x = _mm256_maskload_pd(xs, ki);
+    __m256d ok = _mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), x), _mm256_set1_pd(PH_THRESHOLD_DOUBLE), _CMP_LT_OQ);
+    if (_mm256_movemask_pd(_mm256_andnot_pd(ok, k)) != 0)
+        return 0;
+    __m256d positive = _mm256_cmp_pd(x, zero, _CMP_GE_OQ);
+    __m256d negative = _mm256_cmp_pd(x, zero, _CMP_LT_OQ);
+
+    // bdl_reduce_quadrant
+    __m256d z = _mm256_fmadd_pd(x, _mm256_set1_pd(bdl.R), bias);
+    __m256d q = _mm256_sub_pd(z, bias);
+    __m256d nq = _neg_avx2_pd(all, q);
+    __m256d u = _mm256_fmadd_pd(nq, _mm256_set1_pd(bdl.C1), x);
+    __m256d v1 = _mm256_fmadd_pd(nq, _mm256_set1_pd(bdl.C2), u);
+    __m256d p = _mm256_mul_pd(q, _mm256_set1_pd(bdl.C2));
+    __m256d pe = _mm256_fmsub_pd(q, _mm256_set1_pd(bdl.C2), p);
+    __m256d te;
+    __m256d t = _add_avx2_pd(u, _neg_avx2_pd(all, p), &te);
+    __m256d v2 = _mm256_sub_pd(_mm256_add_pd(_mm256_sub_pd(t, v1), te), pe);
+
+    // the sign of v₁+v₂
+    __m256d r = _mm256_add_pd(v1, v2);
+    __m256d up = _mm256_and_pd(positive, _mm256_cmp_pd(r, zero, _CMP_LT_OQ));
+    __m256d down = _mm256_and_pd(negative, _mm256_cmp_pd(r, zero, _CMP_GT_OQ));
+    __m256d c1 = _mm256_blendv_pd(_mm256_blendv_pd(_mm256_set1_pd(-0.0), _mm256_set1_pd(bdl.C1), up), _mm256_set1_pd(-bdl.C1), down);
+    __m256d c2 = _mm256_blendv_pd(_mm256_blendv_pd(_mm256_set1_pd(-0.0), _mm256_set1_pd(bdl.C2), up), _mm256_set1_pd(-bdl.C2), down);
+    __m256d dz = _mm256_blendv_pd(_mm256_blendv_pd(zero, _mm256_set1_pd(-1.0), up), _mm256_set1_pd(1.0), down);
+    v1 = _mm256_add_pd(v1, c1);
+    v2 = _mm256_add_pd(v2, c2);
+    z = _mm256_add_pd(z, dz);
+
+    _mm256_maskstore_pd(zs, ki, z);
+    _mm256_maskstore_pd(v1s, ki, v1);
+    _mm256_maskstore_pd(v2s, ki, v2);
+    return 1;
+}
+
+#endif
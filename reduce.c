@@ -1,11 +1,57 @@
 /* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
 
 #include <fenv.h> // fegetround, FE_TONEAREST
+#include <stddef.h> // size_t
+#include <stdint.h> // int32_t, int64_t
 
-#include "types.h" // rem_result_float, rem_result_double
+#include "types.h" // quadrant_result_double, rem_result_double, etc.
+
+/*
+ * Compiled with -DISA=N, for reduce-dispatch.c, this file defines
+ * naive_rem_pi_float_vN, etc., instead of the public functions (see isa.h).
+ */
+
+#include "isa.h" // ISA_NAME
+
+#if defined(ISA)
+#define naive_rem_pi_float ISA_NAME(naive_rem_pi_float)
+#define naive_rem_pi_double ISA_NAME(naive_rem_pi_double)
+#define naive_rem_2pi_float ISA_NAME(naive_rem_2pi_float)
+#define naive_rem_2pi_double ISA_NAME(naive_rem_2pi_double)
+#define naive_rem_pi_2_float ISA_NAME(naive_rem_pi_2_float)
+#define naive_rem_pi_2_double ISA_NAME(naive_rem_pi_2_double)
+#define cw_rem_pi_float ISA_NAME(cw_rem_pi_float)
+#define cw_rem_pi_double ISA_NAME(cw_rem_pi_double)
+#define cw_rem_2pi_float ISA_NAME(cw_rem_2pi_float)
+#define cw_rem_2pi_double ISA_NAME(cw_rem_2pi_double)
+#define cw_rem_pi_2_float ISA_NAME(cw_rem_pi_2_float)
+#define cw_rem_pi_2_double ISA_NAME(cw_rem_pi_2_double)
+#define bdl_rem_pi_float ISA_NAME(bdl_rem_pi_float)
+#define bdl_rem_pi_double ISA_NAME(bdl_rem_pi_double)
+#define bdl_rem_2pi_float ISA_NAME(bdl_rem_2pi_float)
+#define bdl_rem_2pi_double ISA_NAME(bdl_rem_2pi_double)
+#define bdl_rem_pi_2_float ISA_NAME(bdl_rem_pi_2_float)
+#define bdl_rem_pi_2_double ISA_NAME(bdl_rem_pi_2_double)
+#define bdl_quadrant_pi_2_float ISA_NAME(bdl_quadrant_pi_2_float)
+#define bdl_quadrant_pi_2_double ISA_NAME(bdl_quadrant_pi_2_double)
+#define bdl_dekker_rem_pi_2_float ISA_NAME(bdl_dekker_rem_pi_2_float)
+#define bdl_dekker_rem_pi_2_double ISA_NAME(bdl_dekker_rem_pi_2_double)
+#define bdl_dekker_quadrant_pi_2_float ISA_NAME(bdl_dekker_quadrant_pi_2_float)
+#define bdl_dekker_quadrant_pi_2_double ISA_NAME(bdl_dekker_quadrant_pi_2_double)
+#define ph_rem_pi_2_float ISA_NAME(ph_rem_pi_2_float)
+#define ph_rem_pi_2_double ISA_NAME(ph_rem_pi_2_double)
+#define cw_rem_pi_2_array_float ISA_NAME(cw_rem_pi_2_array_float)
+#define cw_rem_pi_2_array_double ISA_NAME(cw_rem_pi_2_array_double)
+#define bdl_rem_pi_2_array_float ISA_NAME(bdl_rem_pi_2_array_float)
+#define bdl_rem_pi_2_array_double ISA_NAME(bdl_rem_pi_2_array_double)
+#define bdl_quadrant_pi_2_array_float ISA_NAME(bdl_quadrant_pi_2_array_float)
+#define bdl_quadrant_pi_2_array_double ISA_NAME(bdl_quadrant_pi_2_array_double)
+#endif
 
 #include "cw.h"
+#include "ph.h"
 #include "reduce.h"
+#include "reduce-simd.h" // REDUCE_SIMD, _cw_rem_pi_2_simd_float, etc.
 
 /*
  * π
@@ -127,6 +173,290 @@ bdl_rem_pi_2_double(double x)
     return _bdl_rem_pi_2(x);
 }
 
+quadrant_result_float
+bdl_quadrant_pi_2_float(float x)
+{
+    return _bdl_quadrant_pi_2(x);
+}
+
+quadrant_result_double
+bdl_quadrant_pi_2_double(double x)
+{
+    return _bdl_quadrant_pi_2(x);
+}
+
+/*
+ * π∕2, without fma (bdl_reduce_dekker)
+ */
+
+rem_result_float
+bdl_dekker_rem_pi_2_float(float x)
+{
+    return bdl_reduce_dekker_float(bdl_parameters_pi_2_float, x);
+}
+
+rem_result_double
+bdl_dekker_rem_pi_2_double(double x)
+{
+    return bdl_reduce_dekker_double(bdl_parameters_pi_2_double, x);
+}
+
+quadrant_result_float
+bdl_dekker_quadrant_pi_2_float(float x)
+{
+    return bdl_reduce_quadrant_dekker_float(bdl_parameters_pi_2_float, x);
+}
+
+quadrant_result_double
+bdl_dekker_quadrant_pi_2_double(double x)
+{
+    return bdl_reduce_quadrant_dekker_double(bdl_parameters_pi_2_double, x);
+}
+
+rem_result_float
+ph_rem_pi_2_float(float x)
+{
+    return _ph_rem_pi_2(x);
+}
+
+rem_result_double
+ph_rem_pi_2_double(double x)
+{
+    return _ph_rem_pi_2(x);
+}
+
+/*
+ * π∕2, arrays
+ *
+ * The results are written as a structure of arrays (z[], v₁[], v₂[])
+ * rather than an array of rem_result structures, so that these loops
+ * can be vectorized: with the vector kernels of reduce-simd.h, block by
+ * block, and the scalar loops below for the blocks they leave, or by the
+ * compiler otherwise.
+ */
+
+static inline void
+__attribute__((always_inline))
+_cw_rem_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    int32_t *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++) {
+        rem_result_float result = _cw_rem_pi_2_select(xs[i]);
+        zs[i] = result.z;
+        v1s[i] = result.v1;
+        v2s[i] = result.v2;
+    }
+}
+
+void
+cw_rem_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    int32_t *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+#if defined(REDUCE_SIMD)
+    for (size_t i = 0; i < n; i += REDUCE_SIMD_LANES_FLOAT) {
+        size_t m = n - i < REDUCE_SIMD_LANES_FLOAT ? n - i : REDUCE_SIMD_LANES_FLOAT;
+        if (!_cw_rem_pi_2_simd_float(&xs[i], m, &zs[i], &v1s[i], &v2s[i]))
+            _cw_rem_pi_2_array_float(&xs[i], m, &zs[i], &v1s[i], &v2s[i]);
+    }
+#else
+    _cw_rem_pi_2_array_float(xs, n, zs, v1s, v2s);
+#endif
+}
+
+static inline void
+__attribute__((always_inline))
+_cw_rem_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    int64_t *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++) {
+        rem_result_double result = _cw_rem_pi_2_select(xs[i]);
+        zs[i] = result.z;
+        v1s[i] = result.v1;
+        v2s[i] = result.v2;
+    }
+}
+
+void
+cw_rem_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    int64_t *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+#if defined(REDUCE_SIMD)
+    for (size_t i = 0; i < n; i += REDUCE_SIMD_LANES_DOUBLE) {
+        size_t m = n - i < REDUCE_SIMD_LANES_DOUBLE ? n - i : REDUCE_SIMD_LANES_DOUBLE;
+        if (!_cw_rem_pi_2_simd_double(&xs[i], m, &zs[i], &v1s[i], &v2s[i]))
+            _cw_rem_pi_2_array_double(&xs[i], m, &zs[i], &v1s[i], &v2s[i]);
+    }
+#else
+    _cw_rem_pi_2_array_double(xs, n, zs, v1s, v2s);
+#endif
+}
+
+static inline void
+__attribute__((always_inline))
+_bdl_rem_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    int32_t *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++) {
+        rem_result_float result = _bdl_rem_pi_2(xs[i]);
+        zs[i] = result.z;
+        v1s[i] = result.v1;
+        v2s[i] = result.v2;
+    }
+}
+
+void
+bdl_rem_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    int32_t *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+#if defined(REDUCE_SIMD)
+    for (size_t i = 0; i < n; i += REDUCE_SIMD_LANES_FLOAT) {
+        size_t m = n - i < REDUCE_SIMD_LANES_FLOAT ? n - i : REDUCE_SIMD_LANES_FLOAT;
+        if (!_bdl_rem_pi_2_simd_float(&xs[i], m, &zs[i], &v1s[i], &v2s[i]))
+            _bdl_rem_pi_2_array_float(&xs[i], m, &zs[i], &v1s[i], &v2s[i]);
+    }
+#else
+    _bdl_rem_pi_2_array_float(xs, n, zs, v1s, v2s);
+#endif
+}
+
+static inline void
+__attribute__((always_inline))
+_bdl_rem_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    int64_t *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++) {
+        rem_result_double result = _bdl_rem_pi_2(xs[i]);
+        zs[i] = result.z;
+        v1s[i] = result.v1;
+        v2s[i] = result.v2;
+    }
+}
+
+void
+bdl_rem_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    int64_t *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+#if defined(REDUCE_SIMD)
+    for (size_t i = 0; i < n; i += REDUCE_SIMD_LANES_DOUBLE) {
+        size_t m = n - i < REDUCE_SIMD_LANES_DOUBLE ? n - i : REDUCE_SIMD_LANES_DOUBLE;
+        if (!_bdl_rem_pi_2_simd_double(&xs[i], m, &zs[i], &v1s[i], &v2s[i]))
+            _bdl_rem_pi_2_array_double(&xs[i], m, &zs[i], &v1s[i], &v2s[i]);
+    }
+#else
+    _bdl_rem_pi_2_array_double(xs, n, zs, v1s, v2s);
+#endif
+}
+
+static inline void
+__attribute__((always_inline))
+_bdl_quadrant_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    float *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++) {
+        quadrant_result_float result = _bdl_quadrant_pi_2(xs[i]);
+        zs[i] = result.z;
+        v1s[i] = result.v1;
+        v2s[i] = result.v2;
+    }
+}
+
+void
+bdl_quadrant_pi_2_array_float(
+    const float *restrict xs,
+    size_t n,
+    float *restrict zs,
+    float *restrict v1s,
+    float *restrict v2s
+) {
+#if defined(REDUCE_SIMD)
+    for (size_t i = 0; i < n; i += REDUCE_SIMD_LANES_FLOAT) {
+        size_t m = n - i < REDUCE_SIMD_LANES_FLOAT ? n - i : REDUCE_SIMD_LANES_FLOAT;
+        if (!_bdl_quadrant_pi_2_simd_float(&xs[i], m, &zs[i], &v1s[i], &v2s[i]))
+            _bdl_quadrant_pi_2_array_float(&xs[i], m, &zs[i], &v1s[i], &v2s[i]);
+    }
+#else
+    _bdl_quadrant_pi_2_array_float(xs, n, zs, v1s, v2s);
+#endif
+}
+
+static inline void
+__attribute__((always_inline))
+_bdl_quadrant_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    double *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++) {
+        quadrant_result_double result = _bdl_quadrant_pi_2(xs[i]);
+        zs[i] = result.z;
+        v1s[i] = result.v1;
+        v2s[i] = result.v2;
+    }
+}
+
+void
+bdl_quadrant_pi_2_array_double(
+    const double *restrict xs,
+    size_t n,
+    double *restrict zs,
+    double *restrict v1s,
+    double *restrict v2s
+) {
+#if defined(REDUCE_SIMD)
+    for (size_t i = 0; i < n; i += REDUCE_SIMD_LANES_DOUBLE) {
+        size_t m = n - i < REDUCE_SIMD_LANES_DOUBLE ? n - i : REDUCE_SIMD_LANES_DOUBLE;
+        if (!_bdl_quadrant_pi_2_simd_double(&xs[i], m, &zs[i], &v1s[i], &v2s[i]))
+            _bdl_quadrant_pi_2_array_double(&xs[i], m, &zs[i], &v1s[i], &v2s[i]);
+    }
+#else
+    _bdl_quadrant_pi_2_array_double(xs, n, zs, v1s, v2s);
+#endif
+}
+
 #undef NDEBUG
 static void
 __attribute__((constructor))
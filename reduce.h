@@ -6,11 +6,14 @@
 
 #include <assert.h>
 #include <math.h> // fabs, fma
-#include <stdint.h> // int32_t, int64_t
+#include <stddef.h> // size_t
+#include <stdint.h> // int32_t, int64_t, uint32_t, uint64_t
+#include <string.h> // memcpy
 
 #include "arithmetic.h" // add, mul
 #include "constants.h" // pi, etc.
-#include "types.h" // rem_result_double, tuple_double
+#include "counters.h" // COUNT, COUNT_IF
+#include "types.h" // quadrant_result_double, rem_result_double, tuple_double
 
 /*
  * Naive argument reduction (for comparison).
@@ -314,8 +317,10 @@ _bdl_correction_float(bdl_parameters_float parameters, float x, rem_result_float
     float v1 = result.v1;
     float v2 = result.v2;
     float r = v1 + v2;
+    COUNT(COUNTER_BDL_FLOAT);
     if (x < 0.0f) {
         if (r < -C) {
+            COUNT(COUNTER_BDL_CORRECTION_FLOAT);
             // v1 += C;
             v1 += C1;
             v2 += C2;
@@ -323,6 +328,7 @@ _bdl_correction_float(bdl_parameters_float parameters, float x, rem_result_float
             r = v1 + v2;
         }
         if (r > 0.0f) {
+            COUNT(COUNTER_BDL_CORRECTION_FLOAT);
             // v1 -= C;
             v1 -= C1;
             v2 -= C2;
@@ -331,6 +337,7 @@ _bdl_correction_float(bdl_parameters_float parameters, float x, rem_result_float
         }
     } else {
         if (r < 0.0f) {
+            COUNT(COUNTER_BDL_CORRECTION_FLOAT);
             // v1 += C;
             v1 += C1;
             v2 += C2;
@@ -338,6 +345,7 @@ _bdl_correction_float(bdl_parameters_float parameters, float x, rem_result_float
             r = v1 + v2;
         }
         if (r > C) {
+            COUNT(COUNTER_BDL_CORRECTION_FLOAT);
             // v1 -= C;
             v1 -= C1;
             v2 -= C2;
@@ -360,8 +368,10 @@ _bdl_correction_double(bdl_parameters_double parameters, double x, rem_result_do
     double v1 = result.v1;
     double v2 = result.v2;
     double r = v1 + v2;
+    COUNT(COUNTER_BDL_DOUBLE);
     if (x < 0.0) {
         if (r < -C) {
+            COUNT(COUNTER_BDL_CORRECTION_DOUBLE);
             // v1 += C;
             v1 += C1;
             v2 += C2;
@@ -369,6 +379,7 @@ _bdl_correction_double(bdl_parameters_double parameters, double x, rem_result_do
             r = v1 + v2;
         }
         if (r > 0.0) {
+            COUNT(COUNTER_BDL_CORRECTION_DOUBLE);
             // v1 -= C;
             v1 -= C1;
             v2 -= C2;
@@ -377,6 +388,7 @@ _bdl_correction_double(bdl_parameters_double parameters, double x, rem_result_do
         }
     } else {
         if (r < 0.0) {
+            COUNT(COUNTER_BDL_CORRECTION_DOUBLE);
             // v1 += C;
             v1 += C1;
             v2 += C2;
@@ -384,6 +396,7 @@ _bdl_correction_double(bdl_parameters_double parameters, double x, rem_result_do
             r = v1 + v2;
         }
         if (r > C) {
+            COUNT(COUNTER_BDL_CORRECTION_DOUBLE);
             // v1 -= C;
             v1 -= C1;
             v2 -= C2;
@@ -402,6 +415,82 @@ _bdl_correction_double(bdl_parameters_double parameters, double x, rem_result_do
         bdl_parameters_double: _bdl_correction_double \
     )(parameters, x, result)
 
+/*
+ * Same as _bdl_correction, without branches, for vectorized loops.
+ * If x < 0, then v₁+v₂ must be in [-C, 0], otherwise in [0, C].
+ * Only arguments with |x| ≥ large are corrected.
+ */
+
+static inline rem_result_float
+__attribute__((always_inline))
+_bdl_correction_select_float(bdl_parameters_float parameters, float x, float large, rem_result_float result)
+{
+    float C = parameters.C;
+    float C1 = parameters.C1;
+    float C2 = parameters.C2;
+    int32_t z = result.z;
+    float v1 = result.v1;
+    float v2 = result.v2;
+    float r = v1 + v2;
+    int correct = (x <= -large) | (x >= large);
+    float lower = x < 0.0f ? -C : 0.0f;
+    float upper = x < 0.0f ? 0.0f : C;
+    COUNT_IF(correct, COUNTER_BDL_FLOAT);
+    int below = correct & (r < lower);
+    COUNT_IF(below, COUNTER_BDL_CORRECTION_FLOAT);
+    v1 += below ? C1 : -0.0f;
+    v2 += below ? C2 : -0.0f;
+    z -= below;
+    r = v1 + v2;
+    int above = correct & (r > upper);
+    COUNT_IF(above, COUNTER_BDL_CORRECTION_FLOAT);
+    v1 -= above ? C1 : 0.0f;
+    v2 -= above ? C2 : 0.0f;
+    z += above;
+    r = v1 + v2;
+    assert(!correct || r >= -C);
+    assert(!correct || r <= C);
+    return (rem_result_float) {z, v1, v2};
+}
+
+static inline rem_result_double
+__attribute__((always_inline))
+_bdl_correction_select_double(bdl_parameters_double parameters, double x, double large, rem_result_double result)
+{
+    double C = parameters.C;
+    double C1 = parameters.C1;
+    double C2 = parameters.C2;
+    int64_t z = result.z;
+    double v1 = result.v1;
+    double v2 = result.v2;
+    double r = v1 + v2;
+    int correct = (x <= -large) | (x >= large);
+    double lower = x < 0.0 ? -C : 0.0;
+    double upper = x < 0.0 ? 0.0 : C;
+    COUNT_IF(correct, COUNTER_BDL_DOUBLE);
+    int below = correct & (r < lower);
+    COUNT_IF(below, COUNTER_BDL_CORRECTION_DOUBLE);
+    v1 += below ? C1 : -0.0;
+    v2 += below ? C2 : -0.0;
+    z -= below;
+    r = v1 + v2;
+    int above = correct & (r > upper);
+    COUNT_IF(above, COUNTER_BDL_CORRECTION_DOUBLE);
+    v1 -= above ? C1 : 0.0;
+    v2 -= above ? C2 : 0.0;
+    z += above;
+    r = v1 + v2;
+    assert(!correct || r >= -C);
+    assert(!correct || r <= C);
+    return (rem_result_double) {z, v1, v2};
+}
+
+#define _bdl_correction_select(parameters, x, large, result) \
+    _Generic((parameters), \
+        bdl_parameters_float: _bdl_correction_select_float, \
+        bdl_parameters_double: _bdl_correction_select_double \
+    )(parameters, x, large, result)
+
 /*
  * Reduce an argument x to the range [0, C], given C = C₁ + C₂, R = 1∕C,
  * C₁ and C₂ meet the requirement of Theorem 6, using Algorithm 5.1. [1]
@@ -428,7 +517,7 @@ bdl_reduce_float(bdl_parameters_float parameters, float x)
      * z may be off by one or two.
      * Correct {z, v1, v2} such that 0 ≤ |v₁+v₂| ≤ C.
      */
-    result = _bdl_correction(parameters, x, result);
+    result = _bdl_correction_select(parameters, x, 0.0f, result);
     return result;
 }
 
@@ -452,16 +541,261 @@ bdl_reduce_double(bdl_parameters_double parameters, double x)
      * z may be off by one or two.
      * Correct {z, v1, v2} such that 0 ≤ |v₁+v₂| ≤ C.
      */
-    if (x <= -0x1.0p24 || x >= 0x1.0p24)
-        result = _bdl_correction(parameters, x, result);
+    result = _bdl_correction_select(parameters, x, 0x1.0p24, result);
     return result;
 }
 
+/*
+ * Same as bdl_reduce, without fma, for processors without it:
+ * the products z⋅C₁ and z⋅C₂ are exact with mul_dekker, and
+ * x - z⋅C₁ is exact (Sterbenz, and Theorem 6 [1]), so u is the same;
+ * v₁ may differ from fma(-z, C₂, u) in the last bit, and v₂ makes up
+ * for it. x⋅R is rounded before the bias is added, so z may be off by
+ * one more often, and every result is corrected.
+ */
+
+static inline rem_result_float
+bdl_reduce_dekker_float(bdl_parameters_float parameters, float x)
+{
+    float C1 = parameters.C1;
+    float C2 = parameters.C2;
+    float R = parameters.R;
+
+    int32_t z = (int32_t) ((x * R + BIAS_FLOAT) - BIAS_FLOAT);
+    tuple_float p1 = mul_dekker_float((float) z, C1);
+    float u = (x - p1.a) - p1.b;
+    tuple_float p = mul_dekker_float((float) z, C2);
+    tuple_float t = add(u, -p.a);
+    float v1 = t.a + (t.b - p.b);
+    float v2 = ((t.a - v1) + t.b) - p.b;
+
+    rem_result_float result = {z, v1, v2};
+    result = _bdl_correction_select(parameters, x, 0.0f, result);
+    return result;
+}
+
+static inline rem_result_double
+bdl_reduce_dekker_double(bdl_parameters_double parameters, double x)
+{
+    double C1 = parameters.C1;
+    double C2 = parameters.C2;
+    double R = parameters.R;
+
+    int64_t z = (int64_t) ((x * R + BIAS_DOUBLE) - BIAS_DOUBLE);
+    tuple_double p1 = mul_dekker_double((double) z, C1);
+    double u = (x - p1.a) - p1.b;
+    tuple_double p = mul_dekker_double((double) z, C2);
+    tuple_double t = add(u, -p.a);
+    double v1 = t.a + (t.b - p.b);
+    double v2 = ((t.a - v1) + t.b) - p.b;
+
+    rem_result_double result = {z, v1, v2};
+    result = _bdl_correction_select(parameters, x, 0.0, result);
+    return result;
+}
+
+/*
+ * bdl_reduce is the fma variant with a fast fma (arithmetic.h),
+ * and the Dekker variant otherwise.
+ */
+
+#if defined(ARITHMETIC_FMA)
 #define bdl_reduce(parameters, x) \
     _Generic((parameters), \
         bdl_parameters_float: bdl_reduce_float, \
         bdl_parameters_double: bdl_reduce_double \
     )(parameters, x)
+#else
+#define bdl_reduce(parameters, x) \
+    _Generic((parameters), \
+        bdl_parameters_float: bdl_reduce_dekker_float, \
+        bdl_parameters_double: bdl_reduce_dekker_double \
+    )(parameters, x)
+#endif
+
+/*
+ * Reduce an argument x as bdl_reduce does, but keep the quotient in the
+ * floating-point domain, so that there is no conversion to an integer.
+ * With σ = 3⋅2ᵖ⁻² (N = 0 in §III [1]), fma(x⋅R + σ) = k + σ where k is
+ * the integer nearest to x⋅R, and its low bits are the low bits of k.
+ * Returns (z, v₁, v₂) such that z = k + σ, x = k⋅(C₁ + C₂) + v₁ + v₂,
+ * and v₁+v₂ is in [0, C] if x ≥ 0, in [-C, 0] otherwise.
+ */
+
+// σ = 3⋅2²² = bias_float(0)
+#define QUADRANT_BIAS_FLOAT     (0x3p+22f)
+
+// σ = 3⋅2⁵¹ = bias_double(0)
+#define QUADRANT_BIAS_DOUBLE    (0x3p+51)
+
+static inline quadrant_result_float
+__attribute__((always_inline))
+__attribute__((const))
+bdl_reduce_quadrant_float(bdl_parameters_float parameters, float x)
+{
+    float C1 = parameters.C1;
+    float C2 = parameters.C2;
+    float R = parameters.R;
+    const float bias = QUADRANT_BIAS_FLOAT;
+
+    float z = fmaf(x, R, bias);
+    float k = z - bias;
+    float u = fmaf(-k, C1, x);
+    float v1 = fmaf(-k, C2, u);
+    tuple_float p = mul(k, C2);
+    tuple_float t = add(u, -p.a);
+    float v2 = ((t.a - v1) + t.b) - p.b;
+
+    /*
+     * k is rounded to nearest, so v₁+v₂ may have the wrong sign.
+     * See _cw_correction_select.
+     */
+    float r = v1 + v2;
+    int up = (x >= 0.0f) & (r < 0.0f); // r += C
+    int down = (x < 0.0f) & (r > 0.0f); // r -= C
+    v1 += up ? C1 : (down ? -C1 : -0.0f);
+    v2 += up ? C2 : (down ? -C2 : -0.0f);
+    z += up ? -1.0f : (down ? 1.0f : 0.0f);
+    return (quadrant_result_float) {z, v1, v2};
+}
+
+static inline quadrant_result_double
+__attribute__((always_inline))
+__attribute__((const))
+bdl_reduce_quadrant_double(bdl_parameters_double parameters, double x)
+{
+    double C1 = parameters.C1;
+    double C2 = parameters.C2;
+    double R = parameters.R;
+    const double bias = QUADRANT_BIAS_DOUBLE;
+
+    double z = fma(x, R, bias);
+    double k = z - bias;
+    double u = fma(-k, C1, x);
+    double v1 = fma(-k, C2, u);
+    tuple_double p = mul(k, C2);
+    tuple_double t = add(u, -p.a);
+    double v2 = ((t.a - v1) + t.b) - p.b;
+
+    /*
+     * k is rounded to nearest, so v₁+v₂ may have the wrong sign.
+     * See _cw_correction_select.
+     */
+    double r = v1 + v2;
+    int up = (x >= 0.0) & (r < 0.0); // r += C
+    int down = (x < 0.0) & (r > 0.0); // r -= C
+    v1 += up ? C1 : (down ? -C1 : -0.0);
+    v2 += up ? C2 : (down ? -C2 : -0.0);
+    z += up ? -1.0 : (down ? 1.0 : 0.0);
+    return (quadrant_result_double) {z, v1, v2};
+}
+
+/*
+ * Same as bdl_reduce_quadrant, without fma (see bdl_reduce_dekker).
+ * k may be the other integer nearest to x⋅R, which the correction of the
+ * sign of v₁+v₂ allows.
+ */
+
+static inline quadrant_result_float
+__attribute__((always_inline))
+__attribute__((const))
+bdl_reduce_quadrant_dekker_float(bdl_parameters_float parameters, float x)
+{
+    float C1 = parameters.C1;
+    float C2 = parameters.C2;
+    float R = parameters.R;
+    const float bias = QUADRANT_BIAS_FLOAT;
+
+    float z = x * R + bias;
+    float k = z - bias;
+    tuple_float p1 = mul_dekker_float(k, C1);
+    float u = (x - p1.a) - p1.b;
+    tuple_float p = mul_dekker_float(k, C2);
+    tuple_float t = add(u, -p.a);
+    float v1 = t.a + (t.b - p.b);
+    float v2 = ((t.a - v1) + t.b) - p.b;
+
+    float r = v1 + v2;
+    int up = (x >= 0.0f) & (r < 0.0f); // r += C
+    int down = (x < 0.0f) & (r > 0.0f); // r -= C
+    v1 += up ? C1 : (down ? -C1 : -0.0f);
+    v2 += up ? C2 : (down ? -C2 : -0.0f);
+    z += up ? -1.0f : (down ? 1.0f : 0.0f);
+    return (quadrant_result_float) {z, v1, v2};
+}
+
+static inline quadrant_result_double
+__attribute__((always_inline))
+__attribute__((const))
+bdl_reduce_quadrant_dekker_double(bdl_parameters_double parameters, double x)
+{
+    double C1 = parameters.C1;
+    double C2 = parameters.C2;
+    double R = parameters.R;
+    const double bias = QUADRANT_BIAS_DOUBLE;
+
+    double z = x * R + bias;
+    double k = z - bias;
+    tuple_double p1 = mul_dekker_double(k, C1);
+    double u = (x - p1.a) - p1.b;
+    tuple_double p = mul_dekker_double(k, C2);
+    tuple_double t = add(u, -p.a);
+    double v1 = t.a + (t.b - p.b);
+    double v2 = ((t.a - v1) + t.b) - p.b;
+
+    double r = v1 + v2;
+    int up = (x >= 0.0) & (r < 0.0); // r += C
+    int down = (x < 0.0) & (r > 0.0); // r -= C
+    v1 += up ? C1 : (down ? -C1 : -0.0);
+    v2 += up ? C2 : (down ? -C2 : -0.0);
+    z += up ? -1.0 : (down ? 1.0 : 0.0);
+    return (quadrant_result_double) {z, v1, v2};
+}
+
+#if defined(ARITHMETIC_FMA)
+#define bdl_reduce_quadrant(parameters, x) \
+    _Generic((parameters), \
+        bdl_parameters_float: bdl_reduce_quadrant_float, \
+        bdl_parameters_double: bdl_reduce_quadrant_double \
+    )(parameters, x)
+#else
+#define bdl_reduce_quadrant(parameters, x) \
+    _Generic((parameters), \
+        bdl_parameters_float: bdl_reduce_quadrant_dekker_float, \
+        bdl_parameters_double: bdl_reduce_quadrant_dekker_double \
+    )(parameters, x)
+#endif
+
+/*
+ * Return k mod 4, given z = k + σ.
+ * This is a bitwise and, which is vectorized without a conversion.
+ */
+
+static inline uint32_t
+__attribute__((always_inline))
+__attribute__((const))
+_quadrant_float(float z)
+{
+    uint32_t bits;
+    memcpy(&bits, &z, sizeof bits);
+    return bits & 3;
+}
+
+static inline uint64_t
+__attribute__((always_inline))
+__attribute__((const))
+_quadrant_double(double z)
+{
+    uint64_t bits;
+    memcpy(&bits, &z, sizeof bits);
+    return bits & 3;
+}
+
+#define _quadrant(z) \
+    _Generic((z), \
+        float: _quadrant_float, \
+        double: _quadrant_double \
+    )(z)
 
 /*
  * Return the quotient z and remainder (v₁+v₂) of x∕C
@@ -528,6 +862,35 @@ _bdl_rem_pi_2_double(double x)
         double: _bdl_rem_pi_2_double \
     )(x)
 
+/*
+ * Same as _bdl_rem_pi_2, but return z = k + σ rather than k.
+ * z stays in the binade of σ, and k is exact, only if |k| < 2ᵖ⁻²,
+ * that is, |x| < 2²²⋅π∕2 (float) or |x| < 2⁵¹⋅π∕2 (double).
+ * See test-reduce-quadrant.txt.
+ */
+
+static inline quadrant_result_float
+__attribute__((always_inline))
+__attribute__((const))
+_bdl_quadrant_pi_2_float(float x)
+{
+    return bdl_reduce_quadrant(bdl_parameters_pi_2_float, x);
+}
+
+static inline quadrant_result_double
+__attribute__((always_inline))
+__attribute__((const))
+_bdl_quadrant_pi_2_double(double x)
+{
+    return bdl_reduce_quadrant(bdl_parameters_pi_2_double, x);
+}
+
+#define _bdl_quadrant_pi_2(x) \
+    _Generic((x), \
+        float: _bdl_quadrant_pi_2_float, \
+        double: _bdl_quadrant_pi_2_double \
+    )(x)
+
 rem_result_float naive_rem_pi_float(float x);
 rem_result_float naive_rem_2pi_float(float x);
 rem_result_float naive_rem_pi_2_float(float x);
@@ -580,3 +943,69 @@ rem_result_double bdl_rem_pi_2_double(double x);
         float: bdl_rem_pi_2_float, \
         double: bdl_rem_pi_2_double \
     )(x)
+
+rem_result_float bdl_dekker_rem_pi_2_float(float x);
+rem_result_double bdl_dekker_rem_pi_2_double(double x);
+quadrant_result_float bdl_dekker_quadrant_pi_2_float(float x);
+quadrant_result_double bdl_dekker_quadrant_pi_2_double(double x);
+
+void cw_rem_pi_2_array_float(
+    const float *restrict xs, size_t n,
+    int32_t *restrict zs, float *restrict v1s, float *restrict v2s
+);
+void cw_rem_pi_2_array_double(
+    const double *restrict xs, size_t n,
+    int64_t *restrict zs, double *restrict v1s, double *restrict v2s
+);
+void bdl_rem_pi_2_array_float(
+    const float *restrict xs, size_t n,
+    int32_t *restrict zs, float *restrict v1s, float *restrict v2s
+);
+void bdl_rem_pi_2_array_double(
+    const double *restrict xs, size_t n,
+    int64_t *restrict zs, double *restrict v1s, double *restrict v2s
+);
+
+#define cw_rem_pi_2_array(xs, n, zs, v1s, v2s) \
+    _Generic((xs)[0], \
+        float: cw_rem_pi_2_array_float, \
+        double: cw_rem_pi_2_array_double \
+    )(xs, n, zs, v1s, v2s)
+#define bdl_rem_pi_2_array(xs, n, zs, v1s, v2s) \
+    _Generic((xs)[0], \
+        float: bdl_rem_pi_2_array_float, \
+        double: bdl_rem_pi_2_array_double \
+    )(xs, n, zs, v1s, v2s)
+
+quadrant_result_float bdl_quadrant_pi_2_float(float x);
+quadrant_result_double bdl_quadrant_pi_2_double(double x);
+
+#define bdl_quadrant_pi_2(x) \
+    _Generic((x), \
+        float: bdl_quadrant_pi_2_float, \
+        double: bdl_quadrant_pi_2_double \
+    )(x)
+
+void bdl_quadrant_pi_2_array_float(
+    const float *restrict xs, size_t n,
+    float *restrict zs, float *restrict v1s, float *restrict v2s
+);
+void bdl_quadrant_pi_2_array_double(
+    const double *restrict xs, size_t n,
+    double *restrict zs, double *restrict v1s, double *restrict v2s
+);
+
+#define bdl_quadrant_pi_2_array(xs, n, zs, v1s, v2s) \
+    _Generic((xs)[0], \
+        float: bdl_quadrant_pi_2_array_float, \
+        double: bdl_quadrant_pi_2_array_double \
+    )(xs, n, zs, v1s, v2s)
+
+rem_result_float ph_rem_pi_2_float(float x);
+rem_result_double ph_rem_pi_2_double(double x);
+
+#define ph_rem_pi_2(x) \
+    _Generic((x), \
+        float: ph_rem_pi_2_float, \
+        double: ph_rem_pi_2_double \
+    )(x)
@@ -0,0 +1,49 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#pragma once
+
+/*
+ * The format of the reference file written by gen-reference.c and read
+ * by test-reference.c: a header, then the float records, then the double
+ * records, in the byte order of the machine.
+ *
+ * Each record holds an argument x and, correctly rounded (MPFR), sin(x),
+ * cos(x) and the remainder r of x ÷ π∕2, with the quotient q = trunc(x ÷ π∕2),
+ * or, beyond the thresholds of Payne-Hanek, q modulo 4 (with the sign of x).
+ * The arguments are drawn in [-m, m] for each magnitude m of magnitudes.h,
+ * the same number for each.
+ */
+
+#include <stddef.h> // size_t
+#include <stdint.h> // int32_t, int64_t, uint32_t, uint64_t
+
+#include "magnitudes.h"
+
+#define REFERENCE_MAGIC "funlibm"
+#define REFERENCE_VERSION 2
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size_float; // sizeof (reference_float)
+    uint32_t record_size_double; // sizeof (reference_double)
+    uint32_t n_per_magnitude;
+    uint64_t n_float;
+    uint64_t n_double;
+} reference_header;
+
+typedef struct {
+    float x;
+    float sin;
+    float cos;
+    float r;
+    int32_t q;
+} reference_float;
+
+typedef struct {
+    double x;
+    double sin;
+    double cos;
+    double r;
+    int64_t q;
+} reference_double;
@@ -0,0 +1,422 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Generate the coefficients of the polynomials of sin.h, cos.h and exp.c:
+ *
+ *     sin(x) ≅ x + x³⋅S(x²)
+ *     cos(x) ≅ 1 - x²∕2 + x⁴⋅C(x²)
+ *     exp(x) ≅ 1 + x + x²⋅E(x)
+ *
+ * for x in [0, π∕4], or [-ln 2∕d, ln 2∕d] for exp, where S, C and E
+ * minimize the relative error of sin(x), cos(x) and exp(x), using the
+ * Remez exchange algorithm. [1]
+ * Only the even (cos) or odd (sin) powers of x are needed, so the
+ * polynomials are in t = x², of about half the degree; that of exp is
+ * in t = x.
+ *
+ * The coefficients are rounded to the target precision one at a time,
+ * each time solving again for the remaining coefficients, so that the
+ * rounding errors are compensated by the higher degree terms. [2]
+ *
+ * Usage: ./remez sin|cos|exp float|double [number of coefficients [d]]
+ *
+ * Without a number of coefficients (or with 0), find the smallest number
+ * such that the relative error is less than 1∕16 ulp (2⁻ᵖ⁻⁴).
+ * The interval is [0, π∕d], by default π∕4 for sin.h and cos.h;
+ * sincos-table.h uses π∕128 (the tables are then named _*_table_as_*).
+ * For exp, the interval is [-ln 2∕d, ln 2∕d], by default ln 2∕128 for the
+ * table of 2^(j∕128) of exp.c.
+ *
+ * [1] J.-M. Muller. Elementary Functions: Algorithms and Implementation,
+ *     3rd edition. Birkhäuser, 2016. Chapter 3.
+ *
+ * [2] N. Brisebarre, J.-M. Muller, and A. Tisserand. Computing machine-
+ *     efficient polynomial approximations. ACM Trans. Math. Softw. 32, 2
+ *     (June 2006), 236–256.
+ */
+
+#include <assert.h>
+#include <math.h> // fabs, log2
+#include <stdio.h>
+#include <stdlib.h> // atoi
+#include <string.h> // strcmp
+
+#include <mpfr.h>
+
+static const mpfr_prec_t mp_precision = 512;
+
+#define MAX_COEFFICIENTS 16
+#define GRID_SIZE 8192
+
+// t = x² in [2⁻⁴⁰, (π∕d)²], or t = x in [-ln 2∕d, ln 2∕d], with a small margin
+static double t_min = 0x1.0p-40;
+static double t_max = 0.62;
+
+/*
+ * sin: f(t) = (sin(√t) - √t) ∕ t√t, w(t) = t√t ∕ sin(√t)
+ * cos: f(t) = (cos(√t) - 1 + t∕2) ∕ t², w(t) = t² ∕ cos(√t)
+ * exp: f(t) = (exp(t) - 1 - t) ∕ t², w(t) = t² ∕ exp(t)
+ * such that w⋅(P - f) is the relative error of sin, cos or exp.
+ */
+
+static void
+sin_f_w(mpfr_t f, mpfr_t w, const mpfr_t t)
+{
+    mpfr_t s, y;
+    mpfr_init2(s, mp_precision);
+    mpfr_init2(y, mp_precision);
+    mpfr_sqrt(s, t, MPFR_RNDN);
+    mpfr_sin(y, s, MPFR_RNDN);
+    mpfr_mul(w, t, s, MPFR_RNDN);
+    mpfr_sub(f, y, s, MPFR_RNDN);
+    mpfr_div(f, f, w, MPFR_RNDN);
+    mpfr_div(w, w, y, MPFR_RNDN);
+    mpfr_clear(y);
+    mpfr_clear(s);
+}
+
+static void
+cos_f_w(mpfr_t f, mpfr_t w, const mpfr_t t)
+{
+    mpfr_t s, y;
+    mpfr_init2(s, mp_precision);
+    mpfr_init2(y, mp_precision);
+    mpfr_sqrt(s, t, MPFR_RNDN);
+    mpfr_cos(y, s, MPFR_RNDN);
+    mpfr_sqr(w, t, MPFR_RNDN);
+    mpfr_sub_ui(f, y, 1, MPFR_RNDN);
+    mpfr_div_ui(s, t, 2, MPFR_RNDN);
+    mpfr_add(f, f, s, MPFR_RNDN);
+    mpfr_div(f, f, w, MPFR_RNDN);
+    mpfr_div(w, w, y, MPFR_RNDN);
+    mpfr_clear(y);
+    mpfr_clear(s);
+}
+
+static void
+exp_f_w(mpfr_t f, mpfr_t w, const mpfr_t t)
+{
+    mpfr_t y;
+    mpfr_init2(y, mp_precision);
+    mpfr_exp(y, t, MPFR_RNDN);
+    mpfr_sqr(w, t, MPFR_RNDN);
+    mpfr_sub_ui(f, y, 1, MPFR_RNDN);
+    mpfr_sub(f, f, t, MPFR_RNDN);
+    mpfr_div(f, f, w, MPFR_RNDN);
+    mpfr_div(w, w, y, MPFR_RNDN);
+    mpfr_clear(y);
+}
+
+static mpfr_t ts[GRID_SIZE]; // grid
+static mpfr_t fs[GRID_SIZE]; // function to approximate
+static mpfr_t ws[GRID_SIZE]; // weight
+static mpfr_t es[GRID_SIZE]; // weighted error
+
+static void
+eval(mpfr_t y, const mpfr_t cs[], int n, const mpfr_t t)
+{
+    mpfr_set(y, cs[n - 1], MPFR_RNDN);
+    for (int j = n - 2; j >= 0; j--) {
+        mpfr_mul(y, y, t, MPFR_RNDN);
+        mpfr_add(y, y, cs[j], MPFR_RNDN);
+    }
+}
+
+/*
+ * Compute the weighted error on the grid and return its maximum.
+ */
+
+static double
+weighted_error(const mpfr_t cs[], int n)
+{
+    double max = 0.0;
+    for (int i = 0; i < GRID_SIZE; i++) {
+        eval(es[i], cs, n, ts[i]);
+        mpfr_sub(es[i], es[i], fs[i], MPFR_RNDN);
+        mpfr_mul(es[i], es[i], ws[i], MPFR_RNDN);
+        double e = fabs(mpfr_get_d(es[i], MPFR_RNDN));
+        if (e > max)
+            max = e;
+    }
+    return max;
+}
+
+/*
+ * Solve A⋅x = b in place by Gaussian elimination with partial pivoting.
+ */
+
+static void
+solve(mpfr_t A[][MAX_COEFFICIENTS + 1], mpfr_t b[], int m)
+{
+    mpfr_t r, x;
+    mpfr_init2(r, mp_precision);
+    mpfr_init2(x, mp_precision);
+    for (int k = 0; k < m; k++) {
+        int p = k;
+        for (int i = k + 1; i < m; i++)
+            if (mpfr_cmpabs(A[i][k], A[p][k]) > 0)
+                p = i;
+        for (int j = 0; j < m; j++)
+            mpfr_swap(A[k][j], A[p][j]);
+        mpfr_swap(b[k], b[p]);
+        assert(!mpfr_zero_p(A[k][k]));
+        for (int i = k + 1; i < m; i++) {
+            mpfr_div(r, A[i][k], A[k][k], MPFR_RNDN);
+            for (int j = k; j < m; j++) {
+                mpfr_mul(x, r, A[k][j], MPFR_RNDN);
+                mpfr_sub(A[i][j], A[i][j], x, MPFR_RNDN);
+            }
+            mpfr_mul(r, r, b[k], MPFR_RNDN);
+            mpfr_sub(b[i], b[i], r, MPFR_RNDN);
+        }
+    }
+    for (int k = m - 1; k >= 0; k--) {
+        for (int j = k + 1; j < m; j++) {
+            mpfr_mul(r, A[k][j], b[j], MPFR_RNDN);
+            mpfr_sub(b[k], b[k], r, MPFR_RNDN);
+        }
+        mpfr_div(b[k], b[k], A[k][k], MPFR_RNDN);
+    }
+    mpfr_clear(x);
+    mpfr_clear(r);
+}
+
+/*
+ * Find the n coefficients cs of the polynomial that minimizes
+ * max |w⋅(P - f)| on the grid. Returns the minimax error.
+ */
+
+static double
+remez(mpfr_t cs[], int n)
+{
+    int m = n + 1; // number of reference points
+    int refs[MAX_COEFFICIENTS + 1];
+    // The grid is distributed as Chebyshev nodes,
+    // so start with evenly spaced indices.
+    for (int k = 0; k < m; k++)
+        refs[k] = (int) ((long) (GRID_SIZE - 1) * k / (m - 1));
+
+    mpfr_t A[MAX_COEFFICIENTS + 1][MAX_COEFFICIENTS + 1];
+    mpfr_t b[MAX_COEFFICIENTS + 1];
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++)
+            mpfr_init2(A[i][j], mp_precision);
+        mpfr_init2(b[i], mp_precision);
+    }
+
+    double max_error = 0.0;
+    for (int iteration = 0; iteration < 100; iteration++) {
+        // P(tₖ) + (-1)ᵏ⋅E∕w(tₖ) = f(tₖ)
+        for (int k = 0; k < m; k++) {
+            mpfr_set_ui(A[k][0], 1, MPFR_RNDN);
+            for (int j = 1; j < n; j++)
+                mpfr_mul(A[k][j], A[k][j - 1], ts[refs[k]], MPFR_RNDN);
+            mpfr_ui_div(A[k][n], 1, ws[refs[k]], MPFR_RNDN);
+            if (k % 2 != 0)
+                mpfr_neg(A[k][n], A[k][n], MPFR_RNDN);
+            mpfr_set(b[k], fs[refs[k]], MPFR_RNDN);
+        }
+        solve(A, b, m);
+        for (int j = 0; j < n; j++)
+            mpfr_set(cs[j], b[j], MPFR_RNDN);
+        max_error = weighted_error((const mpfr_t *) cs, n);
+
+        // One extremum per run of the same sign.
+        int extrema[GRID_SIZE];
+        int count = 0;
+        for (int i = 0; i < GRID_SIZE; i++) {
+            int sign = mpfr_sgn(es[i]);
+            if (sign == 0)
+                continue;
+            if (count > 0 && mpfr_sgn(es[extrema[count - 1]]) == sign) {
+                if (mpfr_cmpabs(es[i], es[extrema[count - 1]]) > 0)
+                    extrema[count - 1] = i;
+            } else {
+                extrema[count++] = i;
+            }
+        }
+        if (count < m)
+            break;
+        // Keep m alternating extrema, dropping the smallest at either end.
+        int first = 0;
+        while (count > m) {
+            if (mpfr_cmpabs(es[extrema[first]], es[extrema[first + count - 1]]) < 0)
+                first++;
+            count--;
+        }
+        double min_error = max_error;
+        for (int k = 0; k < m; k++) {
+            refs[k] = extrema[first + k];
+            double e = fabs(mpfr_get_d(es[refs[k]], MPFR_RNDN));
+            if (e < min_error)
+                min_error = e;
+        }
+        if (max_error - min_error <= 0x1.0p-20 * max_error)
+            break;
+    }
+
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++)
+            mpfr_clear(A[i][j]);
+        mpfr_clear(b[i]);
+    }
+    return max_error;
+}
+
+/*
+ * Find the coefficients, rounded to p bits, one at a time: round the first
+ * coefficient c₀, then approximate (f - c₀)∕t with the weight w⋅t, etc.
+ * Returns the maximum relative error with the rounded coefficients.
+ */
+
+static double
+remez_rounded(
+    void (*f_w)(mpfr_t f, mpfr_t w, const mpfr_t t),
+    mpfr_prec_t p,
+    double cs[],
+    int n
+) {
+    mpfr_t mp_cs[MAX_COEFFICIENTS];
+    for (int j = 0; j < n; j++)
+        mpfr_init2(mp_cs[j], mp_precision);
+
+    for (int i = 0; i < GRID_SIZE; i++)
+        (*f_w)(fs[i], ws[i], ts[i]);
+    for (int k = 0; k < n; k++) {
+        remez(mp_cs, n - k);
+        mpfr_prec_round(mp_cs[0], p, MPFR_RNDN);
+        cs[k] = mpfr_get_d(mp_cs[0], MPFR_RNDN);
+        for (int i = 0; i < GRID_SIZE; i++) {
+            mpfr_sub(fs[i], fs[i], mp_cs[0], MPFR_RNDN);
+            mpfr_div(fs[i], fs[i], ts[i], MPFR_RNDN);
+            mpfr_mul(ws[i], ws[i], ts[i], MPFR_RNDN);
+        }
+    }
+
+    // the relative error of the rounded polynomial
+    for (int i = 0; i < GRID_SIZE; i++)
+        (*f_w)(fs[i], ws[i], ts[i]);
+    for (int j = 0; j < n; j++)
+        mpfr_set_d(mp_cs[j], cs[j], MPFR_RNDN);
+    double error = weighted_error((const mpfr_t *) mp_cs, n);
+
+    for (int j = 0; j < n; j++)
+        mpfr_clear(mp_cs[j]);
+    return error;
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc < 3 || argc > 5) {
+        fprintf(stderr, "usage: %s sin|cos|exp float|double [n [d]]\n", argv[0]);
+        return 1;
+    }
+    const char *name = argv[1];
+    const char *type = argv[2];
+    void (*f_w)(mpfr_t f, mpfr_t w, const mpfr_t t) = NULL;
+    int power = 0; // the power of x of the first coefficient
+    int step = 2; // the powers of x of t
+    if (strcmp(name, "sin") == 0) {
+        f_w = &sin_f_w;
+        power = 3;
+    } else if (strcmp(name, "cos") == 0) {
+        f_w = &cos_f_w;
+        power = 4;
+    } else if (strcmp(name, "exp") == 0) {
+        f_w = &exp_f_w;
+        power = 2;
+        step = 1;
+    }
+    mpfr_prec_t p = 0;
+    if (strcmp(type, "float") == 0)
+        p = 24;
+    else if (strcmp(type, "double") == 0)
+        p = 53;
+    if (f_w == NULL || p == 0) {
+        fprintf(stderr, "usage: %s sin|cos|exp float|double [n [d]]\n", argv[0]);
+        return 1;
+    }
+    int n_min = 1;
+    int n_max = MAX_COEFFICIENTS;
+    if (argc >= 4 && atoi(argv[3]) != 0)
+        n_min = n_max = atoi(argv[3]);
+    if (n_min < 1 || n_max > MAX_COEFFICIENTS) {
+        fprintf(stderr, "%s: n must be in [1, %i]\n", argv[0], MAX_COEFFICIENTS);
+        return 1;
+    }
+    int d = step == 1 ? 128 : 4;
+    if (argc == 5)
+        d = atoi(argv[4]);
+    if (d < 4) {
+        fprintf(stderr, "%s: d must be at least 4\n", argv[0]);
+        return 1;
+    }
+    if (step == 1) {
+        t_max = 0.7 / d;
+        t_min = -t_max;
+    } else {
+        t_max *= (4.0 / d) * (4.0 / d);
+    }
+
+    // Chebyshev nodes on [t_min, t_max]
+    mpfr_t pi;
+    mpfr_init2(pi, mp_precision);
+    mpfr_const_pi(pi, MPFR_RNDN);
+    for (int i = 0; i < GRID_SIZE; i++) {
+        mpfr_init2(ts[i], mp_precision);
+        mpfr_init2(fs[i], mp_precision);
+        mpfr_init2(ws[i], mp_precision);
+        mpfr_init2(es[i], mp_precision);
+        mpfr_mul_ui(ts[i], pi, i, MPFR_RNDN);
+        mpfr_div_ui(ts[i], ts[i], GRID_SIZE - 1, MPFR_RNDN);
+        mpfr_cos(ts[i], ts[i], MPFR_RNDN);
+        mpfr_ui_sub(ts[i], 1, ts[i], MPFR_RNDN);
+        mpfr_mul_d(ts[i], ts[i], (t_max - t_min) / 2.0, MPFR_RNDN);
+        mpfr_add_d(ts[i], ts[i], t_min, MPFR_RNDN);
+    }
+    mpfr_clear(pi);
+
+    double target = ldexp(1.0, -(int) p - 4);
+    double cs[MAX_COEFFICIENTS];
+    double error = 0.0;
+    int n = n_min;
+    for (; n <= n_max; n++) {
+        error = remez_rounded(f_w, p, cs, n);
+        if (error < target)
+            break;
+    }
+    if (n > n_max)
+        n = n_max;
+
+    printf("/*\n");
+    if (power == 3)
+        printf(" * sin(x) ≅ x + x³⋅S(x²) on [0, π∕%i],\n", d);
+    else if (power == 4)
+        printf(" * cos(x) ≅ 1 - x²∕2 + x⁴⋅C(x²) on [0, π∕%i],\n", d);
+    else
+        printf(" * exp(x) ≅ 1 + x + x²⋅E(x) on [-ln 2∕%i, ln 2∕%i],\n", d, d);
+    if (d == 4 || (step == 1 && d == 128))
+        printf(" * relative error < 2^%.1f (./remez %s %s %i).\n", log2(error), name, type, n);
+    else
+        printf(" * relative error < 2^%.1f (./remez %s %s %i %i).\n", log2(error), name, type, n, d);
+    printf(" */\n");
+    printf("\n");
+    const char *table = d == 4 || step == 1 ? "" : "_table";
+    printf("static const %s _%s%s_as_%s[%i] = {\n", type, name, table, type, n);
+    for (int j = 0; j < n; j++) {
+        if (p == 24)
+            printf("    /* x^%i */ %.9ef,\n", power + step * j, cs[j]);
+        else
+            printf("    /* x^%i */ %.17e,\n", power + step * j, cs[j]);
+    }
+    printf("};\n");
+
+    for (int i = 0; i < GRID_SIZE; i++) {
+        mpfr_clear(es[i]);
+        mpfr_clear(ws[i]);
+        mpfr_clear(fs[i]);
+        mpfr_clear(ts[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,265 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/* Compile with -DNDEBUG, except for debugging. */
+
+#pragma once
+
+/*
+ * The operations that the vector kernels of sincos-simd.h and
+ * reduce-simd.h share, with AVX-512F or AVX2 and FMA intrinsics: add and
+ * xfma (arithmetic.h), the negation of some lanes, and the quotient and
+ * the reduction of Cody-Waite (cw_quotient and cw_reduce, cw.h). They
+ * perform the same operations as the scalar functions, lane by lane and
+ * in the same order, so the results are identical bit for bit.
+ *
+ * SIMD_WIDTH is the width of the vectors, 512 or 256 bits. It is not
+ * defined without a fast fma (ARITHMETIC_FMA, arithmetic.h), where the
+ * scalar functions round the products and the sums apart (madd).
+ */
+
+#include <stdint.h> // INT32_MIN, INT64_MIN
+
+#include "arithmetic.h" // ARITHMETIC_FMA
+#include "cw.h" // cw_parameters_*
+
+#if defined(ARITHMETIC_FMA)
+#if defined(__AVX512F__)
+#define SIMD_WIDTH 512
+#elif defined(__AVX2__) && defined(__FMA__)
+#define SIMD_WIDTH 256
+#endif
+#endif
+
+#if defined(SIMD_WIDTH)
+
+#include <immintrin.h>
+
+#endif
+
+#if defined(SIMD_WIDTH) && SIMD_WIDTH == 512
+
+// See add_float and add_double in arithmetic.h.
+
+static inline __m512
+__attribute__((always_inline))
+_add_avx512_ps(__m512 a, __m512 b, __m512 *e)
+{
+    __m512 x = _mm512_add_ps(a, b);
+    __m512 y = _mm512_sub_ps(x, b);
+    *e = _mm512_add_ps(_mm512_sub_ps(a, y), _mm512_sub_ps(b, _mm512_sub_ps(x, y)));
+    return x;
+}
+
+static inline __m512d
+__attribute__((always_inline))
+_add_avx512_pd(__m512d a, __m512d b, __m512d *e)
+{
+    __m512d x = _mm512_add_pd(a, b);
+    __m512d y = _mm512_sub_pd(x, b);
+    *e = _mm512_add_pd(_mm512_sub_pd(a, y), _mm512_sub_pd(b, _mm512_sub_pd(x, y)));
+    return x;
+}
+
+// See xfma_float and xfma_double in arithmetic.h.
+
+static inline __m512
+__attribute__((always_inline))
+_xfma_avx512_ps(__m512 a, __m512 b, __m512 c, __m512 *e)
+{
+    __m512 p = _mm512_mul_ps(a, b);
+    __m512 pe = _mm512_fmsub_ps(a, b, p);
+    __m512 e1, e2;
+    __m512 s1 = _add_avx512_ps(c, p, &e1);
+    __m512 s2 = _add_avx512_ps(s1, pe, &e2);
+    *e = _mm512_add_ps(e1, e2);
+    return s2;
+}
+
+static inline __m512d
+__attribute__((always_inline))
+_xfma_avx512_pd(__m512d a, __m512d b, __m512d c, __m512d *e)
+{
+    __m512d p = _mm512_mul_pd(a, b);
+    __m512d pe = _mm512_fmsub_pd(a, b, p);
+    __m512d e1, e2;
+    __m512d s1 = _add_avx512_pd(c, p, &e1);
+    __m512d s2 = _add_avx512_pd(s1, pe, &e2);
+    *e = _mm512_add_pd(e1, e2);
+    return s2;
+}
+
+static inline __m512
+__attribute__((always_inline))
+_neg_avx512_ps(__mmask16 m, __m512 x)
+{
+    __m512i bits = _mm512_castps_si512(x);
+    bits = _mm512_mask_xor_epi32(bits, m, bits, _mm512_set1_epi32(INT32_MIN));
+    return _mm512_castsi512_ps(bits);
+}
+
+static inline __m512d
+__attribute__((always_inline))
+_neg_avx512_pd(__mmask8 m, __m512d x)
+{
+    __m512i bits = _mm512_castpd_si512(x);
+    bits = _mm512_mask_xor_epi64(bits, m, bits, _mm512_set1_epi64(INT64_MIN));
+    return _mm512_castsi512_pd(bits);
+}
+
+// See cw_quotient_float and cw_quotient_double in cw.h.
+
+static inline __m512
+__attribute__((always_inline))
+_cw_quotient_avx512_ps(const cw_parameters_float cw, __m512 x)
+{
+    return _mm512_fmadd_ps(x, _mm512_set1_ps(cw.R1),
+        _mm512_fmadd_ps(x, _mm512_set1_ps(cw.R2), _mm512_mul_ps(x, _mm512_set1_ps(cw.R3))));
+}
+
+static inline __m512d
+__attribute__((always_inline))
+_cw_quotient_avx512_pd(const cw_parameters_double cw, __m512d x)
+{
+    return _mm512_fmadd_pd(x, _mm512_set1_pd(cw.R1),
+        _mm512_fmadd_pd(x, _mm512_set1_pd(cw.R2), _mm512_mul_pd(x, _mm512_set1_pd(cw.R3))));
+}
+
+// See cw_reduce_float and cw_reduce_double in cw.h, with nq = -q.
+
+static inline __m512
+__attribute__((always_inline))
+_cw_reduce_avx512_ps(const cw_parameters_float cw, __m512 nq, __m512 x, __m512 *e)
+{
+    __m512 e1, e2, e3;
+    __m512 r1 = _xfma_avx512_ps(nq, _mm512_set1_ps(cw.C1), x, &e1);
+    __m512 r2 = _xfma_avx512_ps(nq, _mm512_set1_ps(cw.C2), r1, &e2);
+    __m512 r3 = _xfma_avx512_ps(nq, _mm512_set1_ps(cw.C3), r2, &e3);
+    *e = _mm512_add_ps(_mm512_add_ps(e1, e2), e3);
+    return r3;
+}
+
+static inline __m512d
+__attribute__((always_inline))
+_cw_reduce_avx512_pd(const cw_parameters_double cw, __m512d nq, __m512d x, __m512d *e)
+{
+    __m512d e1, e2, e3;
+    __m512d r1 = _xfma_avx512_pd(nq, _mm512_set1_pd(cw.C1), x, &e1);
+    __m512d r2 = _xfma_avx512_pd(nq, _mm512_set1_pd(cw.C2), r1, &e2);
+    __m512d r3 = _xfma_avx512_pd(nq, _mm512_set1_pd(cw.C3), r2, &e3);
+    *e = _mm512_add_pd(_mm512_add_pd(e1, e2), e3);
+    return r3;
+}
+
+#elif defined(SIMD_WIDTH) && SIMD_WIDTH == 256
+
+// See add_float and add_double in arithmetic.h.
+
+static inline __m256
+__attribute__((always_inline))
+_add_avx2_ps(__m256 a, __m256 b, __m256 *e)
+{
+    __m256 x = _mm256_add_ps(a, b);
+    __m256 y = _mm256_sub_ps(x, b);
+    *e = _mm256_add_ps(_mm256_sub_ps(a, y), _mm256_sub_ps(b, _mm256_sub_ps(x, y)));
+    return x;
+}
+
+static inline __m256d
+__attribute__((always_inline))
+_add_avx2_pd(__m256d a, __m256d b, __m256d *e)
+{
+    __m256d x = _mm256_add_pd(a, b);
+    __m256d y = _mm256_sub_pd(x, b);
+    *e = _mm256_add_pd(_mm256_sub_pd(a, y), _mm256_sub_pd(b, _mm256_sub_pd(x, y)));
+    return x;
+}
+
+// See xfma_float and xfma_double in arithmetic.h.
+
+static inline __m256
+__attribute__((always_inline))
+_xfma_avx2_ps(__m256 a, __m256 b, __m256 c, __m256 *e)
+{
+    __m256 p = _mm256_mul_ps(a, b);
+    __m256 pe = _mm256_fmsub_ps(a, b, p);
+    __m256 e1, e2;
+    __m256 s1 = _add_avx2_ps(c, p, &e1);
+    __m256 s2 = _add_avx2_ps(s1, pe, &e2);
+    *e = _mm256_add_ps(e1, e2);
+    return s2;
+}
+
+static inline __m256d
+__attribute__((always_inline))
+_xfma_avx2_pd(__m256d a, __m256d b, __m256d c, __m256d *e)
+{
+    __m256d p = _mm256_mul_pd(a, b);
+    __m256d pe = _mm256_fmsub_pd(a, b, p);
+    __m256d e1, e2;
+    __m256d s1 = _add_avx2_pd(c, p, &e1);
+    __m256d s2 = _add_avx2_pd(s1, pe, &e2);
+    *e = _mm256_add_pd(e1, e2);
+    return s2;
+}
+
+// Masks are vectors of all ones or all zeros.
+
+static inline __m256
+__attribute__((always_inline))
+_neg_avx2_ps(__m256 m, __m256 x)
+{
+    return _mm256_xor_ps(x, _mm256_and_ps(m, _mm256_set1_ps(-0.0f)));
+}
+
+static inline __m256d
+__attribute__((always_inline))
+_neg_avx2_pd(__m256d m, __m256d x)
+{
+    return _mm256_xor_pd(x, _mm256_and_pd(m, _mm256_set1_pd(-0.0)));
+}
+
+// See cw_quotient_float and cw_quotient_double in cw.h.
+
+static inline __m256
+__attribute__((always_inline))
+_cw_quotient_avx2_ps(const cw_parameters_float cw, __m256 x)
+{
+    return _mm256_fmadd_ps(x, _mm256_set1_ps(cw.R1),
+        _mm256_fmadd_ps(x, _mm256_set1_ps(cw.R2), _mm256_mul_ps(x, _mm256_set1_ps(cw.R3))));
+}
+
+static inline __m256d
+__attribute__((always_inline))
+_cw_quotient_avx2_pd(const cw_parameters_double cw, __m256d x)
+{
+    return _mm256_fmadd_pd(x, _mm256_set1_pd(cw.R1),
+        _mm256_fmadd_pd(x, _mm256_set1_pd(cw.R2), _mm256_mul_pd(x, _mm256_set1_pd(cw.R3))));
+}
+
+// See cw_reduce_float and cw_reduce_double in cw.h, with nq = -q.
+
+static inline __m256
+__attribute__((always_inline))
+_cw_reduce_avx2_ps(const cw_parameters_float cw, __m256 nq, __m256 x, __m256 *e)
+{
+    __m256 e1, e2, e3;
+    __m256 r1 = _xfma_avx2_ps(nq, _mm256_set1_ps(cw.C1), x, &e1);
+    __m256 r2 = _xfma_avx2_ps(nq, _mm256_set1_ps(cw.C2), r1, &e2);
+    __m256 r3 = _xfma_avx2_ps(nq, _mm256_set1_ps(cw.C3), r2, &e3);
+    *e = _mm256_add_ps(_mm256_add_ps(e1, e2), e3);
+    return r3;
+}
+
+static inline __m256d
+__attribute__((always_inline))
+_cw_reduce_avx2_pd(const cw_parameters_double cw, __m256d nq, __m256d x, __m256d *e)
+{
+    __m256d e1, e2, e3;
+    __m256d r1 = _xfma_avx2_pd(nq, _mm256_set1_pd(cw.C1), x, &e1);
+    __m256d r2 = _xfma_avx2_pd(nq, _mm256_set1_pd(cw.C2), r1, &e2);
+    __m256d r3 = _xfma_avx2_pd(nq, _mm256_set1_pd(cw.C3), r2, &e3);
+    *e = _mm256_add_pd(_mm256_add_pd(e1, e2), e3);
+    return r3;
+}
+
+#endif
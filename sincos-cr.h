@@ -0,0 +1,603 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/* Compile with -DNDEBUG, except for debugging. */
+
+#pragma once
+
+#include <assert.h>
+#include <math.h> // fabs, fabsf, isfinite
+#include <stddef.h> // size_t
+#include <stdint.h> // int64_t, uint32_t, uint64_t
+#include <string.h> // memcpy
+
+#include "arithmetic.h" // add, madd, mul, mul_dekker, nmadd
+#include "constants.h" // pi_2, inv_pi_2
+#include "cos.h" // _cos_as_double
+#include "counters.h" // COUNT
+#include "expansion.h" // add_dd, mul_dd, add_td, mul_td, round_td
+#include "ph.h" // _ph_rem_pi_2_double, _ph_fraction7_double
+#include "polynomial.h" // eval_polynomial_double1
+#include "reduce.h" // QUADRANT_BIAS_DOUBLE
+#include "sin.h" // _sin_as_double
+#include "sincos-table.h" // _sin_table_double, etc.
+#include "types.h" // rem_result_double, sincos_result_double, etc.
+
+/*
+ * Correctly rounded sin(x) and cos(x), for double, in round-to-nearest,
+ * with Ziv's strategy: evaluate an approximation y and a bound e on its
+ * error, and if y - e and y + e round to the same double, so does the
+ * exact result; otherwise, evaluate again, more accurately. [1] [2]
+ *
+ *  1. The fast path: the reduction of sincos.c, with a third part of π∕2
+ *     (Cody-Waite) or with Payne-Hanek, and the table of sincos-table.h,
+ *     in double, but for the leading terms, with an error < 2⁻⁶² of the
+ *     result, plus that of the reduction.
+ *  2. A triple-double reduction, with five parts of π∕2 (Cody-Waite) or
+ *     with ten words of 2∕π (Payne-Hanek), and the Taylor series of sin
+ *     and cos in double-double, with an error < 2⁻⁹⁸ of the result.
+ *  3. The same Taylor series in triple-double, with an error < 2⁻¹⁴⁰.
+ *     The worst cases of sin and cos need about 2⁻¹²⁰ [3], so the result
+ *     of this path is rounded without a test.
+ *
+ * The constants are generated by gen-sincos-cr.c.
+ *
+ * [1] A. Ziv. Fast evaluation of elementary mathematical functions with
+ *     correctly rounded last bit. ACM Trans. Math. Softw. 17, 3
+ *     (Sept. 1991), 410-423.
+ *
+ * [2] F. de Dinechin, C. Lauter, and G. Melquiond. Certifying the
+ *     floating-point implementation of an elementary function using Gappa.
+ *     IEEE Trans. Computers 60, 2 (2011), 242-253.
+ *
+ * [3] V. Lefèvre and J.-M. Muller. Worst cases for correct rounding of the
+ *     elementary functions in double precision. ARITH 15, 2001, 111-118.
+ */
+
+// π∕2 ≅ Σ _sincos_cr_pi_2[i]
+static const double _sincos_cr_pi_2[5] = {
+    0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54, -0x1.f1976b7ed8fbcp-110, 0x1.4cf98e804177dp-164, 0x1.31d89cd9128a5p-218,
+};
+
+// 1∕n! ≅ _sincos_cr_inv_factorials[n]
+static const triple_double _sincos_cr_inv_factorials[39] = {
+    {0x1p+0, 0x0p+0, 0x0p+0}, // 1∕0!
+    {0x1p+0, 0x0p+0, 0x0p+0}, // 1∕1!
+    {0x1p-1, 0x0p+0, 0x0p+0}, // 1∕2!
+    {0x1.5555555555555p-3, 0x1.5555555555555p-57, 0x1.5555555555555p-111}, // 1∕3!
+    {0x1.5555555555555p-5, 0x1.5555555555555p-59, 0x1.5555555555555p-113}, // 1∕4!
+    {0x1.1111111111111p-7, 0x1.1111111111111p-63, 0x1.1111111111111p-119}, // 1∕5!
+    {0x1.6c16c16c16c17p-10, -0x1.f49f49f49f49fp-65, -0x1.27d27d27d27d2p-119}, // 1∕6!
+    {0x1.a01a01a01a01ap-13, 0x1.a01a01a01a01ap-73, 0x1.a01a01a01a01ap-133}, // 1∕7!
+    {0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-76, 0x1.a01a01a01a01ap-136}, // 1∕8!
+    {0x1.71de3a556c734p-19, -0x1.c154f8ddc6cp-73, 0x1.71de3a556c734p-127}, // 1∕9!
+    {0x1.27e4fb7789f5cp-22, 0x1.cbbc05b4fa99ap-76, -0x1.c6d278883e8f5p-132}, // 1∕10!
+    {0x1.ae64567f544e4p-26, -0x1.c062e06d1f209p-80, 0x1.c7880adcbc46ep-136}, // 1∕11!
+    {0x1.1eed8eff8d898p-29, -0x1.2aec959e14c06p-83, 0x1.2fb0073dd2d9ep-139}, // 1∕12!
+    {0x1.6124613a86d09p-33, 0x1.f28e0cc748ebep-87, -0x1.7b2c4c8a840bcp-141}, // 1∕13!
+    {0x1.93974a8c07c9dp-37, 0x1.05d6f8a2efd1fp-92, 0x1.3aa3346236a5dp-147}, // 1∕14!
+    {0x1.ae7f3e733b81fp-41, 0x1.1d8656b0ee8cbp-97, -0x1.6e142a138f825p-157}, // 1∕15!
+    {0x1.ae7f3e733b81fp-45, 0x1.1d8656b0ee8cbp-101, -0x1.6e142a138f825p-161}, // 1∕16!
+    {0x1.952c77030ad4ap-49, 0x1.ac981465ddc6cp-103, -0x1.588b72e53bc5fp-165}, // 1∕17!
+    {0x1.6827863b97d97p-53, 0x1.eec01221a8b0bp-107, -0x1.568798662118bp-161}, // 1∕18!
+    {0x1.2f49b46814157p-57, 0x1.2650f61dbdcb4p-112, -0x1.69502917cbf3bp-166}, // 1∕19!
+    {0x1.e542ba4020225p-62, 0x1.ea72b4afe3c2fp-120, -0x1.44020dfd65c8cp-174}, // 1∕20!
+    {0x1.71b8ef6dcf572p-66, -0x1.d043ae40c4647p-120, 0x1.486121e81d5fep-176}, // 1∕21!
+    {0x1.0ce396db7f853p-70, -0x1.aebcdbd20331cp-124, -0x1.38a88578b4d75p-178}, // 1∕22!
+    {0x1.761b41316381ap-75, -0x1.3423c7d91404fp-130, 0x1.e6135bfc1194ap-185}, // 1∕23!
+    {0x1.f2cf01972f578p-80, -0x1.9ada5fcc1ab14p-135, 0x1.440ce7fd610dcp-189}, // 1∕24!
+    {0x1.3f3ccdd165fa9p-84, -0x1.58ddadf344487p-139, -0x1.e8ed8001ad67ep-193}, // 1∕25!
+    {0x1.88e85fc6a4e5ap-89, -0x1.71c37ebd1654p-143, 0x1.494676265a364p-197}, // 1∕26!
+    {0x1.d1ab1c2dccea3p-94, 0x1.054d0c78aea14p-149, -0x1.196bf16c33a56p-203}, // 1∕27!
+    {0x1.0a18a2635085dp-98, 0x1.b9e2e28e1aa54p-153, 0x1.a8549a9d99586p-207}, // 1∕28!
+    {0x1.259f98b4358adp-103, 0x1.eaf8c39dd9bc5p-157, -0x1.6e29990a26fb6p-211}, // 1∕29!
+    {0x1.3932c5047d60ep-108, 0x1.832b7b530a627p-162, 0x1.5d2c61f6d124cp-218}, // 1∕30!
+    {0x1.434d2e783f5bcp-113, 0x1.0b87b91be9affp-167, 0x1.c89db1796db75p-224}, // 1∕31!
+    {0x1.434d2e783f5bcp-118, 0x1.0b87b91be9affp-172, 0x1.c89db1796db75p-229}, // 1∕32!
+    {0x1.3981254dd0d52p-123, -0x1.2b1f4c8015a2fp-177, -0x1.d82af23edb6dbp-231}, // 1∕33!
+    {0x1.2710231c0fd7ap-128, 0x1.3f8a2b4af9d6bp-184, 0x1.c32215a9f317ep-238}, // 1∕34!
+    {0x1.0dc59c716d91fp-133, 0x1.419e3fad3f031p-188, 0x1.d9d7ed1981ffcp-244}, // 1∕35!
+    {0x1.df983290c2ca9p-139, 0x1.5835c6895393bp-194, -0x1.0578f45b1aaaep-249}, // 1∕36!
+    {0x1.9ec8d1c94e85bp-144, -0x1.670e9d4784ec6p-201, 0x1.79fe5954939a2p-255}, // 1∕37!
+    {0x1.5d4acb9c0c3abp-149, -0x1.6ec2c8f5b13b2p-205, 0x1.e2860aaa59188p-259}, // 1∕38!
+};
+
+/*
+ * sin(u) ≅ u + u³⋅S(u²) and cos(u) ≅ 1 - u²∕2 + u⁴⋅C(u²), the Taylor
+ * series, on [0, π∕128], with a truncation error < 2⁻⁷⁵.
+ */
+
+static const double _sincos_cr_sin_as[4] = {
+    /* x^3 */ -0x1.5555555555555p-3,
+    /* x^5 */ 0x1.1111111111111p-7,
+    /* x^7 */ -0x1.a01a01a01a01ap-13,
+    /* x^9 */ 0x1.71de3a556c734p-19,
+};
+
+static const double _sincos_cr_cos_as[3] = {
+    /* x^4 */ 0x1.5555555555555p-5,
+    /* x^6 */ -0x1.6c16c16c16c17p-10,
+    /* x^8 */ 0x1.a01a01a01a01ap-16,
+};
+
+/*
+ * The number of terms of the Taylor series of sin(r)∕r and cos(r), for
+ * |r| ≤ π∕4, with a truncation error < 2⁻¹¹³ (double-double), and < 2⁻¹⁶⁰
+ * (triple-double).
+ */
+
+#define SINCOS_CR_SIN_TERMS_DD 14
+#define SINCOS_CR_COS_TERMS_DD 15
+#define SINCOS_CR_SIN_TERMS_TD 19
+#define SINCOS_CR_COS_TERMS_TD 20
+
+static_assert(
+    2 * (SINCOS_CR_COS_TERMS_TD - 1) + 1
+        == sizeof _sincos_cr_inv_factorials / sizeof _sincos_cr_inv_factorials[0],
+    "not enough inverse factorials"
+);
+
+/*
+ * Return whether y - e and y + e round to the same double, for a
+ * double-double y = yₕ + yₗ, |yₗ| ≤ ulp(yₕ)∕2.
+ */
+
+static inline int
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_rounds_double(tuple_double y, double e)
+{
+    return y.a + (y.b - e) == y.a + (y.b + e);
+}
+
+/*
+ * Return the quotient z and the remainder r = v₁ + v₂ of x∕(π∕2), with
+ * z rounded to nearest, for π∕4 < x < 2³⁰ (without fma, z may be the
+ * other integer nearest to x∕(π∕2), and |r| a little more than π∕4).
+ * x - z⋅P₀ is exact, as in cw.h (nmadd), and z⋅P₁ is exact (mul), so
+ * the error is < 2⁻¹⁰⁵⋅|r| + 2⁻¹²⁸.
+ */
+
+static inline rem_result_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_cw_rem_pi_2_double(double x)
+{
+    assert(x > 0.5 * pi_2(double) && x < 0x1.0p30);
+    const double *P = _sincos_cr_pi_2;
+    const double bias = QUADRANT_BIAS_DOUBLE;
+    double z = madd(x, inv_pi_2(double), bias);
+    double k = z - bias;
+    double u = nmadd(k, P[0], x);
+    tuple_double p = mul(k, P[1]);
+    tuple_double s = add(u, -p.a);
+    tuple_double r = add(s.a, (s.b - p.b) - k * P[2]);
+    return (rem_result_double) {(int64_t) k, r.a, r.b};
+}
+
+/*
+ * The same, for x ≥ 2³⁰, with _ph_rem_pi_2, and r in [0, π∕2) moved to
+ * [-π∕4, π∕4]. The error is < 2⁻¹⁰⁰.
+ */
+
+static inline rem_result_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_ph_rem_pi_2_double(double x)
+{
+    assert(x >= 0x1.0p30);
+    const double *P = _sincos_cr_pi_2;
+    rem_result_double rem = _ph_rem_pi_2_double(x);
+    if (rem.v1 <= 0.5 * pi_2(double))
+        return rem;
+    tuple_double r = add(rem.v1 - P[0], (rem.v2 - P[1]) - P[2]);
+    return (rem_result_double) {rem.z + 1, r.a, r.b};
+}
+
+/*
+ * Return A⋅cos(u) + B⋅sin(u), for A = Aₕ + Aₗ and B = Bₕ + Bₗ from the
+ * tables, t = uₕ², and the rest of the series, sᵤ = sin(u) - uₕ and
+ * cᵤ = cos(u) - 1 + t∕2. The leading terms Aₕ + Bₕ⋅uₕ - Aₕ⋅t∕2 are summed
+ * with error-free transformations, and the rest is < 2⁻¹⁶ of the result.
+ */
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_fast_sum_double(
+    double Ah, double Al, double Bh, double Bl,
+    double uh, double t, double su, double cu)
+{
+    tuple_double p = mul(Bh, uh);
+    tuple_double q = mul(Ah, -0.5 * t);
+    tuple_double s1 = add(Ah, p.a);
+    tuple_double s2 = add(s1.a, q.a);
+    double e = madd(Al, -0.5 * t, Al) + Bl * (uh + su);
+    e = madd(Ah, cu, e + ((p.b + q.b) + (s1.b + s2.b)));
+    e = madd(Bh, su, e);
+    return add(s2.a, e);
+}
+
+/*
+ * Return {sin(r), cos(r)} for r = v₁ + v₂, |r| ≤ π∕4 (about), as
+ * _sincos_table_double, with u = uₕ + uₗ in double-double:
+ *
+ *     |r| = j⋅π∕64 + u, |u| ≤ π∕128
+ *     sin(|r|) = sin(j⋅π∕64)⋅cos(u) + cos(j⋅π∕64)⋅sin(u)
+ *     cos(|r|) = cos(j⋅π∕64)⋅cos(u) - sin(j⋅π∕64)⋅sin(u)
+ */
+
+static inline sincos_result_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_fast_double(double v1, double v2)
+{
+    const size_t ns = sizeof _sincos_cr_sin_as / sizeof _sincos_cr_sin_as[0];
+    const size_t nc = sizeof _sincos_cr_cos_as / sizeof _sincos_cr_cos_as[0];
+    const double *P = _sincos_cr_pi_2;
+    const double bias = QUADRANT_BIAS_DOUBLE;
+    double sign = v1 < 0.0 ? -1.0 : 1.0;
+    double a = sign * v1;
+    double al = sign * v2;
+
+    // j = a⋅64∕π rounded to nearest, and u = a - j⋅π∕64, exactly but
+    // for the last part of π∕2
+    double z = madd(a, 0x1.0p5 * inv_pi_2(double), bias);
+    double k = z - bias;
+    int j = (int) k;
+    assert(j >= 0 && j <= 17);
+    double u0 = nmadd(k, 0x1.0p-5 * P[0], a);
+    tuple_double p = mul(k, 0x1.0p-5 * P[1]);
+    tuple_double v = add(u0, -p.a);
+    tuple_double u = add(v.a, ((v.b - p.b) + al) - k * (0x1.0p-5 * P[2]));
+
+    double t = u.a * u.a;
+    double te = mul(u.a, u.a).b;
+    double ps = eval_polynomial_double1(_sincos_cr_sin_as, ns, t);
+    double pc = eval_polynomial_double1(_sincos_cr_cos_as, nc, t);
+    double su = madd(u.a * t, ps, madd(-0.5 * t, u.b, u.b));
+    double cu = madd(-u.a, u.b, madd(t * t, pc, -0.5 * te));
+
+    double S = _sin_table_double[j];
+    double Sl = _sin_table_lo_double[j];
+    double C = _cos_table_double[j];
+    double Cl = _cos_table_lo_double[j];
+    tuple_double s = _sincos_cr_fast_sum_double(S, Sl, C, Cl, u.a, t, su, cu);
+    tuple_double c = _sincos_cr_fast_sum_double(C, Cl, -S, -Sl, u.a, t, su, cu);
+    return (sincos_result_double) {{sign * s.a, sign * s.b}, c};
+}
+
+/*
+ * Return {sin(x), cos(x)} from {sin(r), cos(r)} and the quadrant q of
+ * x = qπ∕2 + r, as _sincos_pi_2.
+ */
+
+static inline sincos_result_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_quadrant_double(sincos_result_double y, int64_t q)
+{
+    int odd = (q & 1) != 0;
+    tuple_double s = odd ? y.c : y.s;
+    tuple_double c = odd ? y.s : y.c;
+    if ((q & 2) != 0)
+        s = (tuple_double) {-s.a, -s.b};
+    if (((q + 1) & 2) != 0)
+        c = (tuple_double) {-c.a, -c.b};
+    return (sincos_result_double) {s, c};
+}
+
+/*
+ * Return the quotient z modulo 4 and the remainder r = v₁ + v₂ + v₃ of
+ * x∕(π∕2), with z rounded to nearest, for x ≥ 0, with a relative error
+ * < 2⁻¹⁴⁰: for x < 2¹⁰, with five parts of π∕2, and the products z⋅Pᵢ
+ * summed in triple-double, and otherwise, with _ph_fraction7_double.
+ */
+
+static inline rem_result_triple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_rem_pi_2_triple_double(double x)
+{
+    assert(x >= 0.0 && isfinite(x));
+    const double *P = _sincos_cr_pi_2;
+    if (x < 0x1.0p10) {
+        const double bias = QUADRANT_BIAS_DOUBLE;
+        double z = madd(x, inv_pi_2(double), bias);
+        double k = z - bias;
+        triple_double r = {nmadd(k, P[0], x), 0.0, 0.0};
+        tuple_double p1 = mul(k, P[1]);
+        tuple_double p2 = mul(k, P[2]);
+        r = add_td_double(r, -p1.a);
+        r = add_td_double(r, -p1.b);
+        r = add_td_double(r, -p2.a);
+        r = add_td_double(r, -p2.b);
+        r = add_td_double(r, -k * P[3]);
+        r = add_td_double(r, -k * P[4]);
+        return (rem_result_triple_double) {(int64_t) k & 3, r.a, r.b, r.c};
+    }
+
+    uint32_t f[7];
+    int z = _ph_fraction7_double(x, f);
+
+    // If the fraction is ≥ 1∕2, take 1 - fraction, negated.
+    double sign = 1.0;
+    if ((f[0] >> 31) != 0) {
+        uint64_t carry = 1;
+        for (int i = 6; i >= 0; i--) {
+            uint64_t w = (uint64_t) (uint32_t) ~f[i] + carry;
+            f[i] = (uint32_t) w;
+            carry = w >> 32;
+        }
+        z = (z + 1) & 3;
+        sign = -1.0;
+    }
+
+    triple_double v = {0.0, 0.0, 0.0};
+    double scale = 0x1.0p-32;
+    for (int i = 0; i < 7; i++) {
+        v = add_td_double(v, (double) f[i] * scale);
+        scale *= 0x1.0p-32;
+    }
+    v = mul_td(v, (triple_double) {P[0], P[1], P[2]});
+    return (rem_result_triple_double) {z, sign * v.a, sign * v.b, sign * v.c};
+}
+
+/*
+ * Σ (-1)ⁿ⋅tⁿ∕(2n + m)!, for n < terms: sin(r)∕r for m = 1, cos(r) for
+ * m = 0, with t = r², in double-double and in triple-double (Horner).
+ */
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_series_dd(tuple_double t, int m, int terms)
+{
+    tuple_double y = {0.0, 0.0};
+    for (int n = terms - 1; n >= 0; n--) {
+        triple_double f = _sincos_cr_inv_factorials[2 * n + m];
+        double sign = (n & 1) != 0 ? -1.0 : 1.0;
+        y = add_dd(mul_dd(y, t), (tuple_double) {sign * f.a, sign * f.b});
+    }
+    return y;
+}
+
+static inline triple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_series_td(triple_double t, int m, int terms)
+{
+    triple_double y = {0.0, 0.0, 0.0};
+    for (int n = terms - 1; n >= 0; n--) {
+        triple_double f = _sincos_cr_inv_factorials[2 * n + m];
+        double sign = (n & 1) != 0 ? -1.0 : 1.0;
+        y = add_td(mul_td(y, t), (triple_double) {sign * f.a, sign * f.b, sign * f.c});
+    }
+    return y;
+}
+
+/*
+ * The accurate paths, out of line, to keep the fast path small:
+ * only the results wanted (s, c) are evaluated.
+ */
+
+static tuple_double
+__attribute__((noinline))
+_sincos_cr_accurate_double(double x, int s, int c)
+{
+    COUNT(COUNTER_SINCOS_CR_DD_DOUBLE);
+    double sign = x < 0.0 ? -1.0 : 1.0;
+    rem_result_triple_double rem = _sincos_cr_rem_pi_2_triple_double(sign * x);
+    int odd = (rem.z & 1) != 0;
+    int want_sin = odd ? c : s; // of r
+    int want_cos = odd ? s : c;
+
+    tuple_double r = {rem.v1, rem.v2};
+    tuple_double t = mul_dd(r, r);
+    sincos_result_double y = {{0.0, 0.0}, {0.0, 0.0}};
+    if (want_sin)
+        y.s = mul_dd(r, _sincos_cr_series_dd(t, 1, SINCOS_CR_SIN_TERMS_DD));
+    if (want_cos)
+        y.c = _sincos_cr_series_dd(t, 0, SINCOS_CR_COS_TERMS_DD);
+    y = _sincos_cr_quadrant_double(y, rem.z);
+    if ((!s || _sincos_cr_rounds_double(y.s, 0x1.0p-98 * fabs(y.s.a)))
+            && (!c || _sincos_cr_rounds_double(y.c, 0x1.0p-98 * fabs(y.c.a))))
+        return (tuple_double) {sign * (y.s.a + y.s.b), y.c.a + y.c.b};
+
+    COUNT(COUNTER_SINCOS_CR_TD_DOUBLE);
+    triple_double r3 = {rem.v1, rem.v2, rem.v3};
+    triple_double t3 = mul_td(r3, r3);
+    if (want_sin)
+        y.s = (tuple_double) {round_td(mul_td(r3, _sincos_cr_series_td(t3, 1, SINCOS_CR_SIN_TERMS_TD))), 0.0};
+    if (want_cos)
+        y.c = (tuple_double) {round_td(_sincos_cr_series_td(t3, 0, SINCOS_CR_COS_TERMS_TD)), 0.0};
+    y = _sincos_cr_quadrant_double(y, rem.z);
+    return (tuple_double) {sign * y.s.a, y.c.a};
+}
+
+/*
+ * Return {sin(x), cos(x)}, correctly rounded, or only one of them,
+ * with s and c constant, the other being meaningless.
+ */
+
+static inline tuple_double
+__attribute__((always_inline))
+_sincos_cr_pi_2_double(double x, int s, int c)
+{
+    COUNT(COUNTER_SINCOS_CR_DOUBLE);
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return (tuple_double) {x - x, x - x};
+    double sign = x < 0.0 ? -1.0 : 1.0;
+    double ax = sign * x;
+    // |sin(x) - x| < x³∕6 < ulp(x)∕2 and |cos(x) - 1| < x²∕2 < ulp(1)∕4
+    if (ax < 0x1.0p-27)
+        return (tuple_double) {x, 1.0};
+
+    int64_t q = 0;
+    double v1 = ax;
+    double v2 = 0.0;
+    double delta = 0.0; // error of the reduction
+    if (ax > 0.5 * pi_2(double)) {
+        rem_result_double rem;
+        if (ax < 0x1.0p30) {
+            rem = _sincos_cr_cw_rem_pi_2_double(ax);
+            delta = 0x1.0p-128;
+        } else {
+            rem = _sincos_cr_ph_rem_pi_2_double(ax);
+            delta = 0x1.0p-100;
+        }
+        q = rem.z;
+        v1 = rem.v1;
+        v2 = rem.v2;
+    }
+
+    sincos_result_double y = _sincos_cr_quadrant_double(_sincos_cr_fast_double(v1, v2), q);
+    if ((!s || _sincos_cr_rounds_double(y.s, madd(0x1.0p-62, fabs(y.s.a), delta)))
+            && (!c || _sincos_cr_rounds_double(y.c, madd(0x1.0p-62, fabs(y.c.a), delta))))
+        return (tuple_double) {sign * (y.s.a + y.s.b), y.c.a + y.c.b};
+    return _sincos_cr_accurate_double(x, s, c);
+}
+
+/*
+ * Correctly rounded sin(x) and cos(x), for float: x is promoted to double,
+ * reduced with one Cody-Waite step of the double constants (Payne-Hanek
+ * for |x| ≥ 2²⁴), and sin(r) and cos(r) are evaluated with the double
+ * polynomials of sin.h and cos.h, always with Horner's scheme and without
+ * fma (neither madd nor eval_polynomial, whose roundings depend on the
+ * level of isa.h), so that the results are the same on every build. The
+ * result y has an error of at most 2 ulp (of double), so y rounds to the
+ * correctly rounded float, unless y is within 64 ulp of the midpoint of
+ * two floats; then the argument is looked up in a table of the
+ * exceptions, from an exhaustive sweep of the floats against MPFR
+ * (gen-sincos-cr-float.c), which also measures the error of y. Of the 2³¹ floats, 555 results are near a
+ * midpoint, and 3 are exceptions.
+ */
+
+/*
+ * Return {sin(x), cos(x)} in double, for 0 ≤ x < ∞.
+ */
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_kernel_float(float x)
+{
+    static_assert(
+        sizeof _sin_as_double == sizeof _cos_as_double,
+        "sin and cos polynomials must have the same degree"
+    );
+    const size_t n = sizeof _sin_as_double / sizeof _sin_as_double[0];
+    const double bias = QUADRANT_BIAS_DOUBLE;
+    double r = (double) x;
+    int64_t q = 0;
+    if (r > 0.5 * pi_2(double)) {
+        if (r < 0x1.0p24) {
+            // x - k⋅π∕2ₕᵢ is exact, since x is a float (mul_dekker)
+            double k = (r * inv_pi_2(double) + bias) - bias;
+            tuple_double p = mul_dekker_double(k, pi_2_hi(double));
+            r = ((r - p.a) - p.b) - k * pi_2_lo(double);
+            q = (int64_t) k;
+        } else {
+            rem_result_double rem = _ph_rem_pi_2_double(r);
+            q = rem.z;
+            r = rem.v1 + rem.v2;
+            if (r > 0.5 * pi_2(double)) {
+                r = (rem.v1 - pi_2_hi(double)) + (rem.v2 - pi_2_lo(double));
+                q++;
+            }
+        }
+    }
+    double t = r * r;
+    double ps = _sin_as_double[n - 1];
+    double pc = _cos_as_double[n - 1];
+    for (size_t i = 1; i < n; i++) {
+        ps = ps * t + _sin_as_double[n - 1 - i];
+        pc = pc * t + _cos_as_double[n - 1 - i];
+    }
+    double s = r * t * ps + r;
+    double c = t * t * pc + (1.0 - 0.5 * t);
+    int odd = (q & 1) != 0;
+    double sin_x = odd ? c : s;
+    double cos_x = odd ? s : c;
+    sin_x = (q & 2) != 0 ? -sin_x : sin_x;
+    cos_x = ((q + 1) & 2) != 0 ? -cos_x : cos_x;
+    return (tuple_double) {sin_x, cos_x};
+}
+
+/*
+ * Return whether y is within 64 ulp (about 2⁻⁴⁶) of the midpoint of two
+ * normal floats, the low 29 bits of its mantissa being 2²⁸ ± 64.
+ */
+
+static inline int
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_cr_near_midpoint_float(double y)
+{
+    uint64_t u;
+    memcpy(&u, &y, sizeof u);
+    return ((u - 0x10000000 + 64) & 0x1fffffff) <= 128;
+}
+
+// Generated by gen-sincos-cr-float.
+// {x, sin(x)}, for the floats x > 0 at which (float) y is wrong
+static const float _sin_cr_exceptions_float[1][2] = {
+    {0x1.33333p+13f, -0x1.63f4bap-2f},
+};
+// {x, cos(x)}, for the floats x > 0 at which (float) y is wrong
+static const float _cos_cr_exceptions_float[2][2] = {
+    {0x1.3170fp+63f, 0x1.fe2976p-1f},
+    {0x1.2b9622p+67f, 0x1.f0285ep-1f},
+};
+
+/*
+ * Return the correctly rounded result for x > 0 from a table of
+ * exceptions {x, f(x)}, sorted by x, or y if x is not in it.
+ */
+
+static inline float
+__attribute__((always_inline))
+_sincos_cr_lookup_float(const float table[][2], size_t n, float x, float y)
+{
+    size_t lo = 0;
+    size_t hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid][0] < x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < n && table[lo][0] == x ? table[lo][1] : y;
+}
+
+/*
+ * Return {sin(x), cos(x)}, correctly rounded, or only one of them,
+ * with s and c constant, as _sincos_cr_pi_2_double.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+_sincos_cr_pi_2_float(float x, int s, int c)
+{
+    const size_t ns = sizeof _sin_cr_exceptions_float / sizeof _sin_cr_exceptions_float[0];
+    const size_t nc = sizeof _cos_cr_exceptions_float / sizeof _cos_cr_exceptions_float[0];
+    COUNT(COUNTER_SINCOS_CR_FLOAT);
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return (tuple_float) {x - x, x - x};
+    float ax = fabsf(x);
+    // |sin(x) - x| < x³∕6 < ulp(x)∕2 and |cos(x) - 1| < x²∕2 < ulp(1)∕4
+    if (ax < 0x1.0p-12f)
+        return (tuple_float) {x, 1.0f};
+    tuple_double y = _sincos_cr_kernel_float(ax);
+    float sin_x = (float) y.a;
+    float cos_x = (float) y.b;
+    if (s && _sincos_cr_near_midpoint_float(y.a)) {
+        COUNT(COUNTER_SINCOS_CR_LOOKUP_FLOAT);
+        sin_x = _sincos_cr_lookup_float(_sin_cr_exceptions_float, ns, ax, sin_x);
+    }
+    if (c && _sincos_cr_near_midpoint_float(y.b)) {
+        COUNT(COUNTER_SINCOS_CR_LOOKUP_FLOAT);
+        cos_x = _sincos_cr_lookup_float(_cos_cr_exceptions_float, nc, ax, cos_x);
+    }
+    return (tuple_float) {x < 0.0f ? -sin_x : sin_x, cos_x};
+}
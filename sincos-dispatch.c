@@ -0,0 +1,480 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#include <stddef.h> // size_t
+
+#include "isa.h" // isa_level
+#include "sincos.h"
+
+/*
+ * The public functions of sincos.h, for a build of sincos.c per level of
+ * isa.h (sincos-v2.o, sincos-v3.o, sincos-v4.o). The constructor init
+ * fills the table of functions once, at load time, from cpuid.
+ */
+
+#define SINCOS_DECLARE(level) \
+    float _sin_float_v##level(float x); \
+    double _sin_double_v##level(double x); \
+    void _sin_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _sin_array_double_v##level(double xs[], double ys[], size_t n); \
+    float _cos_float_v##level(float x); \
+    double _cos_double_v##level(double x); \
+    void _cos_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _cos_array_double_v##level(double xs[], double ys[], size_t n); \
+    void _sincos_float_v##level(float x, float *sin_x, float *cos_x); \
+    void _sincos_double_v##level(double x, double *sin_x, double *cos_x); \
+    void _sincos_array_float_v##level(float xs[], float ss[], float cs[], size_t n); \
+    void _sincos_array_double_v##level(double xs[], double ss[], double cs[], size_t n); \
+    float _sin_cr_float_v##level(float x); \
+    double _sin_cr_double_v##level(double x); \
+    void _sin_cr_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _sin_cr_array_double_v##level(double xs[], double ys[], size_t n); \
+    float _cos_cr_float_v##level(float x); \
+    double _cos_cr_double_v##level(double x); \
+    void _cos_cr_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _cos_cr_array_double_v##level(double xs[], double ys[], size_t n); \
+    void _sincos_cr_float_v##level(float x, float *sin_x, float *cos_x); \
+    void _sincos_cr_double_v##level(double x, double *sin_x, double *cos_x); \
+    void _sincos_cr_array_float_v##level(float xs[], float ss[], float cs[], size_t n); \
+    void _sincos_cr_array_double_v##level(double xs[], double ss[], double cs[], size_t n); \
+    float _sinpi_float_v##level(float x); \
+    double _sinpi_double_v##level(double x); \
+    void _sinpi_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _sinpi_array_double_v##level(double xs[], double ys[], size_t n); \
+    float _cospi_float_v##level(float x); \
+    double _cospi_double_v##level(double x); \
+    void _cospi_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _cospi_array_double_v##level(double xs[], double ys[], size_t n); \
+    void _sincospi_float_v##level(float x, float *sin_x, float *cos_x); \
+    void _sincospi_double_v##level(double x, double *sin_x, double *cos_x); \
+    void _sincospi_array_float_v##level(float xs[], float ss[], float cs[], size_t n); \
+    void _sincospi_array_double_v##level(double xs[], double ss[], double cs[], size_t n); \
+    float _sind_float_v##level(float x); \
+    double _sind_double_v##level(double x); \
+    void _sind_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _sind_array_double_v##level(double xs[], double ys[], size_t n); \
+    float _cosd_float_v##level(float x); \
+    double _cosd_double_v##level(double x); \
+    void _cosd_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _cosd_array_double_v##level(double xs[], double ys[], size_t n); \
+    float _tan_float_v##level(float x); \
+    double _tan_double_v##level(double x); \
+    void _tan_array_float_v##level(float xs[], float ys[], size_t n); \
+    void _tan_array_double_v##level(double xs[], double ys[], size_t n);
+
+SINCOS_DECLARE(2)
+SINCOS_DECLARE(3)
+SINCOS_DECLARE(4)
+
+typedef struct {
+    float (*sin_float)(float);
+    double (*sin_double)(double);
+    void (*sin_array_float)(float *, float *, size_t);
+    void (*sin_array_double)(double *, double *, size_t);
+    float (*cos_float)(float);
+    double (*cos_double)(double);
+    void (*cos_array_float)(float *, float *, size_t);
+    void (*cos_array_double)(double *, double *, size_t);
+    void (*sincos_float)(float, float *, float *);
+    void (*sincos_double)(double, double *, double *);
+    void (*sincos_array_float)(float *, float *, float *, size_t);
+    void (*sincos_array_double)(double *, double *, double *, size_t);
+    float (*sin_cr_float)(float);
+    double (*sin_cr_double)(double);
+    void (*sin_cr_array_float)(float *, float *, size_t);
+    void (*sin_cr_array_double)(double *, double *, size_t);
+    float (*cos_cr_float)(float);
+    double (*cos_cr_double)(double);
+    void (*cos_cr_array_float)(float *, float *, size_t);
+    void (*cos_cr_array_double)(double *, double *, size_t);
+    void (*sincos_cr_float)(float, float *, float *);
+    void (*sincos_cr_double)(double, double *, double *);
+    void (*sincos_cr_array_float)(float *, float *, float *, size_t);
+    void (*sincos_cr_array_double)(double *, double *, double *, size_t);
+    float (*sinpi_float)(float);
+    double (*sinpi_double)(double);
+    void (*sinpi_array_float)(float *, float *, size_t);
+    void (*sinpi_array_double)(double *, double *, size_t);
+    float (*cospi_float)(float);
+    double (*cospi_double)(double);
+    void (*cospi_array_float)(float *, float *, size_t);
+    void (*cospi_array_double)(double *, double *, size_t);
+    void (*sincospi_float)(float, float *, float *);
+    void (*sincospi_double)(double, double *, double *);
+    void (*sincospi_array_float)(float *, float *, float *, size_t);
+    void (*sincospi_array_double)(double *, double *, double *, size_t);
+    float (*sind_float)(float);
+    double (*sind_double)(double);
+    void (*sind_array_float)(float *, float *, size_t);
+    void (*sind_array_double)(double *, double *, size_t);
+    float (*cosd_float)(float);
+    double (*cosd_double)(double);
+    void (*cosd_array_float)(float *, float *, size_t);
+    void (*cosd_array_double)(double *, double *, size_t);
+    float (*tan_float)(float);
+    double (*tan_double)(double);
+    void (*tan_array_float)(float *, float *, size_t);
+    void (*tan_array_double)(double *, double *, size_t);
+} sincos_functions;
+
+#define SINCOS_FUNCTIONS(level) \
+    { \
+        &_sin_float_v##level, \
+        &_sin_double_v##level, \
+        &_sin_array_float_v##level, \
+        &_sin_array_double_v##level, \
+        &_cos_float_v##level, \
+        &_cos_double_v##level, \
+        &_cos_array_float_v##level, \
+        &_cos_array_double_v##level, \
+        &_sincos_float_v##level, \
+        &_sincos_double_v##level, \
+        &_sincos_array_float_v##level, \
+        &_sincos_array_double_v##level, \
+        &_sin_cr_float_v##level, \
+        &_sin_cr_double_v##level, \
+        &_sin_cr_array_float_v##level, \
+        &_sin_cr_array_double_v##level, \
+        &_cos_cr_float_v##level, \
+        &_cos_cr_double_v##level, \
+        &_cos_cr_array_float_v##level, \
+        &_cos_cr_array_double_v##level, \
+        &_sincos_cr_float_v##level, \
+        &_sincos_cr_double_v##level, \
+        &_sincos_cr_array_float_v##level, \
+        &_sincos_cr_array_double_v##level, \
+        &_sinpi_float_v##level, \
+        &_sinpi_double_v##level, \
+        &_sinpi_array_float_v##level, \
+        &_sinpi_array_double_v##level, \
+        &_cospi_float_v##level, \
+        &_cospi_double_v##level, \
+        &_cospi_array_float_v##level, \
+        &_cospi_array_double_v##level, \
+        &_sincospi_float_v##level, \
+        &_sincospi_double_v##level, \
+        &_sincospi_array_float_v##level, \
+        &_sincospi_array_double_v##level, \
+        &_sind_float_v##level, \
+        &_sind_double_v##level, \
+        &_sind_array_float_v##level, \
+        &_sind_array_double_v##level, \
+        &_cosd_float_v##level, \
+        &_cosd_double_v##level, \
+        &_cosd_array_float_v##level, \
+        &_cosd_array_double_v##level, \
+        &_tan_float_v##level, \
+        &_tan_double_v##level, \
+        &_tan_array_float_v##level, \
+        &_tan_array_double_v##level, \
+    }
+
+static const sincos_functions levels[5] = {
+    [2] = SINCOS_FUNCTIONS(2),
+    [3] = SINCOS_FUNCTIONS(3),
+    [4] = SINCOS_FUNCTIONS(4),
+};
+
+static int level = 2;
+static sincos_functions f = SINCOS_FUNCTIONS(2);
+
+static void
+__attribute__((constructor))
+init(void)
+{
+    level = isa_level();
+    f = levels[level];
+}
+
+int
+_sincos_isa_level(void)
+{
+    return level;
+}
+
+float
+_sin_float(float x)
+{
+    return (*f.sin_float)(x);
+}
+
+double
+_sin_double(double x)
+{
+    return (*f.sin_double)(x);
+}
+
+void
+_sin_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.sin_array_float)(xs, ys, n);
+}
+
+void
+_sin_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.sin_array_double)(xs, ys, n);
+}
+
+float
+_cos_float(float x)
+{
+    return (*f.cos_float)(x);
+}
+
+double
+_cos_double(double x)
+{
+    return (*f.cos_double)(x);
+}
+
+void
+_cos_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.cos_array_float)(xs, ys, n);
+}
+
+void
+_cos_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.cos_array_double)(xs, ys, n);
+}
+
+void
+_sincos_float(float x, float *sin_x, float *cos_x)
+{
+    (*f.sincos_float)(x, sin_x, cos_x);
+}
+
+void
+_sincos_double(double x, double *sin_x, double *cos_x)
+{
+    (*f.sincos_double)(x, sin_x, cos_x);
+}
+
+void
+_sincos_array_float(float xs[], float ss[], float cs[], size_t n)
+{
+    (*f.sincos_array_float)(xs, ss, cs, n);
+}
+
+void
+_sincos_array_double(double xs[], double ss[], double cs[], size_t n)
+{
+    (*f.sincos_array_double)(xs, ss, cs, n);
+}
+
+float
+_sin_cr_float(float x)
+{
+    return (*f.sin_cr_float)(x);
+}
+
+double
+_sin_cr_double(double x)
+{
+    return (*f.sin_cr_double)(x);
+}
+
+void
+_sin_cr_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.sin_cr_array_float)(xs, ys, n);
+}
+
+void
+_sin_cr_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.sin_cr_array_double)(xs, ys, n);
+}
+
+float
+_cos_cr_float(float x)
+{
+    return (*f.cos_cr_float)(x);
+}
+
+double
+_cos_cr_double(double x)
+{
+    return (*f.cos_cr_double)(x);
+}
+
+void
+_cos_cr_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.cos_cr_array_float)(xs, ys, n);
+}
+
+void
+_cos_cr_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.cos_cr_array_double)(xs, ys, n);
+}
+
+void
+_sincos_cr_float(float x, float *sin_x, float *cos_x)
+{
+    (*f.sincos_cr_float)(x, sin_x, cos_x);
+}
+
+void
+_sincos_cr_double(double x, double *sin_x, double *cos_x)
+{
+    (*f.sincos_cr_double)(x, sin_x, cos_x);
+}
+
+void
+_sincos_cr_array_float(float xs[], float ss[], float cs[], size_t n)
+{
+    (*f.sincos_cr_array_float)(xs, ss, cs, n);
+}
+
+void
+_sincos_cr_array_double(double xs[], double ss[], double cs[], size_t n)
+{
+    (*f.sincos_cr_array_double)(xs, ss, cs, n);
+}
+
+float
+_sinpi_float(float x)
+{
+    return (*f.sinpi_float)(x);
+}
+
+double
+_sinpi_double(double x)
+{
+    return (*f.sinpi_double)(x);
+}
+
+void
+_sinpi_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.sinpi_array_float)(xs, ys, n);
+}
+
+void
+_sinpi_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.sinpi_array_double)(xs, ys, n);
+}
+
+float
+_cospi_float(float x)
+{
+    return (*f.cospi_float)(x);
+}
+
+double
+_cospi_double(double x)
+{
+    return (*f.cospi_double)(x);
+}
+
+void
+_cospi_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.cospi_array_float)(xs, ys, n);
+}
+
+void
+_cospi_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.cospi_array_double)(xs, ys, n);
+}
+
+void
+_sincospi_float(float x, float *sin_x, float *cos_x)
+{
+    (*f.sincospi_float)(x, sin_x, cos_x);
+}
+
+void
+_sincospi_double(double x, double *sin_x, double *cos_x)
+{
+    (*f.sincospi_double)(x, sin_x, cos_x);
+}
+
+void
+_sincospi_array_float(float xs[], float ss[], float cs[], size_t n)
+{
+    (*f.sincospi_array_float)(xs, ss, cs, n);
+}
+
+void
+_sincospi_array_double(double xs[], double ss[], double cs[], size_t n)
+{
+    (*f.sincospi_array_double)(xs, ss, cs, n);
+}
+
+float
+_sind_float(float x)
+{
+    return (*f.sind_float)(x);
+}
+
+double
+_sind_double(double x)
+{
+    return (*f.sind_double)(x);
+}
+
+void
+_sind_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.sind_array_float)(xs, ys, n);
+}
+
+void
+_sind_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.sind_array_double)(xs, ys, n);
+}
+
+float
+_cosd_float(float x)
+{
+    return (*f.cosd_float)(x);
+}
+
+double
+_cosd_double(double x)
+{
+    return (*f.cosd_double)(x);
+}
+
+void
+_cosd_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.cosd_array_float)(xs, ys, n);
+}
+
+void
+_cosd_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.cosd_array_double)(xs, ys, n);
+}
+
+float
+_tan_float(float x)
+{
+    return (*f.tan_float)(x);
+}
+
+double
+_tan_double(double x)
+{
+    return (*f.tan_double)(x);
+}
+
+void
+_tan_array_float(float xs[], float ys[], size_t n)
+{
+    (*f.tan_array_float)(xs, ys, n);
+}
+
+void
+_tan_array_double(double xs[], double ys[], size_t n)
+{
+    (*f.tan_array_double)(xs, ys, n);
+}
@@ -0,0 +1,376 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/* Compile with -DNDEBUG, except for debugging. */
+
+#pragma once
+
+/*
+ * Vector kernels for the array functions of sincos.c, with AVX-512F or
+ * AVX2 and FMA intrinsics (simd.h). They perform the same operations as the scalar
+ * _sincos_pi_2, lane by lane and in the same order (the Cody-Waite
+ * reduction, _sincos_0_pi_2, and the quadrant selection), so the results
+ * are identical bit for bit.
+ *
+ * _sincos_simd_float and _sincos_simd_double compute at most
+ * SINCOS_SIMD_LANES_* elements, with masked loads and stores for the
+ * tail, and return 0 without storing anything if a lane needs the scalar
+ * path: Payne-Hanek (|x| ≥ PH_THRESHOLD_*), infinities and NaN.
+ * ss or cs may be NULL.
+ *
+ * There is no SSE4.2 kernel: x86-64-v2 has no FMA, so the scalar path
+ * rounds the products and the sums apart there (madd, arithmetic.h);
+ * so does ARITHMETIC_NO_FMA (make FMA=0), which disables these kernels.
+ * SINCOS_TABLE and POLYNOMIAL_ESTRIN use the scalar path only: these
+ * kernels evaluate the polynomials with Horner's scheme.
+ * Define SINCOS_NO_SIMD (make SIMD=0) to disable these kernels.
+ */
+
+#include <stddef.h> // size_t, NULL
+
+#include "cos.h" // _cos_as_*
+#include "cw.h" // CW_QUADRANT_BIAS_*, cw_parameters_pi_2_*
+#include "constants.h" // pi_2, etc.
+#include "ph.h" // PH_THRESHOLD_*
+#include "simd.h" // SIMD_WIDTH, _xfma_avx512_ps, etc.
+#include "sin.h" // _sin_as_*
+
+#if !defined(SINCOS_NO_SIMD) && !defined(SINCOS_TABLE) && !defined(POLYNOMIAL_ESTRIN) \
+    && defined(SIMD_WIDTH)
+#define SINCOS_SIMD SIMD_WIDTH
+#endif
+
+#if defined(SINCOS_SIMD) && SINCOS_SIMD == 512
+
+#define SINCOS_SIMD_LANES_FLOAT 16
+#define SINCOS_SIMD_LANES_DOUBLE 8
+
+static inline int
+__attribute__((always_inline))
+_sincos_simd_float(const float *xs, float *ss, float *cs, size_t n)
+{
+    const cw_parameters_float cw = cw_parameters_pi_2_float;
+    const size_t m = sizeof _sin_as_float / sizeof _sin_as_float[0];
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 one = _mm512_set1_ps(1.0f);
+    __mmask16 k = (__mmask16) ((1u << n) - 1);
+    __m512 x = _mm512_maskz_loadu_ps(k, xs);
+
+    // sin(-x) = -sin(x), cos(-x) = cos(x)
+    __mmask16 negative = _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ);
+    x = _neg_avx512_ps(negative, x);
+    __m512 sign = _neg_avx512_ps(negative, one);
+    __mmask16 ok = _mm512_cmp_ps_mask(x, _mm512_set1_ps(PH_THRESHOLD_FLOAT), _CMP_LT_OQ);
+    if ((ok & k) != k)
+        return 0;
+
+    // _cw_quadrant_pi_2
+    __m512 t = _cw_quotient_avx512_ps(cw, x);
+    __m512 q = _mm512_roundscale_ps(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m512 nq = _neg_avx512_ps(0xffff, q);
+    __m512 v2;
+    __m512 v1 = _cw_reduce_avx512_ps(cw, nq, x, &v2);
+    __mmask16 up = _mm512_cmp_ps_mask(_mm512_add_ps(v1, v2), zero, _CMP_LT_OQ);
+    v1 = _mm512_mask_add_ps(v1, up, v1, _mm512_set1_ps(cw.C1));
+    v2 = _mm512_mask_add_ps(v2, up, v2, _mm512_set1_ps(cw.C2));
+    q = _mm512_mask_sub_ps(q, up, q, one);
+
+    // x ≤ π∕2 is not reduced
+    __mmask16 reduced = _mm512_cmp_ps_mask(x, _mm512_set1_ps(pi_2(float)), _CMP_GT_OQ);
+    v1 = _mm512_mask_blend_ps(reduced, x, v1);
+    v2 = _mm512_maskz_mov_ps(reduced, v2);
+    __m512i qi = _mm512_castps_si512(_mm512_add_ps(q, _mm512_set1_ps(CW_QUADRANT_BIAS_FLOAT)));
+    __mmask16 odd = reduced & _mm512_test_epi32_mask(qi, _mm512_set1_epi32(1));
+    __mmask16 two = reduced & _mm512_test_epi32_mask(qi, _mm512_set1_epi32(2));
+
+    // _sincos_0_pi_2
+    __mmask16 swap = _mm512_cmp_ps_mask(v1, _mm512_set1_ps(0.5f * pi_2(float)), _CMP_GT_OQ);
+    __m512 y = _mm512_mask_sub_ps(v1, swap, _mm512_set1_ps(pi_2_hi(float)), v1);
+    __m512 yl = _mm512_mask_sub_ps(v2, swap, _mm512_set1_ps(pi_2_lo(float)), v2);
+
+    // _sincos_kernel
+    __m512 tt = _mm512_mul_ps(y, y);
+    __m512 te = _mm512_fmsub_ps(y, y, tt);
+    __m512 ps = _mm512_set1_ps(_sin_as_float[m - 1]);
+    __m512 pc = _mm512_set1_ps(_cos_as_float[m - 1]);
+    for (size_t i = 1; i < m; i++) {
+        ps = _mm512_fmadd_ps(ps, tt, _mm512_set1_ps(_sin_as_float[m - 1 - i]));
+        pc = _mm512_fmadd_ps(pc, tt, _mm512_set1_ps(_cos_as_float[m - 1 - i]));
+    }
+    __m512 s = _mm512_add_ps(y, _mm512_fmadd_ps(_mm512_mul_ps(y, tt), ps,
+        _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(-0.5f), tt), yl, yl)));
+    __m512 h = _mm512_mul_ps(_mm512_set1_ps(0.5f), tt);
+    __m512 w = _mm512_sub_ps(one, h);
+    __m512 we = _mm512_sub_ps(_mm512_sub_ps(one, w), h);
+    __m512 c = _mm512_add_ps(w, _mm512_sub_ps(
+        _mm512_fmadd_ps(_mm512_mul_ps(tt, tt), pc, _mm512_fmadd_ps(_mm512_set1_ps(-0.5f), te, we)),
+        _mm512_mul_ps(y, yl)));
+
+    // quadrant
+    __mmask16 exchange = swap ^ odd;
+    __m512 sin_x = _mm512_mask_blend_ps(exchange, s, c);
+    __m512 cos_x = _mm512_mask_blend_ps(exchange, c, s);
+    sin_x = _neg_avx512_ps(two, sin_x);
+    cos_x = _neg_avx512_ps(two ^ odd, cos_x);
+    __mmask16 tiny = _mm512_cmp_ps_mask(x, _mm512_set1_ps(2.7e-4f), _CMP_LE_OQ);
+    sin_x = _mm512_mask_blend_ps(tiny, sin_x, x);
+    sin_x = _mm512_mul_ps(sign, sin_x);
+
+    if (ss != NULL)
+        _mm512_mask_storeu_ps(ss, k, sin_x);
+    if (cs != NULL)
+        _mm512_mask_storeu_ps(cs, k, cos_x);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_sincos_simd_double(const double *xs, double *ss, double *cs, size_t n)
+{
+    const cw_parameters_double cw = cw_parameters_pi_2_double;
+    const size_t m = sizeof _sin_as_double / sizeof _sin_as_double[0];
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d one = _mm512_set1_pd(1.0);
+    __mmask8 k = (__mmask8) ((1u << n) - 1);
+    __m512d x = _mm512_maskz_loadu_pd(k, xs);
+
+    // sin(-x) = -sin(x), cos(-x) = cos(x)
+    __mmask8 negative = _mm512_cmp_pd_mask(x, zero, _CMP_LT_OQ);
+    x = _neg_avx512_pd(negative, x);
+    __m512d sign = _neg_avx512_pd(negative, one);
+    __mmask8 ok = _mm512_cmp_pd_mask(x, _mm512_set1_pd(PH_THRESHOLD_DOUBLE), _CMP_LT_OQ);
+    if ((ok & k) != k)
+        return 0;
+
+    // _cw_quadrant_pi_2
+    __m512d t = _cw_quotient_avx512_pd(cw, x);
+    __m512d q = _mm512_roundscale_pd(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m512d nq = _neg_avx512_pd(0xff, q);
+    __m512d v2;
+    __m512d v1 = _cw_reduce_avx512_pd(cw, nq, x, &v2);
+    __mmask8 up = _mm512_cmp_pd_mask(_mm512_add_pd(v1, v2), zero, _CMP_LT_OQ);
+    v1 = _mm512_mask_add_pd(v1, up, v1, _mm512_set1_pd(cw.C1));
+    v2 = _mm512_mask_add_pd(v2, up, v2, _mm512_set1_pd(cw.C2));
+    q = _mm512_mask_sub_pd(q, up, q, one);
+
+    // x ≤ π∕2 is not reduced
+    __mmask8 reduced = _mm512_cmp_pd_mask(x, _mm512_set1_pd(pi_2(double)), _CMP_GT_OQ);
+    v1 = _mm512_mask_blend_pd(reduced, x, v1);
+    v2 = _mm512_maskz_mov_pd(reduced, v2);
+    __m512i qi = _mm512_castpd_si512(_mm512_add_pd(q, _mm512_set1_pd(CW_QUADRANT_BIAS_DOUBLE)));
+    __mmask8 odd = reduced & _mm512_test_epi64_mask(qi, _mm512_set1_epi64(1));
+    __mmask8 two = reduced & _mm512_test_epi64_mask(qi, _mm512_set1_epi64(2));
+
+    // _sincos_0_pi_2
+    __mmask8 swap = _mm512_cmp_pd_mask(v1, _mm512_set1_pd(0.5 * pi_2(double)), _CMP_GT_OQ);
+    __m512d y = _mm512_mask_sub_pd(v1, swap, _mm512_set1_pd(pi_2_hi(double)), v1);
+    __m512d yl = _mm512_mask_sub_pd(v2, swap, _mm512_set1_pd(pi_2_lo(double)), v2);
+
+    // _sincos_kernel
+    __m512d tt = _mm512_mul_pd(y, y);
+    __m512d te = _mm512_fmsub_pd(y, y, tt);
+    __m512d ps = _mm512_set1_pd(_sin_as_double[m - 1]);
+    __m512d pc = _mm512_set1_pd(_cos_as_double[m - 1]);
+    for (size_t i = 1; i < m; i++) {
+        ps = _mm512_fmadd_pd(ps, tt, _mm512_set1_pd(_sin_as_double[m - 1 - i]));
+        pc = _mm512_fmadd_pd(pc, tt, _mm512_set1_pd(_cos_as_double[m - 1 - i]));
+    }
+    __m512d s = _mm512_add_pd(y, _mm512_fmadd_pd(_mm512_mul_pd(y, tt), ps,
+        _mm512_fmadd_pd(_mm512_mul_pd(_mm512_set1_pd(-0.5), tt), yl, yl)));
+    __m512d h = _mm512_mul_pd(_mm512_set1_pd(0.5), tt);
+    __m512d w = _mm512_sub_pd(one, h);
+    __m512d we = _mm512_sub_pd(_mm512_sub_pd(one, w), h);
+    __m512d c = _mm512_add_pd(w, _mm512_sub_pd(
+        _mm512_fmadd_pd(_mm512_mul_pd(tt, tt), pc, _mm512_fmadd_pd(_mm512_set1_pd(-0.5), te, we)),
+        _mm512_mul_pd(y, yl)));
+
+    // quadrant
+    __mmask8 exchange = swap ^ odd;
+    __m512d sin_x = _mm512_mask_blend_pd(exchange, s, c);
+    __m512d cos_x = _mm512_mask_blend_pd(exchange, c, s);
+    sin_x = _neg_avx512_pd(two, sin_x);
+    cos_x = _neg_avx512_pd(two ^ odd, cos_x);
+    __mmask8 tiny = _mm512_cmp_pd_mask(x, _mm512_set1_pd(2.1e-8f), _CMP_LE_OQ);
+    sin_x = _mm512_mask_blend_pd(tiny, sin_x, x);
+    sin_x = _mm512_mul_pd(sign, sin_x);
+
+    if (ss != NULL)
+        _mm512_mask_storeu_pd(ss, k, sin_x);
+    if (cs != NULL)
+        _mm512_mask_storeu_pd(cs, k, cos_x);
+    return 1;
+}
+
+#elif defined(SINCOS_SIMD) && SINCOS_SIMD == 256
+
+#define SINCOS_SIMD_LANES_FLOAT 8
+#define SINCOS_SIMD_LANES_DOUBLE 4
+
+static inline int
+__attribute__((always_inline))
+_sincos_simd_float(const float *xs, float *ss, float *cs, size_t n)
+{
+    const cw_parameters_float cw = cw_parameters_pi_2_float;
+    const size_t m = sizeof _sin_as_float / sizeof _sin_as_float[0];
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    __m256i ki = _mm256_cmpgt_epi32(_mm256_set1_epi32((int) n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256 k = _mm256_castsi256_ps(ki);
+    __m256 x = _mm256_maskload_ps(xs, ki);
+
+    // sin(-x) = -sin(x), cos(-x) = cos(x)
+    __m256 negative = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+    x = _neg_avx2_ps(negative, x);
+    __m256 sign = _neg_avx2_ps(negative, one);
+    __m256 ok = _mm256_cmp_ps(x, _mm256_set1_ps(PH_THRESHOLD_FLOAT), _CMP_LT_OQ);
+    if (_mm256_movemask_ps(_mm256_andnot_ps(ok, k)) != 0)
+        return 0;
+
+    // _cw_quadrant_pi_2
+    __m256 t = _cw_quotient_avx2_ps(cw, x);
+    __m256 q = _mm256_round_ps(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m256 nq = _neg_avx2_ps(all, q);
+    __m256 v2;
+    __m256 v1 = _cw_reduce_avx2_ps(cw, nq, x, &v2);
+    __m256 up = _mm256_cmp_ps(_mm256_add_ps(v1, v2), zero, _CMP_LT_OQ);
+    v1 = _mm256_blendv_ps(v1, _mm256_add_ps(v1, _mm256_set1_ps(cw.C1)), up);
+    v2 = _mm256_blendv_ps(v2, _mm256_add_ps(v2, _mm256_set1_ps(cw.C2)), up);
+    q = _mm256_blendv_ps(q, _mm256_sub_ps(q, one), up);
+
+    // x ≤ π∕2 is not reduced
+    __m256 reduced = _mm256_cmp_ps(x, _mm256_set1_ps(pi_2(float)), _CMP_GT_OQ);
+    v1 = _mm256_blendv_ps(x, v1, reduced);
+    v2 = _mm256_and_ps(reduced, v2);
+    __m256i qi = _mm256_castps_si256(_mm256_add_ps(q, _mm256_set1_ps(CW_QUADRANT_BIAS_FLOAT)));
+    __m256i bit0 = _mm256_and_si256(qi, _mm256_set1_epi32(1));
+    __m256i bit1 = _mm256_and_si256(qi, _mm256_set1_epi32(2));
+    __m256 odd = _mm256_and_ps(reduced,
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(bit0, _mm256_set1_epi32(1))));
+    __m256 two = _mm256_and_ps(reduced,
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(bit1, _mm256_set1_epi32(2))));
+
+    // _sincos_0_pi_2
+    __m256 swap = _mm256_cmp_ps(v1, _mm256_set1_ps(0.5f * pi_2(float)), _CMP_GT_OQ);
+    __m256 y = _mm256_blendv_ps(v1, _mm256_sub_ps(_mm256_set1_ps(pi_2_hi(float)), v1), swap);
+    __m256 yl = _mm256_blendv_ps(v2, _mm256_sub_ps(_mm256_set1_ps(pi_2_lo(float)), v2), swap);
+
+    // _sincos_kernel
+    __m256 tt = _mm256_mul_ps(y, y);
+    __m256 te = _mm256_fmsub_ps(y, y, tt);
+    __m256 ps = _mm256_set1_ps(_sin_as_float[m - 1]);
+    __m256 pc = _mm256_set1_ps(_cos_as_float[m - 1]);
+    for (size_t i = 1; i < m; i++) {
+        ps = _mm256_fmadd_ps(ps, tt, _mm256_set1_ps(_sin_as_float[m - 1 - i]));
+        pc = _mm256_fmadd_ps(pc, tt, _mm256_set1_ps(_cos_as_float[m - 1 - i]));
+    }
+    __m256 s = _mm256_add_ps(y, _mm256_fmadd_ps(_mm256_mul_ps(y, tt), ps,
+        _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(-0.5f), tt), yl, yl)));
+    __m256 h = _mm256_mul_ps(_mm256_set1_ps(0.5f), tt);
+    __m256 w = _mm256_sub_ps(one, h);
+    __m256 we = _mm256_sub_ps(_mm256_sub_ps(one, w), h);
+    __m256 c = _mm256_add_ps(w, _mm256_sub_ps(
+        _mm256_fmadd_ps(_mm256_mul_ps(tt, tt), pc, _mm256_fmadd_ps(_mm256_set1_ps(-0.5f), te, we)),
+        _mm256_mul_ps(y, yl)));
+
+    // quadrant
+    __m256 exchange = _mm256_xor_ps(swap, odd);
+    __m256 sin_x = _mm256_blendv_ps(s, c, exchange);
+    __m256 cos_x = _mm256_blendv_ps(c, s, exchange);
+    sin_x = _neg_avx2_ps(two, sin_x);
+    cos_x = _neg_avx2_ps(_mm256_xor_ps(two, odd), cos_x);
+    __m256 tiny = _mm256_cmp_ps(x, _mm256_set1_ps(2.7e-4f), _CMP_LE_OQ);
+    sin_x = _mm256_blendv_ps(sin_x, x, tiny);
+    sin_x = _mm256_mul_ps(sign, sin_x);
+
+    if (ss != NULL)
+        _mm256_maskstore_ps(ss, ki, sin_x);
+    if (cs != NULL)
+        _mm256_maskstore_ps(cs, ki, cos_x);
+    return 1;
+}
+
+static inline int
+__attribute__((always_inline))
+_sincos_simd_double(const double *xs, double *ss, double *cs, size_t n)
+{
+    const cw_parameters_double cw = cw_parameters_pi_2_double;
+    const size_t m = sizeof _sin_as_double / sizeof _sin_as_double[0];
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    __m256i ki = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long) n), _mm256_setr_epi64x(0, 1, 2, 3));
+    __m256d k = _mm256_castsi256_pd(ki);
+    __m256d x = _mm256_maskload_pd(xs, ki);
+
+    // sin(-x) = -sin(x), cos(-x) = cos(x)
+    __m256d negative = _mm256_cmp_pd(x, zero, _CMP_LT_OQ);
+    x = _neg_avx2_pd(negative, x);
+    __m256d sign = _neg_avx2_pd(negative, one);
+    __m256d ok = _mm256_cmp_pd(x, _mm256_set1_pd(PH_THRESHOLD_DOUBLE), _CMP_LT_OQ);
+    if (_mm256_movemask_pd(_mm256_andnot_pd(ok, k)) != 0)
+        return 0;
+
+    // _cw_quadrant_pi_2
+    __m256d t = _cw_quotient_avx2_pd(cw, x);
+    __m256d q = _mm256_round_pd(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m256d nq = _neg_avx2_pd(all, q);
+    __m256d v2;
+    __m256d v1 = _cw_reduce_avx2_pd(cw, nq, x, &v2);
+    __m256d up = _mm256_cmp_pd(_mm256_add_pd(v1, v2), zero, _CMP_LT_OQ);
+    v1 = _mm256_blendv_pd(v1, _mm256_add_pd(v1, _mm256_set1_pd(cw.C1)), up);
+    v2 = _mm256_blendv_pd(v2, _mm256_add_pd(v2, _mm256_set1_pd(cw.C2)), up);
+    q = _mm256_blendv_pd(q, _mm256_sub_pd(q, one), up);
+
+    // x ≤ π∕2 is not reduced
+    __m256d reduced = _mm256_cmp_pd(x, _mm256_set1_pd(pi_2(double)), _CMP_GT_OQ);
+    v1 = _mm256_blendv_pd(x, v1, reduced);
+    v2 = _mm256_and_pd(reduced, v2);
+    __m256i qi = _mm256_castpd_si256(_mm256_add_pd(q, _mm256_set1_pd(CW_QUADRANT_BIAS_DOUBLE)));
+    __m256i bit0 = _mm256_and_si256(qi, _mm256_set1_epi64x(1));
+    __m256i bit1 = _mm256_and_si256(qi, _mm256_set1_epi64x(2));
+    __m256d odd = _mm256_and_pd(reduced,
+        _mm256_castsi256_pd(_mm256_cmpeq_epi64(bit0, _mm256_set1_epi64x(1))));
+    __m256d two = _mm256_and_pd(reduced,
+        _mm256_castsi256_pd(_mm256_cmpeq_epi64(bit1, _mm256_set1_epi64x(2))));
+
+    // _sincos_0_pi_2
+    __m256d swap = _mm256_cmp_pd(v1, _mm256_set1_pd(0.5 * pi_2(double)), _CMP_GT_OQ);
+    __m256d y = _mm256_blendv_pd(v1, _mm256_sub_pd(_mm256_set1_pd(pi_2_hi(double)), v1), swap);
+    __m256d yl = _mm256_blendv_pd(v2, _mm256_sub_pd(_mm256_set1_pd(pi_2_lo(double)), v2), swap);
+
+    // _sincos_kernel
+    __m256d tt = _mm256_mul_pd(y, y);
+    __m256d te = _mm256_fmsub_pd(y, y, tt);
+    __m256d ps = _mm256_set1_pd(_sin_as_double[m - 1]);
+    __m256d pc = _mm256_set1_pd(_cos_as_double[m - 1]);
+    for (size_t i = 1; i < m; i++) {
+        ps = _mm256_fmadd_pd(ps, tt, _mm256_set1_pd(_sin_as_double[m - 1 - i]));
+        pc = _mm256_fmadd_pd(pc, tt, _mm256_set1_pd(_cos_as_double[m - 1 - i]));
+    }
+    __m256d s = _mm256_add_pd(y, _mm256_fmadd_pd(_mm256_mul_pd(y, tt), ps,
+        _mm256_fmadd_pd(_mm256_mul_pd(_mm256_set1_pd(-0.5), tt), yl, yl)));
+    __m256d h = _mm256_mul_pd(_mm256_set1_pd(0.5), tt);
+    __m256d w = _mm256_sub_pd(one, h);
+    __m256d we = _mm256_sub_pd(_mm256_sub_pd(one, w), h);
+    __m256d c = _mm256_add_pd(w, _mm256_sub_pd(
+        _mm256_fmadd_pd(_mm256_mul_pd(tt, tt), pc, _mm256_fmadd_pd(_mm256_set1_pd(-0.5), te, we)),
+        _mm256_mul_pd(y, yl)));
+
+    // quadrant
+    __m256d exchange = _mm256_xor_pd(swap, odd);
+    __m256d sin_x = _mm256_blendv_pd(s, c, exchange);
+    __m256d cos_x = _mm256_blendv_pd(c, s, exchange);
+    sin_x = _neg_avx2_pd(two, sin_x);
+    cos_x = _neg_avx2_pd(_mm256_xor_pd(two, odd), cos_x);
+    __m256d tiny = _mm256_cmp_pd(x, _mm256_set1_pd(2.1e-8f), _CMP_LE_OQ);
+    sin_x = _mm256_blendv_pd(sin_x, x, tiny);
+    sin_x = _mm256_mul_pd(sign, sin_x);
+
+    if (ss != NULL)
+        _mm256_maskstore_pd(ss, ki, sin_x);
+    if (cs != NULL)
+        _mm256_maskstore_pd(cs, ki, cos_x);
+    return 1;
+}
+
+#endif
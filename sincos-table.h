@@ -0,0 +1,280 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/* Compile with -DNDEBUG, except for debugging. */
+
+#pragma once
+
+#include <assert.h>
+#include <stddef.h> // size_t
+
+#include "arithmetic.h" // add, madd, mul, nmadd
+#include "constants.h" // pi_2, inv_pi_2
+#include "polynomial.h" // eval_polynomial_*1
+#include "reduce.h" // QUADRANT_BIAS_*
+#include "types.h" // tuple_float, tuple_double
+
+/*
+ * Table-driven sin(x) and cos(x) on [0, π∕2], selected with SINCOS_TABLE
+ * (make TABLE=1) in sincos.c, after the same argument reduction.
+ * x is split into j⋅π∕64 and a remainder u, the table holds sin(j⋅π∕64)
+ * and cos(j⋅π∕64) in double-double (float-float), and the short polynomials
+ * approximate sin(u) and cos(u) on [0, π∕128]. [1]
+ *
+ * The tables are generated by gen-sincos-table.c, and the polynomials by
+ * remez.c (./remez sin|cos float|double 0 128).
+ *
+ * [1] S. Gal and B. Bachelis. An accurate elementary mathematical library
+ *     for the IEEE floating point standard. ACM Trans. Math. Softw. 17, 1
+ *     (March 1991), 26-45.
+ */
+
+// sin(j⋅π∕64) ≅ _sin_table_float[j] + _sin_table_lo_float[j]
+static const float _sin_table_float[33] = {
+    0.000000000e+00f, 4.906767607e-02f, 9.801714122e-02f,
+    1.467304677e-01f, 1.950903237e-01f, 2.429801822e-01f,
+    2.902846634e-01f, 3.368898630e-01f, 3.826834261e-01f,
+    4.275550842e-01f, 4.713967443e-01f, 5.141027570e-01f,
+    5.555702448e-01f, 5.956993103e-01f, 6.343932748e-01f,
+    6.715589762e-01f, 7.071067691e-01f, 7.409511209e-01f,
+    7.730104327e-01f, 8.032075167e-01f, 8.314695954e-01f,
+    8.577286005e-01f, 8.819212914e-01f, 9.039893150e-01f,
+    9.238795042e-01f, 9.415440559e-01f, 9.569403529e-01f,
+    9.700312614e-01f, 9.807852507e-01f, 9.891765118e-01f,
+    9.951847196e-01f, 9.987954497e-01f, 1.000000000e+00f,
+};
+static const float _sin_table_lo_float[33] = {
+    0.000000000e+00f, -1.739934308e-09f, -8.933931928e-10f,
+    6.778245520e-09f, -1.670471428e-09f, -2.267604104e-09f,
+    1.381566506e-08f, -9.622000974e-09f, 6.223350724e-09f,
+    9.201766460e-09f, -7.425253745e-09f, -1.278385930e-08f,
+    -1.176952136e-08f, -5.810301129e-09f, 9.379557575e-09f,
+    -2.132638244e-08f, 1.210161749e-08f, 4.501535145e-09f,
+    2.064255256e-08f, 1.481041778e-08f, 1.687026341e-08f,
+    9.498258180e-09f, -2.700296342e-08f, -2.190951598e-08f,
+    2.830748969e-08f, 9.244300436e-09f, -1.718450804e-08f,
+    -8.249547712e-09f, 2.973947311e-08f, -1.799745353e-09f,
+    7.109666189e-09f, 6.471438052e-09f, 0.000000000e+00f,
+};
+
+// cos(j⋅π∕64) ≅ _cos_table_float[j] + _cos_table_lo_float[j]
+static const float _cos_table_float[33] = {
+    1.000000000e+00f, 9.987954497e-01f, 9.951847196e-01f,
+    9.891765118e-01f, 9.807852507e-01f, 9.700312614e-01f,
+    9.569403529e-01f, 9.415440559e-01f, 9.238795042e-01f,
+    9.039893150e-01f, 8.819212914e-01f, 8.577286005e-01f,
+    8.314695954e-01f, 8.032075167e-01f, 7.730104327e-01f,
+    7.409511209e-01f, 7.071067691e-01f, 6.715589762e-01f,
+    6.343932748e-01f, 5.956993103e-01f, 5.555702448e-01f,
+    5.141027570e-01f, 4.713967443e-01f, 4.275550842e-01f,
+    3.826834261e-01f, 3.368898630e-01f, 2.902846634e-01f,
+    2.429801822e-01f, 1.950903237e-01f, 1.467304677e-01f,
+    9.801714122e-02f, 4.906767607e-02f, 0.000000000e+00f,
+};
+static const float _cos_table_lo_float[33] = {
+    0.000000000e+00f, 6.471438052e-09f, 7.109666189e-09f,
+    -1.799745353e-09f, 2.973947311e-08f, -8.249547712e-09f,
+    -1.718450804e-08f, 9.244300436e-09f, 2.830748969e-08f,
+    -2.190951598e-08f, -2.700296342e-08f, 9.498258180e-09f,
+    1.687026341e-08f, 1.481041778e-08f, 2.064255256e-08f,
+    4.501535145e-09f, 1.210161749e-08f, -2.132638244e-08f,
+    9.379557575e-09f, -5.810301129e-09f, -1.176952136e-08f,
+    -1.278385930e-08f, -7.425253745e-09f, 9.201766460e-09f,
+    6.223350724e-09f, -9.622000974e-09f, 1.381566506e-08f,
+    -2.267604104e-09f, -1.670471428e-09f, 6.778245520e-09f,
+    -8.933931928e-10f, -1.739934308e-09f, 0.000000000e+00f,
+};
+
+// sin(j⋅π∕64) ≅ _sin_table_double[j] + _sin_table_lo_double[j]
+static const double _sin_table_double[33] = {
+    0.00000000000000000e+00, 4.90676743274180149e-02, 9.80171403295606036e-02,
+    1.46730474455361748e-01, 1.95090322016128276e-01, 2.42980179903263899e-01,
+    2.90284677254462387e-01, 3.36889853392220051e-01, 3.82683432365089782e-01,
+    4.27555093430282085e-01, 4.71396736825997642e-01, 5.14102744193221772e-01,
+    5.55570233019602178e-01, 5.95699304492433357e-01, 6.34393284163645488e-01,
+    6.71558954847018441e-01, 7.07106781186547573e-01, 7.40951125354959106e-01,
+    7.73010453362736993e-01, 8.03207531480644943e-01, 8.31469612302545236e-01,
+    8.57728610000272118e-01, 8.81921264348355050e-01, 9.03989293123443338e-01,
+    9.23879532511286738e-01, 9.41544065183020806e-01, 9.56940335732208824e-01,
+    9.70031253194543974e-01, 9.80785280403230431e-01, 9.89176509964781014e-01,
+    9.95184726672196929e-01, 9.98795456205172405e-01, 1.00000000000000000e+00,
+};
+static const double _sin_table_lo_double[33] = {
+    0.00000000000000000e+00, -6.79610372051828011e-19, -1.63458236224425599e-18,
+    3.72694714704656775e-18, -7.99107906846173126e-18, -8.75143152971966316e-18,
+    -1.89279787077742515e-17, -4.20009400334750924e-19, -1.00507726964615876e-17,
+    9.41118981629547262e-18, 6.51667813606901296e-18, -4.57127075236156240e-17,
+    4.70941094056167682e-17, -1.34386419365794672e-17, 1.04209019292800346e-17,
+    -4.04890377492966925e-17, -4.83364665672645673e-17, -1.47086169522973452e-17,
+    -3.25659070336497723e-17, -3.30606098048149096e-17, 1.40738569847280239e-18,
+    -4.81834479363366201e-17, -1.98432484058905621e-17, -6.60975446874843085e-18,
+    1.76450470843366771e-17, -2.78963795476983411e-17, 4.05538698618757006e-17,
+    1.83653003484288444e-17, 1.85469399978250057e-17, -4.09873099370471114e-17,
+    -4.24869136783044096e-17, -1.22916933370754648e-17, 0.00000000000000000e+00,
+};
+
+// cos(j⋅π∕64) ≅ _cos_table_double[j] + _cos_table_lo_double[j]
+static const double _cos_table_double[33] = {
+    1.00000000000000000e+00, 9.98795456205172405e-01, 9.95184726672196929e-01,
+    9.89176509964781014e-01, 9.80785280403230431e-01, 9.70031253194543974e-01,
+    9.56940335732208824e-01, 9.41544065183020806e-01, 9.23879532511286738e-01,
+    9.03989293123443338e-01, 8.81921264348355050e-01, 8.57728610000272118e-01,
+    8.31469612302545236e-01, 8.03207531480644943e-01, 7.73010453362736993e-01,
+    7.40951125354959106e-01, 7.07106781186547573e-01, 6.71558954847018441e-01,
+    6.34393284163645488e-01, 5.95699304492433357e-01, 5.55570233019602178e-01,
+    5.14102744193221772e-01, 4.71396736825997642e-01, 4.27555093430282085e-01,
+    3.82683432365089782e-01, 3.36889853392220051e-01, 2.90284677254462387e-01,
+    2.42980179903263899e-01, 1.95090322016128276e-01, 1.46730474455361748e-01,
+    9.80171403295606036e-02, 4.90676743274180149e-02, 0.00000000000000000e+00,
+};
+static const double _cos_table_lo_double[33] = {
+    0.00000000000000000e+00, -1.22916933370754648e-17, -4.24869136783044096e-17,
+    -4.09873099370471114e-17, 1.85469399978250057e-17, 1.83653003484288444e-17,
+    4.05538698618757006e-17, -2.78963795476983411e-17, 1.76450470843366771e-17,
+    -6.60975446874843085e-18, -1.98432484058905621e-17, -4.81834479363366201e-17,
+    1.40738569847280239e-18, -3.30606098048149096e-17, -3.25659070336497723e-17,
+    -1.47086169522973452e-17, -4.83364665672645673e-17, -4.04890377492966925e-17,
+    1.04209019292800346e-17, -1.34386419365794672e-17, 4.70941094056167682e-17,
+    -4.57127075236156240e-17, 6.51667813606901296e-18, 9.41118981629547262e-18,
+    -1.00507726964615876e-17, -4.20009400334750924e-19, -1.89279787077742515e-17,
+    -8.75143152971966316e-18, -7.99107906846173126e-18, 3.72694714704656775e-18,
+    -1.63458236224425599e-18, -6.79610372051828011e-19, 0.00000000000000000e+00,
+};
+
+/*
+ * sin(x) ≅ x + x³⋅S(x²) on [0, π∕128],
+ * relative error < 2^-30.8 (./remez sin float 1 128).
+ */
+
+static const float _sin_table_as_float[1] = {
+    /* x^3 */ -1.666624844e-01f,
+};
+
+/*
+ * cos(x) ≅ 1 - x²∕2 + x⁴⋅C(x²) on [0, π∕128],
+ * relative error < 2^-44.8 (./remez cos float 1 128).
+ */
+
+static const float _cos_table_as_float[1] = {
+    /* x^4 */ 4.166591540e-02f,
+};
+
+/*
+ * sin(x) ≅ x + x³⋅S(x²) on [0, π∕128],
+ * relative error < 2^-67.9 (./remez sin double 3 128).
+ */
+
+static const double _sin_table_as_double[3] = {
+    /* x^3 */ -1.66666666666666546e-01,
+    /* x^5 */ 8.33333333215534669e-03,
+    /* x^7 */ -1.98409418638370637e-04,
+};
+
+/*
+ * cos(x) ≅ 1 - x²∕2 + x⁴⋅C(x²) on [0, π∕128],
+ * relative error < 2^-63.8 (./remez cos double 2 128).
+ */
+
+static const double _cos_table_as_double[2] = {
+    /* x^4 */ 4.16666666614158021e-02,
+    /* x^6 */ -1.38886548429217297e-03,
+};
+
+/*
+ * Return {sin(x + xₗ), cos(x + xₗ)} for x in [0, π∕2] and a small xₗ:
+ *
+ *     x + xₗ = j⋅π∕64 + u + uₗ, |u| ≤ π∕128
+ *     sin(x) = sin(j⋅π∕64)⋅cos(u + uₗ) + cos(j⋅π∕64)⋅sin(u + uₗ)
+ *     cos(x) = cos(j⋅π∕64)⋅cos(u + uₗ) - sin(j⋅π∕64)⋅sin(u + uₗ)
+ *
+ * where π∕64 = (π∕2ₕᵢ + π∕2ₗₒ)∕32. If j ≥ 1, then x > 2⁻⁶, so x and
+ * j⋅π∕64ₕᵢ are multiples of ulp(2⁻⁶), and u = x - j⋅π∕64ₕᵢ < 2⁻⁵ is exact,
+ * with or without fma (nmadd).
+ * The leading terms sin(j⋅π∕64) + cos(j⋅π∕64)⋅u are summed with error-free
+ * transformations, and the rest is less than 2⁻⁸ of the result.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_table_float(float x, float xl)
+{
+    assert(x >= 0.0f && x <= pi_2(float));
+    const size_t ns = sizeof _sin_table_as_float / sizeof _sin_table_as_float[0];
+    const size_t nc = sizeof _cos_table_as_float / sizeof _cos_table_as_float[0];
+    const float bias = QUADRANT_BIAS_FLOAT;
+
+    // j = x⋅64∕π rounded to nearest, in [0, 32]
+    float z = madd(x, 0x1.0p5f * inv_pi_2(float), bias);
+    float k = z - bias;
+    int j = (int) k;
+    float u = nmadd(k, 0x1.0p-5f * pi_2_hi(float), x);
+    float ul = madd(-k, 0x1.0p-5f * pi_2_lo(float), xl);
+
+    // sin(u + uₗ) - u and cos(u + uₗ) - 1
+    float t = u * u;
+    float ps = eval_polynomial_float1(_sin_table_as_float, ns, t);
+    float pc = eval_polynomial_float1(_cos_table_as_float, nc, t);
+    float su = madd(u * t, ps, ul);
+    float cu = madd(-u, ul, madd(t * t, pc, -0.5f * t));
+
+    float S = _sin_table_float[j];
+    float Sl = _sin_table_lo_float[j];
+    float C = _cos_table_float[j];
+    float Cl = _cos_table_lo_float[j];
+
+    tuple_float p = mul(C, u);
+    tuple_float q = add(S, p.a);
+    float sin_x = q.a + (q.b + madd(C, su, madd(S, cu, madd(Cl, u, Sl + p.b))));
+
+    p = mul(-S, u);
+    q = add(C, p.a);
+    float cos_x = q.a + (q.b + madd(-S, su, madd(C, cu, madd(-Sl, u, Cl + p.b))));
+
+    return (tuple_float) {sin_x, cos_x};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_table_double(double x, double xl)
+{
+    assert(x >= 0.0 && x <= pi_2(double));
+    const size_t ns = sizeof _sin_table_as_double / sizeof _sin_table_as_double[0];
+    const size_t nc = sizeof _cos_table_as_double / sizeof _cos_table_as_double[0];
+    const double bias = QUADRANT_BIAS_DOUBLE;
+
+    // j = x⋅64∕π rounded to nearest, in [0, 32]
+    double z = madd(x, 0x1.0p5 * inv_pi_2(double), bias);
+    double k = z - bias;
+    int j = (int) k;
+    double u = nmadd(k, 0x1.0p-5 * pi_2_hi(double), x);
+    double ul = madd(-k, 0x1.0p-5 * pi_2_lo(double), xl);
+
+    // sin(u + uₗ) - u and cos(u + uₗ) - 1
+    double t = u * u;
+    double ps = eval_polynomial_double1(_sin_table_as_double, ns, t);
+    double pc = eval_polynomial_double1(_cos_table_as_double, nc, t);
+    double su = madd(u * t, ps, ul);
+    double cu = madd(-u, ul, madd(t * t, pc, -0.5 * t));
+
+    double S = _sin_table_double[j];
+    double Sl = _sin_table_lo_double[j];
+    double C = _cos_table_double[j];
+    double Cl = _cos_table_lo_double[j];
+
+    tuple_double p = mul(C, u);
+    tuple_double q = add(S, p.a);
+    double sin_x = q.a + (q.b + madd(C, su, madd(S, cu, madd(Cl, u, Sl + p.b))));
+
+    p = mul(-S, u);
+    q = add(C, p.a);
+    double cos_x = q.a + (q.b + madd(-S, su, madd(C, cu, madd(-Sl, u, Cl + p.b))));
+
+    return (tuple_double) {sin_x, cos_x};
+}
+
+#define _sincos_table(x, xl) \
+    _Generic((x), \
+        float: _sincos_table_float, \
+        double: _sincos_table_double \
+    )(x, xl)
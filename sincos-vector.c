@@ -0,0 +1,57 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#include <stddef.h> // size_t
+#include <string.h> // memcpy
+
+#include "sincos-vector.h"
+#include "sincos.h"
+
+/*
+ * The variants of the vector function ABI declared in sincos-vector.h.
+ * Each one passes its lanes to the array function, which uses the best
+ * kernel of this processor (sincos-dispatch.c, sincos-simd.h), whatever
+ * the variant: a loop compiled for SSE still runs the AVX-512 kernel.
+ */
+
+#if defined(__x86_64__)
+
+typedef float float4 __attribute__((vector_size(16)));
+typedef float float8 __attribute__((vector_size(32)));
+typedef float float16 __attribute__((vector_size(64)));
+typedef double double2 __attribute__((vector_size(16)));
+typedef double double4 __attribute__((vector_size(32)));
+typedef double double8 __attribute__((vector_size(64)));
+
+#define SINCOS_VECTOR_FUNCTION(isa, features, lanes, T, V, f) \
+    V _ZGV##isa##N##lanes##v_##f##_##T(V x); \
+    __attribute__((target(features))) \
+    V \
+    _ZGV##isa##N##lanes##v_##f##_##T(V x) \
+    { \
+        T xs[lanes], ys[lanes]; \
+        memcpy(xs, &x, sizeof xs); \
+        f##_array_##T(xs, ys, lanes); \
+        V y; \
+        memcpy(&y, ys, sizeof ys); \
+        return y; \
+    }
+
+SINCOS_VECTOR_FUNCTION(b, "sse2", 4, float, float4, _sin)
+SINCOS_VECTOR_FUNCTION(c, "avx", 8, float, float8, _sin)
+SINCOS_VECTOR_FUNCTION(d, "avx2", 8, float, float8, _sin)
+SINCOS_VECTOR_FUNCTION(e, "avx512f", 16, float, float16, _sin)
+SINCOS_VECTOR_FUNCTION(b, "sse2", 2, double, double2, _sin)
+SINCOS_VECTOR_FUNCTION(c, "avx", 4, double, double4, _sin)
+SINCOS_VECTOR_FUNCTION(d, "avx2", 4, double, double4, _sin)
+SINCOS_VECTOR_FUNCTION(e, "avx512f", 8, double, double8, _sin)
+
+SINCOS_VECTOR_FUNCTION(b, "sse2", 4, float, float4, _cos)
+SINCOS_VECTOR_FUNCTION(c, "avx", 8, float, float8, _cos)
+SINCOS_VECTOR_FUNCTION(d, "avx2", 8, float, float8, _cos)
+SINCOS_VECTOR_FUNCTION(e, "avx512f", 16, float, float16, _cos)
+SINCOS_VECTOR_FUNCTION(b, "sse2", 2, double, double2, _cos)
+SINCOS_VECTOR_FUNCTION(c, "avx", 4, double, double4, _cos)
+SINCOS_VECTOR_FUNCTION(d, "avx2", 4, double, double4, _cos)
+SINCOS_VECTOR_FUNCTION(e, "avx512f", 8, double, double8, _cos)
+
+#endif
@@ -0,0 +1,37 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+#pragma once
+
+/*
+ * Declare _sin and _cos with their variants of the x86-64 vector function
+ * ABI, defined in sincos-vector.c, so that the compiler vectorizes loops
+ * that call them (GCC at -O3, or clang with -fopenmp-simd):
+ *
+ *     for (size_t i = 0; i < n; i++)
+ *         ys[i] = _sin_double(xs[i]); // _ZGVdN4v__sin_double(...)
+ *
+ * The variants are b (SSE, 2 doubles or 4 floats), c (AVX, 4 or 8),
+ * d (AVX2, 4 or 8) and e (AVX-512, 8 or 16), all unmasked (notinbranch),
+ * and give the same results as the scalar functions, bit for bit.
+ *
+ * Vector Function Application Binary Interface Specification for x86-64.
+ * https://sourceware.org/glibc/wiki/libmvec
+ */
+
+#include "counters.h" // COUNTERS_CONST
+#include "sincos.h"
+
+// With COUNTERS, the functions count, so they are not const (counters.h).
+
+#if defined(__x86_64__) && defined(__clang__)
+#define SINCOS_VECTOR _Pragma("omp declare simd notinbranch") COUNTERS_CONST
+#elif defined(__x86_64__) && defined(__GNUC__)
+#define SINCOS_VECTOR COUNTERS_CONST __attribute__((simd("notinbranch")))
+#else
+#define SINCOS_VECTOR COUNTERS_CONST
+#endif
+
+SINCOS_VECTOR float _sin_float(float x);
+SINCOS_VECTOR double _sin_double(double x);
+SINCOS_VECTOR float _cos_float(float x);
+SINCOS_VECTOR double _cos_double(double x);
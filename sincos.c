@@ -1,42 +1,336 @@
 /* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
 
 #include <assert.h>
-#include <math.h> // fmaf
+#include <math.h> // fabs, fmod, isfinite, signbit
 #include <stddef.h> // size_t
 #include <stdint.h> // int64_t
 #include <stdio.h>
 
+#include "arithmetic.h" // madd, mul, nmadd
 #include "constants.h" // pi, etc.
+#include "counters.h" // COUNT, COUNT_IF, COUNTERS_CONST
 #include "cw.h" // _cw_rem_pi_2, etc.
+#include "expansion.h" // fast_add_double
+#include "isa.h" // ISA_NAME
+#include "ph.h" // _ph_rem_pi_2, etc.
 #include "reduce.h" // _bdl_rem_pi_2, etc.
+#include "sincos-cr.h" // _sincos_cr_pi_2_float, _sincos_cr_pi_2_double
+#include "sincos-simd.h" // _sincos_simd, etc.
+#include "sincos-table.h" // _sincos_table
+
+/*
+ * Compiled with -DISA=N, for sincos-dispatch.c, this file defines
+ * _sin_float_vN, etc., instead of the public functions (see isa.h).
+ */
+
+#if defined(ISA)
+#define _sin_float ISA_NAME(_sin_float)
+#define _sin_double ISA_NAME(_sin_double)
+#define _sin_array_float ISA_NAME(_sin_array_float)
+#define _sin_array_double ISA_NAME(_sin_array_double)
+#define _cos_float ISA_NAME(_cos_float)
+#define _cos_double ISA_NAME(_cos_double)
+#define _cos_array_float ISA_NAME(_cos_array_float)
+#define _cos_array_double ISA_NAME(_cos_array_double)
+#define _sincos_float ISA_NAME(_sincos_float)
+#define _sincos_double ISA_NAME(_sincos_double)
+#define _sincos_array_float ISA_NAME(_sincos_array_float)
+#define _sincos_array_double ISA_NAME(_sincos_array_double)
+#define _sin_cr_float ISA_NAME(_sin_cr_float)
+#define _sin_cr_double ISA_NAME(_sin_cr_double)
+#define _sin_cr_array_float ISA_NAME(_sin_cr_array_float)
+#define _sin_cr_array_double ISA_NAME(_sin_cr_array_double)
+#define _cos_cr_float ISA_NAME(_cos_cr_float)
+#define _cos_cr_double ISA_NAME(_cos_cr_double)
+#define _cos_cr_array_float ISA_NAME(_cos_cr_array_float)
+#define _cos_cr_array_double ISA_NAME(_cos_cr_array_double)
+#define _sincos_cr_float ISA_NAME(_sincos_cr_float)
+#define _sincos_cr_double ISA_NAME(_sincos_cr_double)
+#define _sincos_cr_array_float ISA_NAME(_sincos_cr_array_float)
+#define _sincos_cr_array_double ISA_NAME(_sincos_cr_array_double)
+#define _tan_float ISA_NAME(_tan_float)
+#define _tan_double ISA_NAME(_tan_double)
+#define _tan_array_float ISA_NAME(_tan_array_float)
+#define _tan_array_double ISA_NAME(_tan_array_double)
+#define _sinpi_float ISA_NAME(_sinpi_float)
+#define _sinpi_double ISA_NAME(_sinpi_double)
+#define _sinpi_array_float ISA_NAME(_sinpi_array_float)
+#define _sinpi_array_double ISA_NAME(_sinpi_array_double)
+#define _cospi_float ISA_NAME(_cospi_float)
+#define _cospi_double ISA_NAME(_cospi_double)
+#define _cospi_array_float ISA_NAME(_cospi_array_float)
+#define _cospi_array_double ISA_NAME(_cospi_array_double)
+#define _sincospi_float ISA_NAME(_sincospi_float)
+#define _sincospi_double ISA_NAME(_sincospi_double)
+#define _sincospi_array_float ISA_NAME(_sincospi_array_float)
+#define _sincospi_array_double ISA_NAME(_sincospi_array_double)
+#define _sind_float ISA_NAME(_sind_float)
+#define _sind_double ISA_NAME(_sind_double)
+#define _sind_array_float ISA_NAME(_sind_array_float)
+#define _sind_array_double ISA_NAME(_sind_array_double)
+#define _cosd_float ISA_NAME(_cosd_float)
+#define _cosd_double ISA_NAME(_cosd_double)
+#define _cosd_array_float ISA_NAME(_cosd_array_float)
+#define _cosd_array_double ISA_NAME(_cosd_array_double)
+#endif
+
 #include "sincos.h"
-#include "types.h" // rem_result_double
+#include "types.h" // quadrant_result_double, sincos_result_double, etc.
 
 #include "cos.h"
 #include "sin.h"
 
-#define rem_pi_2 _cw_rem_pi_2
+/*
+ * sin(x) and cos(x) for x in [0, π∕2], with the polynomials of sin.h and
+ * cos.h on [0, π∕4], and for x > π∕4,
+ *
+ *     sin(x) = cos(π∕2 - x)
+ *     cos(x) = sin(π∕2 - x)
+ *
+ * where π∕2 - x = (π∕2ₕᵢ - x) + π∕2ₗₒ, and π∕2ₕᵢ - x is exact (Sterbenz).
+ * With SINCOS_TABLE, use the tables of sincos-table.h instead.
+ *
+ * _sincos_kernel returns {sin(x + xₗ), cos(x + xₗ)} for |x| ≤ π∕4, with the
+ * same operations as _sin_kernel and _cos_kernel, so the same results, but
+ * with Horner's scheme evaluating the two polynomials together
+ * (eval_polynomial2), or with POLYNOMIAL_ESTRIN, Estrin's scheme (sin.h).
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_kernel_float(float x, float xl)
+{
+    static_assert(
+        sizeof _sin_as_float == sizeof _cos_as_float,
+        "sin and cos polynomials must have the same degree"
+    );
+    const size_t n = sizeof _sin_as_float / sizeof _sin_as_float[0];
+    float t = x * x;
+    float te = mul(x, x).b;
+#if defined(POLYNOMIAL_ESTRIN)
+    tuple_float p = {
+        eval_polynomial_estrin_float1(_sin_as_float, n, t),
+        eval_polynomial_estrin_float1(_cos_as_float, n, t),
+    };
+#else
+    tuple_float p = eval_polynomial2_float1(_sin_as_float, _cos_as_float, n, t);
+#endif
+    float s = x + madd(x * t, p.a, madd(-0.5f * t, xl, xl));
+    float h = 0.5f * t;
+    float w = 1.0f - h;
+    float we = (1.0f - w) - h;
+    float c = w + (madd(t * t, p.b, madd(-0.5f, te, we)) - x * xl);
+    return (tuple_float) {s, c};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_kernel_double(double x, double xl)
+{
+    static_assert(
+        sizeof _sin_as_double == sizeof _cos_as_double,
+        "sin and cos polynomials must have the same degree"
+    );
+    const size_t n = sizeof _sin_as_double / sizeof _sin_as_double[0];
+    double t = x * x;
+    double te = mul(x, x).b;
+#if defined(POLYNOMIAL_ESTRIN)
+    tuple_double p = {
+        eval_polynomial_estrin_double1(_sin_as_double, n, t),
+        eval_polynomial_estrin_double1(_cos_as_double, n, t),
+    };
+#else
+    tuple_double p = eval_polynomial2_double1(_sin_as_double, _cos_as_double, n, t);
+#endif
+    double s = x + madd(x * t, p.a, madd(-0.5 * t, xl, xl));
+    double h = 0.5 * t;
+    double w = 1.0 - h;
+    double we = (1.0 - w) - h;
+    double c = w + (madd(t * t, p.b, madd(-0.5, te, we)) - x * xl);
+    return (tuple_double) {s, c};
+}
+
+#define _sincos_kernel(x, xl) \
+    _Generic((x), \
+        float: _sincos_kernel_float, \
+        double: _sincos_kernel_double \
+    )(x, xl)
+
+/*
+ * Return {sin(x + xₗ), cos(x + xₗ)} for x in [0, π∕2] and a small xₗ.
+ * Both halves evaluate the same kernel, so select its argument and its
+ * results rather than branch.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_0_pi_2_float(float x, float xl)
+{
+    assert(x >= 0.0f && x <= pi_2(float));
+#if defined(SINCOS_TABLE)
+    return _sincos_table(x, xl);
+#else
+    int swap = x > 0.5f * pi_2(float);
+    float y = swap ? pi_2_hi(float) - x : x;
+    float yl = swap ? pi_2_lo(float) - xl : xl;
+    tuple_float p = _sincos_kernel(y, yl);
+    float s = swap ? p.b : p.a;
+    float c = swap ? p.a : p.b;
+    return (tuple_float) {s, c};
+#endif
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_0_pi_2_double(double x, double xl)
+{
+    assert(x >= 0.0 && x <= pi_2(double));
+#if defined(SINCOS_TABLE)
+    return _sincos_table(x, xl);
+#else
+    int swap = x > 0.5 * pi_2(double);
+    double y = swap ? pi_2_hi(double) - x : x;
+    double yl = swap ? pi_2_lo(double) - xl : xl;
+    tuple_double p = _sincos_kernel(y, yl);
+    double s = swap ? p.b : p.a;
+    double c = swap ? p.a : p.b;
+    return (tuple_double) {s, c};
+#endif
+}
+
+#define _sincos_0_pi_2(x, xl) \
+    _Generic((x), \
+        float: _sincos_0_pi_2_float, \
+        double: _sincos_0_pi_2_double \
+    )(x, xl)
+
+/*
+ * Return sin(x + xₗ), or cos(x + xₗ) if cosine is set, for x in [0, π∕2],
+ * as the half of _sincos_0_pi_2, with one polynomial (_sin_kernel or
+ * _cos_kernel). This branches, where _sincos_0_pi_2 does not, but the
+ * branch is cheaper than the other polynomial (see bench-sincos).
+ */
 
 static inline float
 __attribute__((always_inline))
 __attribute__((const))
-_sin_pi_2_float(float x)
+_sincos_one_0_pi_2_float(float x, float xl, int cosine)
+{
+#if defined(SINCOS_TABLE)
+    tuple_float p = _sincos_0_pi_2(x, xl);
+    return cosine ? p.b : p.a;
+#else
+    assert(x >= 0.0f && x <= pi_2(float));
+    int swap = x > 0.5f * pi_2(float);
+    float y = swap ? pi_2_hi(float) - x : x;
+    float yl = swap ? pi_2_lo(float) - xl : xl;
+    return cosine ^ swap ? _cos_kernel(y, yl) : _sin_kernel(y, yl);
+#endif
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_one_0_pi_2_double(double x, double xl, int cosine)
+{
+#if defined(SINCOS_TABLE)
+    tuple_double p = _sincos_0_pi_2(x, xl);
+    return cosine ? p.b : p.a;
+#else
+    assert(x >= 0.0 && x <= pi_2(double));
+    int swap = x > 0.5 * pi_2(double);
+    double y = swap ? pi_2_hi(double) - x : x;
+    double yl = swap ? pi_2_lo(double) - xl : xl;
+    return cosine ^ swap ? _cos_kernel(y, yl) : _sin_kernel(y, yl);
+#endif
+}
+
+#define _sincos_one_0_pi_2(x, xl, cosine) \
+    _Generic((x), \
+        float: _sincos_one_0_pi_2_float, \
+        double: _sincos_one_0_pi_2_double \
+    )(x, xl, cosine)
+
+/*
+ * Use Cody-Waite for the common case, Payne-Hanek for large arguments,
+ * for x > π∕2, with the quotient in the quadrant form (_cw_quadrant_pi_2):
+ * its low bits are the quadrant q mod 4 (_quadrant).
+ */
+
+static inline quadrant_result_float
+__attribute__((always_inline))
+rem_pi_2_float(float x)
+{
+    if (x >= PH_THRESHOLD_FLOAT) {
+        COUNT(COUNTER_SINCOS_PH_FLOAT);
+        rem_result_float result = _ph_rem_pi_2(x);
+        float z = (float) result.z + CW_QUADRANT_BIAS_FLOAT;
+        return (quadrant_result_float) {z, result.v1, result.v2};
+    }
+    return _cw_quadrant_pi_2(x);
+}
+
+static inline quadrant_result_double
+__attribute__((always_inline))
+rem_pi_2_double(double x)
+{
+    if (x >= PH_THRESHOLD_DOUBLE) {
+        COUNT(COUNTER_SINCOS_PH_DOUBLE);
+        rem_result_double result = _ph_rem_pi_2(x);
+        double z = (double) result.z + CW_QUADRANT_BIAS_DOUBLE;
+        return (quadrant_result_double) {z, result.v1, result.v2};
+    }
+    return _cw_quadrant_pi_2(x);
+}
+
+#define rem_pi_2(x) \
+    _Generic((x), \
+        float: rem_pi_2_float, \
+        double: rem_pi_2_double \
+    )(x)
+
+/*
+ * Return {sin(x), cos(x)}, from the reduced argument x = qπ∕2 + r:
+ *
+ *     q   sin(qπ∕2 + r)   cos(qπ∕2 + r)
+ *     0     sin(r)          cos(r)
+ *     1     cos(r)         -sin(r)
+ *     2    -sin(r)         -cos(r)
+ *     3    -cos(r)          sin(r)
+ *
+ * that is, swap sin(r) and cos(r) if q is odd, negate sin if bit 1 of q
+ * is set, and negate cos if bit 1 of q + 1 is set. sin(r) and cos(r) are
+ * always computed together, so there are no branches on the quadrant,
+ * and vectorized loops need not blend four paths.
+ * _sin_pi_2 and _cos_pi_2, below, evaluate only one of them.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+COUNTERS_CONST
+_sincos_pi_2_float(float x)
 {
     float sign = 1.0f;
-    if (x < 0.0f) { // sin(-x) = -sin(x)
+    COUNT(COUNTER_SINCOS_FLOAT);
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return (tuple_float) {x - x, x - x};
+    if (x < 0.0f) { // sin(-x) = -sin(x), cos(-x) = cos(x)
         x = -x;
         sign = -1.0f;
     }
     assert(x >= 0.0f);
-    if (x <= 2.7e-4f)
-        return sign * x;
-    int32_t q = 0;
+    int q = 0;
     float r = x;
     float v1 = r;
     float v2 = 0.0f;
     if (x > pi_2(float)) {
-        rem_result_float result = rem_pi_2(x);
-        q = result.z % 4;
+        COUNT(COUNTER_SINCOS_REDUCE_FLOAT);
+        quadrant_result_float result = rem_pi_2(x);
+        q = (int) _quadrant(result.z);
         v1 = result.v1;
         v2 = result.v2;
         r = result.v1 + result.v2;
@@ -45,69 +339,39 @@ _sin_pi_2_float(float x)
     assert(q < 4);
     assert(r >= 0.0f);
     assert(r <= pi_2(float));
-    float s;
-    if (q <= 0) { // '<=' rather than '==' otherwise llvm won't vectorize
-        s = _sin_0_pi_2(v1);
-        if (v2 != 0.0f) {
-            // Newton-Raphson
-            // sin(x + 𝜹) ≅ sin(x) + sinʹ(x)⋅𝜹 = sin(x) + cos(x)⋅𝜹
-            // sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v₂
-            s = s + _cos_0_pi_2(v1) * v2;
-        }
-    } else if (q <= 1) {
-        // sin(π∕2 + x) = cos(x)
-        s = _cos_0_pi_2(v1);
-        if (v2 != 0.0f) {
-            // Newton-Raphson
-            // cos(x + 𝜹) ≅ cos(x) + cosʹ(x)⋅𝜹 = cos(x) - sin(x)⋅𝜹
-            // cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            // sin(π∕2 + v₁ + v₂) = cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            s = s - _sin_0_pi_2(v1) * v2;
-        }
-    } else if (q <= 2) {
-        // sin(π + x) = -sin(x)
-        s = -_sin_0_pi_2(v1);
-        if (v2 != 0.0f) {
-            // Newton-Raphson
-            // sin(x + 𝜹) ≅ sin(x) + sinʹ(x)⋅𝜹 = sin(x) + cos(x)⋅𝜹
-            // sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v₂
-            // sin(π + v₁ + v₂) = -sin(v₁ + v₂) ≅ -sin(v₁) - cos(v₁)⋅v₂
-            s = s - _cos_0_pi_2(v1) * v2;
-        }
-    } else {
-        // sin(3π∕2 + x) = -cos(x)
-        s = -_cos_0_pi_2(v1);
-        if (v2 != 0.0f) {
-            // Newton-Raphson
-            // cos(x + 𝜹) ≅ cos(x) + cosʹ(x)⋅𝜹 = cos(x) - sin(x)⋅𝜹
-            // cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            // sin(3π∕2 + v₁ + v₂) = -cos(v₁ + v₂) ≅ -cos(v₁) + sin(v₁)⋅v2
-            s = s + _sin_0_pi_2(v1) * v2;
-        }
-    }
-    return sign * s;
+    tuple_float p = _sincos_0_pi_2(v1, v2);
+    int odd = (q & 1) != 0;
+    float s = odd ? p.b : p.a;
+    float c = odd ? p.a : p.b;
+    s = (q & 2) != 0 ? -s : s;
+    c = ((q + 1) & 2) != 0 ? -c : c;
+    COUNT_IF(x <= 2.7e-4f, COUNTER_SINCOS_TINY_FLOAT);
+    s = x <= 2.7e-4f ? x : s;
+    return (tuple_float) {sign * s, c};
 }
 
-static inline double
+static inline tuple_double
 __attribute__((always_inline))
-__attribute__((const))
-_sin_pi_2_double(double x)
+COUNTERS_CONST
+_sincos_pi_2_double(double x)
 {
     double sign = 1.0;
-    if (x < 0.0) { // sin(-x) = -sin(x)
+    COUNT(COUNTER_SINCOS_DOUBLE);
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return (tuple_double) {x - x, x - x};
+    if (x < 0.0) { // sin(-x) = -sin(x), cos(-x) = cos(x)
         x = -x;
         sign = -1.0;
     }
     assert(x >= 0.0);
-    if (x <= 2.1e-8f)
-        return sign * x;
-    int64_t q = 0;
+    int q = 0;
     double r = x;
     double v1 = r;
     double v2 = 0.0;
     if (x > pi_2(double)) {
-        rem_result_double result = rem_pi_2(x);
-        q = result.z % 4;
+        COUNT(COUNTER_SINCOS_REDUCE_DOUBLE);
+        quadrant_result_double result = rem_pi_2(x);
+        q = (int) _quadrant(result.z);
         v1 = result.v1;
         v2 = result.v2;
         r = result.v1 + result.v2;
@@ -116,221 +380,440 @@ _sin_pi_2_double(double x)
     assert(q < 4);
     assert(r >= 0.0);
     assert(r <= pi_2(double));
-    double s;
-    if (q <= 0) { // '<=' rather than '==' otherwise llvm won't vectorize
-        s = _sin_0_pi_2(v1);
-        if (v2 != 0.0) {
-            // Newton-Raphson
-            // sin(x + 𝜹) ≅ sin(x) + sinʹ(x)⋅𝜹 = sin(x) + cos(x)⋅𝜹
-            // sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v₂
-            s = s + _cos_0_pi_2(v1) * v2;
-        }
-    } else if (q <= 1) {
-        // sin(π∕2 + x) = cos(x)
-        s = _cos_0_pi_2(v1);
-        if (v2 != 0.0) {
-            // Newton-Raphson
-            // cos(x + 𝜹) ≅ cos(x) + cosʹ(x)⋅𝜹 = cos(x) - sin(x)⋅𝜹
-            // cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            // sin(π∕2 + v₁ + v₂) = cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            s = s - _sin_0_pi_2(v1) * v2;
-        }
-    } else if (q <= 2) {
-        // sin(π + x) = -sin(x)
-        s = -_sin_0_pi_2(v1);
-        if (v2 != 0.0) {
-            // Newton-Raphson
-            // sin(x + 𝜹) ≅ sin(x) + sinʹ(x)⋅𝜹 = sin(x) + cos(x)⋅𝜹
-            // sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v₂
-            // sin(π + v₁ + v₂) = -sin(v₁ + v₂) ≅ -sin(v₁) - cos(v₁)⋅v₂
-            s = s - _cos_0_pi_2(v1) * v2;
-        }
-    } else {
-        // sin(3π∕2 + x) = -cos(x)
-        s = -_cos_0_pi_2(v1);
-        if (v2 != 0.0) {
-            // Newton-Raphson
-            // cos(x + 𝜹) ≅ cos(x) + cosʹ(x)⋅𝜹 = cos(x) - sin(x)⋅𝜹
-            // cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            // sin(3π∕2 + v₁ + v₂) = -cos(v₁ + v₂) ≅ -cos(v₁) + sin(v₁)⋅v2
-            s = s + _sin_0_pi_2(v1) * v2;
-        }
-    }
-    return sign * s;
+    tuple_double p = _sincos_0_pi_2(v1, v2);
+    int odd = (q & 1) != 0;
+    double s = odd ? p.b : p.a;
+    double c = odd ? p.a : p.b;
+    s = (q & 2) != 0 ? -s : s;
+    c = ((q + 1) & 2) != 0 ? -c : c;
+    COUNT_IF(x <= 2.1e-8f, COUNTER_SINCOS_TINY_DOUBLE);
+    s = x <= 2.1e-8f ? x : s;
+    return (tuple_double) {sign * s, c};
 }
 
-#define _sin_pi_2(x) \
+#define _sincos_pi_2(x) \
     _Generic((x), \
-        float: _sin_pi_2_float, \
-        double: _sin_pi_2_double \
+        float: _sincos_pi_2_float, \
+        double: _sincos_pi_2_double \
     )(x)
 
-float
-_sin_float(float x)
-{
-    return _sin_pi_2(x);
-}
-
-double
-_sin_double(double x)
-{
-    return _sin_pi_2(x);
-}
-
-void
-_sin_array_float(float xs[], float ys[], size_t n)
-{
-    #pragma clang loop vectorize(enable)
-    for (size_t i = 0; i < n; i++)
-        ys[i] = _sin_pi_2(xs[i]);
-}
-
-void
-_sin_array_double(double xs[], double ys[], size_t n)
-{
-    #pragma clang loop vectorize(enable)
-    for (size_t i = 0; i < n; i++)
-        ys[i] = _sin_pi_2(xs[i]);
-}
+/*
+ * Return sin(x), or cos(x) if cosine is set, as the half of _sincos_pi_2,
+ * with the same result, but evaluating only the polynomial that the
+ * quadrant selects: sin(r) if q + cosine is even, cos(r) if it is odd.
+ */
 
 static inline float
 __attribute__((always_inline))
-__attribute__((const))
-_cos_pi_2_float(float x)
+COUNTERS_CONST
+_sincos_one_pi_2_float(float x, int cosine)
 {
-    if (x < 0.0f) // cos(-x) = cos(x)
+    float sign = 1.0f;
+    COUNT(COUNTER_SINCOS_FLOAT);
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return x - x;
+    if (x < 0.0f) { // sin(-x) = -sin(x), cos(-x) = cos(x)
         x = -x;
-    assert(x >= 0.0);
-    int32_t q = 0;
-    float r = x;
-    float v1 = r;
-    float v2 = 0.0;
+        sign = cosine ? 1.0f : -1.0f;
+    }
+    assert(x >= 0.0f);
+    int q = 0;
+    float v1 = x;
+    float v2 = 0.0f;
     if (x > pi_2(float)) {
-        rem_result_float result = rem_pi_2(x);
-        q = result.z % 4;
+        COUNT(COUNTER_SINCOS_REDUCE_FLOAT);
+        quadrant_result_float result = rem_pi_2(x);
+        q = (int) _quadrant(result.z);
         v1 = result.v1;
         v2 = result.v2;
-        r = result.v1 + result.v2;
     }
     assert(q >= 0);
     assert(q < 4);
-    assert(r >= 0.0f);
-    assert(r <= pi_2(float));
-    float c;
-    if (q <= 0) { // '<=' rather than '==' otherwise llvm won't vectorize
-        c = _cos_0_pi_2(v1);
-        if (v2 != 0.0f) {
-            // Newton-Raphson
-            // cos(x + 𝜹) ≅ cos(x) + cosʹ(x)⋅𝜹 = cos(x) - sin(x)⋅𝜹
-            // cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            c = c - _sin_0_pi_2(v1) * v2;
-        }
-    } else if (q <= 1) {
-        // cos(π∕2 + x) = -sin(x)
-        c = -_sin_0_pi_2(v1);
-        if (v2 != 0.0f) {
-            // Newton-Raphson
-            // sin(x + 𝜹) ≅ sin(x) + sinʹ(x)⋅𝜹 = sin(x) + cos(x)⋅𝜹
-            // sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v₂
-            // cos(π∕2 + v₁ + v₂) = -sin(v₁ + v₂) ≅ -sin(v₁) - cos(v₁)⋅v₂
-            c = c - _cos_0_pi_2(v1) * v2;
-        }
-    } else if (q <= 2) {
-        // cos(π + x) = -cos(x)
-        c = -_cos_0_pi_2(v1);
-        if (v2 != 0.0f) {
-            // Newton-Raphson
-            // cos(x + 𝜹) ≅ cos(x) + cosʹ(x)⋅𝜹 = cos(x) - sin(x)⋅𝜹
-            // cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            // cos(π + v₁ + v₂) = -cos(v₁ + v₂) ≅ -cos(v₁) + sin(v₁)⋅v₂
-            c = c + _sin_0_pi_2(v1) * v2;
-        }
-    } else {
-        // cos(3π∕2 + x) = sin(x)
-        c = _sin_0_pi_2(v1);
-        if (v2 != 0.0f) {
-            // Newton-Raphson
-            // sin(x + 𝜹) ≅ sin(x) + sinʹ(x)⋅𝜹 = sin(x) + cos(x)⋅𝜹
-            // sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v₂
-            // cos(3π∕2 + v₁ + v₂) = sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v2
-            c = c + _cos_0_pi_2(v1) * v2;
-        }
+    float y = _sincos_one_0_pi_2(v1, v2, cosine ^ (q & 1));
+    y = ((q + cosine) & 2) != 0 ? -y : y;
+    if (!cosine) {
+        COUNT_IF(x <= 2.7e-4f, COUNTER_SINCOS_TINY_FLOAT);
+        y = x <= 2.7e-4f ? x : y;
     }
-    return c;
+    return sign * y;
 }
 
 static inline double
 __attribute__((always_inline))
-__attribute__((const))
-_cos_pi_2_double(double x)
+COUNTERS_CONST
+_sincos_one_pi_2_double(double x, int cosine)
 {
-    if (x < 0.0) // cos(-x) = cos(x)
+    double sign = 1.0;
+    COUNT(COUNTER_SINCOS_DOUBLE);
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return x - x;
+    if (x < 0.0) { // sin(-x) = -sin(x), cos(-x) = cos(x)
         x = -x;
+        sign = cosine ? 1.0 : -1.0;
+    }
     assert(x >= 0.0);
-    int64_t q = 0;
-    double r = x;
-    double v1 = r;
+    int q = 0;
+    double v1 = x;
     double v2 = 0.0;
     if (x > pi_2(double)) {
-        rem_result_double result = rem_pi_2(x);
-        q = result.z % 4;
+        COUNT(COUNTER_SINCOS_REDUCE_DOUBLE);
+        quadrant_result_double result = rem_pi_2(x);
+        q = (int) _quadrant(result.z);
         v1 = result.v1;
         v2 = result.v2;
-        r = result.v1 + result.v2;
     }
     assert(q >= 0);
     assert(q < 4);
-    assert(r >= 0.0);
-    assert(r <= pi_2(double));
-    double c;
-    if (q <= 0) { // '<=' rather than '==' otherwise llvm won't vectorize
-        c = _cos_0_pi_2(v1);
-        if (v2 != 0.0) {
-            // Newton-Raphson
-            // cos(x + 𝜹) ≅ cos(x) + cosʹ(x)⋅𝜹 = cos(x) - sin(x)⋅𝜹
-            // cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            c = c - _sin_0_pi_2(v1) * v2;
-        }
-    } else if (q <= 1) {
-        // cos(π∕2 + x) = -sin(x)
-        c = -_sin_0_pi_2(v1);
-        if (v2 != 0.0) {
-            // Newton-Raphson
-            // sin(x + 𝜹) ≅ sin(x) + sinʹ(x)⋅𝜹 = sin(x) + cos(x)⋅𝜹
-            // sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v₂
-            // cos(π∕2 + v₁ + v₂) = -sin(v₁ + v₂) ≅ -sin(v₁) - cos(v₁)⋅v₂
-            c = c - _cos_0_pi_2(v1) * v2;
-        }
-    } else if (q <= 2) {
-        // cos(π + x) = -cos(x)
-        c = -_cos_0_pi_2(v1);
-        if (v2 != 0.0) {
-            // Newton-Raphson
-            // cos(x + 𝜹) ≅ cos(x) + cosʹ(x)⋅𝜹 = cos(x) - sin(x)⋅𝜹
-            // cos(v₁ + v₂) ≅ cos(v₁) - sin(v₁)⋅v₂
-            // cos(π + v₁ + v₂) = -cos(v₁ + v₂) ≅ -cos(v₁) + sin(v₁)⋅v₂
-            c = c + _sin_0_pi_2(v1) * v2;
-        }
-    } else {
-        // cos(3π∕2 + x) = sin(x)
-        c = _sin_0_pi_2(v1);
-        if (v2 != 0.0) {
-            // Newton-Raphson
-            // sin(x + 𝜹) ≅ sin(x) + sinʹ(x)⋅𝜹 = sin(x) + cos(x)⋅𝜹
-            // sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v₂
-            // cos(3π∕2 + v₁ + v₂) = sin(v₁ + v₂) ≅ sin(v₁) + cos(v₁)⋅v2
-            c = c + _cos_0_pi_2(v1) * v2;
+    double y = _sincos_one_0_pi_2(v1, v2, cosine ^ (q & 1));
+    y = ((q + cosine) & 2) != 0 ? -y : y;
+    if (!cosine) {
+        COUNT_IF(x <= 2.1e-8f, COUNTER_SINCOS_TINY_DOUBLE);
+        y = x <= 2.1e-8f ? x : y;
+    }
+    return sign * y;
+}
+
+#define _sincos_one_pi_2(x, cosine) \
+    _Generic((x), \
+        float: _sincos_one_pi_2_float, \
+        double: _sincos_one_pi_2_double \
+    )(x, cosine)
+
+#define _sin_pi_2(x) _sincos_one_pi_2(x, 0)
+#define _cos_pi_2(x) _sincos_one_pi_2(x, 1)
+
+/*
+ * sin(πx) and cos(πx), and sin and cos in degrees, without Cody-Waite or
+ * Payne-Hanek: the period is 2 (or 360), so x is split exactly into a
+ * quadrant q and a remainder r, with |r| ≤ ¼ (or 45), and the kernel of
+ * sincos evaluates the product of r and π (or π∕180) as y + yₗ, which is
+ * within π∕4 after all. The splits keep the quotients in the
+ * floating-point domain, as bdl_reduce_quadrant does, and only q, less
+ * than 8 in magnitude, is converted to an integer.
+ */
+
+/*
+ * Return {sin, cos} of qπ∕2 + y + yₗ, for |y| ≤ π∕4, as _sincos_pi_2.
+ * Adding +0 makes the exact zeros positive: sinpi(n) = +0 for n ≥ 0, and
+ * cospi(n + ½) = +0, as IEEE 754 (§9.2.1) recommends; the sign of x is
+ * applied after.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_quadrant_float(float y, float yl, int32_t q)
+{
+    tuple_float p = _sincos_kernel(y, yl);
+    int odd = (q & 1) != 0;
+    float s = odd ? p.b : p.a;
+    float c = odd ? p.a : p.b;
+    s = (q & 2) != 0 ? -s : s;
+    c = ((q + 1) & 2) != 0 ? -c : c;
+    return (tuple_float) {s + 0.0f, c + 0.0f};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_quadrant_double(double y, double yl, int64_t q)
+{
+    tuple_double p = _sincos_kernel(y, yl);
+    int odd = (q & 1) != 0;
+    double s = odd ? p.b : p.a;
+    double c = odd ? p.a : p.b;
+    s = (q & 2) != 0 ? -s : s;
+    c = ((q + 1) & 2) != 0 ? -c : c;
+    return (tuple_double) {s + 0.0, c + 0.0};
+}
+
+/*
+ * Return {sin(πx), cos(πx)}. For |x| < 2ᵖ, |x| = 2n + m, with n the
+ * integer nearest to |x|∕2 (the bias 2ᵖ⁻¹ rounds it), and |m| ≤ 1; every
+ * larger float is an even integer, so m = 0. Then m = k∕2 + r, with k the
+ * integer nearest to 2m, and q = k mod 4. Each difference is exact.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_pi_x_float(float x)
+{
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return (tuple_float) {x - x, x - x};
+    const float bias = QUADRANT_BIAS_FLOAT;
+    float ax = fabsf(x);
+    float n = (0.5f * ax + 0x1.0p23f) - 0x1.0p23f;
+    float m = ax < 0x1.0p24f ? ax - 2.0f * n : 0.0f;
+    float k = (2.0f * m + bias) - bias;
+    float r = m - 0.5f * k;
+    float y = pi_hi(float) * r;
+    float yl = mul(pi_hi(float), r).b + pi_lo(float) * r;
+    tuple_float p = _sincos_quadrant_float(y, yl, (int32_t) k);
+    return (tuple_float) {signbit(x) ? -p.a : p.a, p.b};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_pi_x_double(double x)
+{
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return (tuple_double) {x - x, x - x};
+    const double bias = QUADRANT_BIAS_DOUBLE;
+    double ax = fabs(x);
+    double n = (0.5 * ax + 0x1.0p52) - 0x1.0p52;
+    double m = ax < 0x1.0p53 ? ax - 2.0 * n : 0.0;
+    double k = (2.0 * m + bias) - bias;
+    double r = m - 0.5 * k;
+    double y = pi_hi(double) * r;
+    double yl = mul(pi_hi(double), r).b + pi_lo(double) * r;
+    tuple_double p = _sincos_quadrant_double(y, yl, (int64_t) k);
+    return (tuple_double) {signbit(x) ? -p.a : p.a, p.b};
+}
+
+#define _sincos_pi_x(x) \
+    _Generic((x), \
+        float: _sincos_pi_x_float, \
+        double: _sincos_pi_x_double \
+    )(x)
+
+/*
+ * Return {sin(x°), cos(x°)}. |x| = 360n + m, with n an integer nearest
+ * to |x|∕360, so |m| < 360 (|x| - 360n is exact, with or without fma
+ * (nmadd), its result being a multiple of ulp(|x|), or an integer, less
+ * than 360); then m = 90k + r, with |r| ≤ 45 (about, without fma). Beyond the range of the bias (|x|∕360 < 2ᵖ⁻²), fmod
+ * reduces x modulo 360 first, exactly.
+ */
+
+static inline tuple_float
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_deg_float(float x)
+{
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return (tuple_float) {x - x, x - x};
+    const float bias = QUADRANT_BIAS_FLOAT;
+    float ax = fabsf(x);
+    if (ax >= 0x1.0p30f)
+        ax = fmodf(ax, 360.0f);
+    float n = madd(ax, 1.0f / 360.0f, bias) - bias;
+    float m = nmadd(360.0f, n, ax);
+    float k = madd(m, 1.0f / 90.0f, bias) - bias;
+    float r = nmadd(90.0f, k, m);
+    float y = pi_180(float) * r;
+    float yl = mul(pi_180(float), r).b + pi_180_lo(float) * r;
+    tuple_float p = _sincos_quadrant_float(y, yl, (int32_t) k);
+    return (tuple_float) {signbit(x) ? -p.a : p.a, p.b};
+}
+
+static inline tuple_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_deg_double(double x)
+{
+    if (!isfinite(x)) // sin(±∞) = cos(±∞) = NaN
+        return (tuple_double) {x - x, x - x};
+    const double bias = QUADRANT_BIAS_DOUBLE;
+    double ax = fabs(x);
+    if (ax >= 0x1.0p59)
+        ax = fmod(ax, 360.0);
+    double n = madd(ax, 1.0 / 360.0, bias) - bias;
+    double m = nmadd(360.0, n, ax);
+    double k = madd(m, 1.0 / 90.0, bias) - bias;
+    double r = nmadd(90.0, k, m);
+    double y = pi_180(double) * r;
+    double yl = mul(pi_180(double), r).b + pi_180_lo(double) * r;
+    tuple_double p = _sincos_quadrant_double(y, yl, (int64_t) k);
+    return (tuple_double) {signbit(x) ? -p.a : p.a, p.b};
+}
+
+#define _sincos_deg(x) \
+    _Generic((x), \
+        float: _sincos_deg_float, \
+        double: _sincos_deg_double \
+    )(x)
+
+/*
+ * tan(x), with one reduction x = qπ∕2 + r, r in [-π∕4, π∕4], and one
+ * evaluation of the kernel of sincos on r, for sin and cos of the reduced
+ * argument; then
+ *
+ *     tan(qπ∕2 + r) = tan(r)        q even
+ *                   = -1∕tan(r)     q odd
+ *
+ * so tan is a quotient of sin and cos, in one order or the other, with one
+ * division. sin and cos are kept as double-doubles (the leading term of
+ * the kernel, x or 1 - x²∕2, and the rest), and the quotient t ≅ a∕b is
+ * corrected once with its residual, a - t⋅b, computed exactly (nmadd),
+ * so that the error is less than 1 ulp, even near the poles and the zeros,
+ * where r is small. There, the reduction of rem_pi_2 is not enough: its
+ * correction to [0, π∕2] rounds v₁ + C₁, so the reduction is that of
+ * sincos-cr.h, to the nearest quotient. Its error is absolute: 2⁻¹²⁸ or
+ * less below 2³⁰, which is small enough relative to the smallest r there,
+ * but 2⁻¹⁰⁰ above (Payne-Hanek), where r can be as small as 2⁻⁶¹; so if
+ * |r| < 2⁻³⁰ there, x is reduced again, with a relative error of 2⁻¹⁴⁰,
+ * as in _sincos_cr_accurate_double. The float version is the double
+ * version, rounded.
+ */
+
+static inline sincos_result_double
+__attribute__((always_inline))
+__attribute__((const))
+_sincos_kernel_dd_double(double x, double xl)
+{
+    const size_t n = sizeof _sin_as_double / sizeof _sin_as_double[0];
+    double t = x * x;
+    double te = mul(x, x).b;
+    tuple_double p = eval_polynomial2_double1(_sin_as_double, _cos_as_double, n, t);
+    tuple_double s = fast_add_double(x, madd(x * t, p.a, madd(-0.5 * t, xl, xl)));
+    double h = 0.5 * t;
+    double w = 1.0 - h;
+    double we = (1.0 - w) - h;
+    tuple_double c = fast_add_double(w, madd(t * t, p.b, madd(-0.5, te, we)) - x * xl);
+    return (sincos_result_double) {s, c};
+}
+
+static inline double
+__attribute__((always_inline))
+__attribute__((const))
+_tan_pi_2_double(double x)
+{
+    if (!isfinite(x)) // tan(±∞) = NaN
+        return x - x;
+    double ax = fabs(x);
+    int q = 0;
+    double v1 = ax;
+    double v2 = 0.0;
+    if (ax > 0.5 * pi_2(double)) {
+        rem_result_double result = ax < 0x1.0p30
+            ? _sincos_cr_cw_rem_pi_2_double(ax)
+            : _sincos_cr_ph_rem_pi_2_double(ax);
+        q = result.z;
+        v1 = result.v1;
+        v2 = result.v2;
+        if (ax >= 0x1.0p30 && fabs(v1) < 0x1.0p-30) {
+            rem_result_triple_double rem = _sincos_cr_rem_pi_2_triple_double(ax);
+            q = rem.z;
+            v1 = rem.v1;
+            v2 = rem.v2 + rem.v3;
         }
     }
-    return c;
+    sincos_result_double p = _sincos_kernel_dd_double(v1, v2);
+    int odd = (q & 1) != 0;
+    tuple_double a = odd ? p.c : p.s;
+    tuple_double b = odd ? p.s : p.c;
+    double inv_b = 1.0 / b.a;
+    double t = a.a * inv_b;
+    double e = (nmadd(t, b.a, a.a) + a.b) - t * b.b;
+    t = madd(e, inv_b, t);
+    t = odd ? -t : t;
+    return signbit(x) ? -t : t;
 }
 
-#define _cos_pi_2(x) \
+static inline float
+__attribute__((always_inline))
+__attribute__((const))
+_tan_pi_2_float(float x)
+{
+    return (float) _tan_pi_2_double((double) x);
+}
+
+#define _tan_pi_2(x) \
     _Generic((x), \
-        float: _cos_pi_2_float, \
-        double: _cos_pi_2_double \
+        float: _tan_pi_2_float, \
+        double: _tan_pi_2_double \
     )(x)
 
+#if defined(SINCOS_SIMD)
+
+/*
+ * The array functions, with the vector kernels of sincos-simd.h, and the
+ * scalar _sincos_pi_2 for the blocks they leave. ss or cs may be NULL.
+ */
+
+static inline void
+__attribute__((always_inline))
+_sincos_array_simd_float(const float xs[], float ss[], float cs[], size_t n)
+{
+    for (size_t i = 0; i < n; i += SINCOS_SIMD_LANES_FLOAT) {
+        size_t m = n - i < SINCOS_SIMD_LANES_FLOAT ? n - i : SINCOS_SIMD_LANES_FLOAT;
+        float *s = ss == NULL ? NULL : &ss[i];
+        float *c = cs == NULL ? NULL : &cs[i];
+        COUNT(COUNTER_SINCOS_SIMD_FLOAT);
+        if (_sincos_simd_float(&xs[i], s, c, m))
+            continue;
+        COUNT(COUNTER_SINCOS_SIMD_FALLBACK_FLOAT);
+        for (size_t j = 0; j < m; j++) {
+            tuple_float p = _sincos_pi_2(xs[i + j]);
+            if (s != NULL)
+                s[j] = p.a;
+            if (c != NULL)
+                c[j] = p.b;
+        }
+    }
+}
+
+static inline void
+__attribute__((always_inline))
+_sincos_array_simd_double(const double xs[], double ss[], double cs[], size_t n)
+{
+    for (size_t i = 0; i < n; i += SINCOS_SIMD_LANES_DOUBLE) {
+        size_t m = n - i < SINCOS_SIMD_LANES_DOUBLE ? n - i : SINCOS_SIMD_LANES_DOUBLE;
+        double *s = ss == NULL ? NULL : &ss[i];
+        double *c = cs == NULL ? NULL : &cs[i];
+        COUNT(COUNTER_SINCOS_SIMD_DOUBLE);
+        if (_sincos_simd_double(&xs[i], s, c, m))
+            continue;
+        COUNT(COUNTER_SINCOS_SIMD_FALLBACK_DOUBLE);
+        for (size_t j = 0; j < m; j++) {
+            tuple_double p = _sincos_pi_2(xs[i + j]);
+            if (s != NULL)
+                s[j] = p.a;
+            if (c != NULL)
+                c[j] = p.b;
+        }
+    }
+}
+
+#endif
+
+float
+_sin_float(float x)
+{
+    return _sin_pi_2(x);
+}
+
+double
+_sin_double(double x)
+{
+    return _sin_pi_2(x);
+}
+
+void
+_sin_array_float(float xs[], float ys[], size_t n)
+{
+#if defined(SINCOS_SIMD)
+    _sincos_array_simd_float(xs, ys, NULL, n);
+#else
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sin_pi_2(xs[i]);
+#endif
+}
+
+void
+_sin_array_double(double xs[], double ys[], size_t n)
+{
+#if defined(SINCOS_SIMD)
+    _sincos_array_simd_double(xs, ys, NULL, n);
+#else
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sin_pi_2(xs[i]);
+#endif
+}
+
 float
 _cos_float(float x)
 {
@@ -346,15 +829,335 @@ _cos_double(double x)
 void
 _cos_array_float(float xs[], float ys[], size_t n)
 {
+#if defined(SINCOS_SIMD)
+    _sincos_array_simd_float(xs, NULL, ys, n);
+#else
     #pragma clang loop vectorize(enable)
     for (size_t i = 0; i < n; i++)
         ys[i] = _cos_pi_2(xs[i]);
+#endif
 }
 
 void
 _cos_array_double(double xs[], double ys[], size_t n)
 {
+#if defined(SINCOS_SIMD)
+    _sincos_array_simd_double(xs, NULL, ys, n);
+#else
     #pragma clang loop vectorize(enable)
     for (size_t i = 0; i < n; i++)
         ys[i] = _cos_pi_2(xs[i]);
+#endif
+}
+
+void
+_sincos_float(float x, float *sin_x, float *cos_x)
+{
+    tuple_float p = _sincos_pi_2(x);
+    *sin_x = p.a;
+    *cos_x = p.b;
+}
+
+void
+_sincos_double(double x, double *sin_x, double *cos_x)
+{
+    tuple_double p = _sincos_pi_2(x);
+    *sin_x = p.a;
+    *cos_x = p.b;
+}
+
+void
+_sincos_array_float(float xs[], float ss[], float cs[], size_t n)
+{
+#if defined(SINCOS_SIMD)
+    _sincos_array_simd_float(xs, ss, cs, n);
+#else
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++) {
+        tuple_float p = _sincos_pi_2(xs[i]);
+        ss[i] = p.a;
+        cs[i] = p.b;
+    }
+#endif
+}
+
+void
+_sincos_array_double(double xs[], double ss[], double cs[], size_t n)
+{
+#if defined(SINCOS_SIMD)
+    _sincos_array_simd_double(xs, ss, cs, n);
+#else
+    #pragma clang loop vectorize(enable)
+    for (size_t i = 0; i < n; i++) {
+        tuple_double p = _sincos_pi_2(xs[i]);
+        ss[i] = p.a;
+        cs[i] = p.b;
+    }
+#endif
+}
+
+/*
+ * Correctly rounded, see sincos-cr.h.
+ */
+
+float
+_sin_cr_float(float x)
+{
+    return _sincos_cr_pi_2_float(x, 1, 0).a;
+}
+
+double
+_sin_cr_double(double x)
+{
+    return _sincos_cr_pi_2_double(x, 1, 0).a;
+}
+
+void
+_sin_cr_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_cr_pi_2_float(xs[i], 1, 0).a;
+}
+
+void
+_sin_cr_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_cr_pi_2_double(xs[i], 1, 0).a;
+}
+
+float
+_cos_cr_float(float x)
+{
+    return _sincos_cr_pi_2_float(x, 0, 1).b;
+}
+
+double
+_cos_cr_double(double x)
+{
+    return _sincos_cr_pi_2_double(x, 0, 1).b;
+}
+
+void
+_cos_cr_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_cr_pi_2_float(xs[i], 0, 1).b;
+}
+
+void
+_cos_cr_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_cr_pi_2_double(xs[i], 0, 1).b;
+}
+
+void
+_sincos_cr_float(float x, float *sin_x, float *cos_x)
+{
+    tuple_float p = _sincos_cr_pi_2_float(x, 1, 1);
+    *sin_x = p.a;
+    *cos_x = p.b;
+}
+
+void
+_sincos_cr_double(double x, double *sin_x, double *cos_x)
+{
+    tuple_double p = _sincos_cr_pi_2_double(x, 1, 1);
+    *sin_x = p.a;
+    *cos_x = p.b;
+}
+
+void
+_sincos_cr_array_float(float xs[], float ss[], float cs[], size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        tuple_float p = _sincos_cr_pi_2_float(xs[i], 1, 1);
+        ss[i] = p.a;
+        cs[i] = p.b;
+    }
+}
+
+void
+_sincos_cr_array_double(double xs[], double ss[], double cs[], size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        tuple_double p = _sincos_cr_pi_2_double(xs[i], 1, 1);
+        ss[i] = p.a;
+        cs[i] = p.b;
+    }
+}
+
+/*
+ * sin(πx), cos(πx), and sin and cos in degrees.
+ */
+
+float
+_sinpi_float(float x)
+{
+    return _sincos_pi_x(x).a;
+}
+
+double
+_sinpi_double(double x)
+{
+    return _sincos_pi_x(x).a;
+}
+
+void
+_sinpi_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_pi_x(xs[i]).a;
+}
+
+void
+_sinpi_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_pi_x(xs[i]).a;
+}
+
+float
+_cospi_float(float x)
+{
+    return _sincos_pi_x(x).b;
+}
+
+double
+_cospi_double(double x)
+{
+    return _sincos_pi_x(x).b;
+}
+
+void
+_cospi_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_pi_x(xs[i]).b;
+}
+
+void
+_cospi_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_pi_x(xs[i]).b;
+}
+
+void
+_sincospi_float(float x, float *sin_x, float *cos_x)
+{
+    tuple_float p = _sincos_pi_x(x);
+    *sin_x = p.a;
+    *cos_x = p.b;
+}
+
+void
+_sincospi_double(double x, double *sin_x, double *cos_x)
+{
+    tuple_double p = _sincos_pi_x(x);
+    *sin_x = p.a;
+    *cos_x = p.b;
+}
+
+void
+_sincospi_array_float(float xs[], float ss[], float cs[], size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        tuple_float p = _sincos_pi_x(xs[i]);
+        ss[i] = p.a;
+        cs[i] = p.b;
+    }
+}
+
+void
+_sincospi_array_double(double xs[], double ss[], double cs[], size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        tuple_double p = _sincos_pi_x(xs[i]);
+        ss[i] = p.a;
+        cs[i] = p.b;
+    }
+}
+
+float
+_sind_float(float x)
+{
+    return _sincos_deg(x).a;
+}
+
+double
+_sind_double(double x)
+{
+    return _sincos_deg(x).a;
+}
+
+void
+_sind_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_deg(xs[i]).a;
+}
+
+void
+_sind_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_deg(xs[i]).a;
+}
+
+float
+_cosd_float(float x)
+{
+    return _sincos_deg(x).b;
+}
+
+double
+_cosd_double(double x)
+{
+    return _sincos_deg(x).b;
+}
+
+void
+_cosd_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_deg(xs[i]).b;
+}
+
+void
+_cosd_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _sincos_deg(xs[i]).b;
+}
+
+/*
+ * tan(x).
+ */
+
+float
+_tan_float(float x)
+{
+    return _tan_pi_2(x);
+}
+
+double
+_tan_double(double x)
+{
+    return _tan_pi_2(x);
+}
+
+void
+_tan_array_float(float xs[], float ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _tan_pi_2(xs[i]);
+}
+
+void
+_tan_array_double(double xs[], double ys[], size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        ys[i] = _tan_pi_2(xs[i]);
 }
@@ -33,3 +33,166 @@ void _cos_array_double(double xs[], double ys[], size_t n);
         float: _cos_array_float, \
         double: _cos_array_double \
     )(xs, ys, n)
+
+void _sincos_float(float x, float *sin_x, float *cos_x);
+void _sincos_double(double x, double *sin_x, double *cos_x);
+#define _sincos(x, sin_x, cos_x) \
+    _Generic((x), \
+        float: _sincos_float, \
+        double: _sincos_double \
+    )(x, sin_x, cos_x)
+void _sincos_array_float(float xs[], float ss[], float cs[], size_t n);
+void _sincos_array_double(double xs[], double ss[], double cs[], size_t n);
+#define _sincos_array(xs, ss, cs, n) \
+    _Generic((xs[0]), \
+        float: _sincos_array_float, \
+        double: _sincos_array_double \
+    )(xs, ss, cs, n)
+
+/*
+ * Correctly rounded (round-to-nearest), see sincos-cr.h.
+ */
+
+float _sin_cr_float(float x);
+double _sin_cr_double(double x);
+#define _sin_cr(x) \
+    _Generic((x), \
+        float: _sin_cr_float, \
+        double: _sin_cr_double \
+    )(x)
+void _sin_cr_array_float(float xs[], float ys[], size_t n);
+void _sin_cr_array_double(double xs[], double ys[], size_t n);
+#define _sin_cr_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _sin_cr_array_float, \
+        double: _sin_cr_array_double \
+    )(xs, ys, n)
+
+float _cos_cr_float(float x);
+double _cos_cr_double(double x);
+#define _cos_cr(x) \
+    _Generic((x), \
+        float: _cos_cr_float, \
+        double: _cos_cr_double \
+    )(x)
+void _cos_cr_array_float(float xs[], float ys[], size_t n);
+void _cos_cr_array_double(double xs[], double ys[], size_t n);
+#define _cos_cr_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _cos_cr_array_float, \
+        double: _cos_cr_array_double \
+    )(xs, ys, n)
+
+void _sincos_cr_float(float x, float *sin_x, float *cos_x);
+void _sincos_cr_double(double x, double *sin_x, double *cos_x);
+#define _sincos_cr(x, sin_x, cos_x) \
+    _Generic((x), \
+        float: _sincos_cr_float, \
+        double: _sincos_cr_double \
+    )(x, sin_x, cos_x)
+void _sincos_cr_array_float(float xs[], float ss[], float cs[], size_t n);
+void _sincos_cr_array_double(double xs[], double ss[], double cs[], size_t n);
+#define _sincos_cr_array(xs, ss, cs, n) \
+    _Generic((xs[0]), \
+        float: _sincos_cr_array_float, \
+        double: _sincos_cr_array_double \
+    )(xs, ss, cs, n)
+
+/*
+ * sin(πx) and cos(πx), and sin and cos of x in degrees, with an exact
+ * reduction, see sincos.c.
+ */
+
+float _sinpi_float(float x);
+double _sinpi_double(double x);
+#define _sinpi(x) \
+    _Generic((x), \
+        float: _sinpi_float, \
+        double: _sinpi_double \
+    )(x)
+void _sinpi_array_float(float xs[], float ys[], size_t n);
+void _sinpi_array_double(double xs[], double ys[], size_t n);
+#define _sinpi_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _sinpi_array_float, \
+        double: _sinpi_array_double \
+    )(xs, ys, n)
+
+float _cospi_float(float x);
+double _cospi_double(double x);
+#define _cospi(x) \
+    _Generic((x), \
+        float: _cospi_float, \
+        double: _cospi_double \
+    )(x)
+void _cospi_array_float(float xs[], float ys[], size_t n);
+void _cospi_array_double(double xs[], double ys[], size_t n);
+#define _cospi_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _cospi_array_float, \
+        double: _cospi_array_double \
+    )(xs, ys, n)
+
+void _sincospi_float(float x, float *sin_x, float *cos_x);
+void _sincospi_double(double x, double *sin_x, double *cos_x);
+#define _sincospi(x, sin_x, cos_x) \
+    _Generic((x), \
+        float: _sincospi_float, \
+        double: _sincospi_double \
+    )(x, sin_x, cos_x)
+void _sincospi_array_float(float xs[], float ss[], float cs[], size_t n);
+void _sincospi_array_double(double xs[], double ss[], double cs[], size_t n);
+#define _sincospi_array(xs, ss, cs, n) \
+    _Generic((xs[0]), \
+        float: _sincospi_array_float, \
+        double: _sincospi_array_double \
+    )(xs, ss, cs, n)
+
+float _sind_float(float x);
+double _sind_double(double x);
+#define _sind(x) \
+    _Generic((x), \
+        float: _sind_float, \
+        double: _sind_double \
+    )(x)
+void _sind_array_float(float xs[], float ys[], size_t n);
+void _sind_array_double(double xs[], double ys[], size_t n);
+#define _sind_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _sind_array_float, \
+        double: _sind_array_double \
+    )(xs, ys, n)
+
+float _cosd_float(float x);
+double _cosd_double(double x);
+#define _cosd(x) \
+    _Generic((x), \
+        float: _cosd_float, \
+        double: _cosd_double \
+    )(x)
+void _cosd_array_float(float xs[], float ys[], size_t n);
+void _cosd_array_double(double xs[], double ys[], size_t n);
+#define _cosd_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _cosd_array_float, \
+        double: _cosd_array_double \
+    )(xs, ys, n)
+
+/*
+ * tan(x), with one reduction and one division, see sincos.c.
+ */
+
+float _tan_float(float x);
+double _tan_double(double x);
+#define _tan(x) \
+    _Generic((x), \
+        float: _tan_float, \
+        double: _tan_double \
+    )(x)
+void _tan_array_float(float xs[], float ys[], size_t n);
+void _tan_array_double(double xs[], double ys[], size_t n);
+#define _tan_array(xs, ys, n) \
+    _Generic((xs[0]), \
+        float: _tan_array_float, \
+        double: _tan_array_double \
+    )(xs, ys, n)
@@ -0,0 +1,322 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Test _exp, _exp2 and _expm1 against MPFR, on intervals of the argument,
+ * from tiny arguments to the thresholds of overflow and underflow, with
+ * the subnormal results; test them on special values; and test that the
+ * array functions agree bit for bit with the scalar functions.
+ */
+
+#include <assert.h>
+#include <math.h> // INFINITY, NAN, isnan, signbit
+#include <stddef.h> // size_t
+#include <stdio.h> // flockfile, printf
+
+#include <mpfr.h>
+
+#include "common.h" // ulp
+#include "exp.h"
+#include "harness.h"
+
+static int indent = 0;
+
+// The size of the test, per interval.
+static const size_t n = 1000000;
+
+// The size of the chunks of the test (harness.h).
+static const size_t chunk_size = 1 << 14;
+
+typedef int (*mp_function)(mpfr_t, const mpfr_t, mpfr_rnd_t);
+
+#define N_INTERVALS 5
+
+/*
+ * The functions, with the intervals of their arguments: tiny, small,
+ * moderate, up to the overflow threshold, and to the underflow threshold
+ * (subnormal results), or for expm1, towards -1.
+ */
+
+typedef struct {
+    const char *name;
+    float (*function_float)(float);
+    double (*function_double)(double);
+    mp_function mp_function;
+    double intervals_float[N_INTERVALS][2];
+    double intervals_double[N_INTERVALS][2];
+} test_function;
+
+static const test_function functions[] = {
+    {
+        "exp", &_exp_float, &_exp_double, &mpfr_exp,
+        {{-0x1.0p-20, 0x1.0p-20}, {-1.0, 1.0}, {-16.0, 16.0}, {-87.0, 88.0}, {-104.0, -87.0}},
+        {{-0x1.0p-40, 0x1.0p-40}, {-1.0, 1.0}, {-16.0, 16.0}, {-708.0, 709.0}, {-746.0, -708.0}},
+    },
+    {
+        "exp2", &_exp2_float, &_exp2_double, &mpfr_exp2,
+        {{-0x1.0p-20, 0x1.0p-20}, {-1.0, 1.0}, {-16.0, 16.0}, {-126.0, 127.0}, {-151.0, -126.0}},
+        {{-0x1.0p-40, 0x1.0p-40}, {-1.0, 1.0}, {-16.0, 16.0}, {-1022.0, 1023.0}, {-1076.0, -1022.0}},
+    },
+    {
+        "expm1", &_expm1_float, &_expm1_double, &mpfr_expm1,
+        {{-0x1.0p-20, 0x1.0p-20}, {-0x1.0p-7, 0x1.0p-7}, {-1.0, 1.0}, {-16.0, 88.0}, {-20.0, -16.0}},
+        {{-0x1.0p-40, 0x1.0p-40}, {-0x1.0p-7, 0x1.0p-7}, {-1.0, 1.0}, {-16.0, 709.0}, {-40.0, -16.0}},
+    },
+};
+
+#define N_FUNCTIONS (sizeof functions / sizeof functions[0])
+
+// The ulp of a result, at least that of the subnormals.
+static float
+ulp_result_float(float z)
+{
+    float u = ulp(z);
+    return u < 0x1.0p-149f ? 0x1.0p-149f : u;
+}
+
+static double
+ulp_result_double(double z)
+{
+    double u = ulp(z);
+    return u < 0x1.0p-1074 ? 0x1.0p-1074 : u;
+}
+
+static void
+print_stats(const harness_stats *stats, const double intervals[][2])
+{
+    harness_print_distribution(stats, indent);
+    printf("%*smaximum error (ulp) by interval:\n", indent, "");
+    for (size_t j = 0; j < N_INTERVALS; j++)
+        printf("%*s%14a %14a %8.3f\n", indent, "", intervals[j][0], intervals[j][1], stats->max_rel_error[j]);
+    printf("\n");
+}
+
+static void
+test_float_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    const test_function *test = context;
+    harness_mp *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+    size_t j = chunk / harness_chunks(n, chunk_size);
+    size_t first = (chunk % harness_chunks(n, chunk_size)) * chunk_size;
+    double a = test->intervals_float[j][0];
+    double b = test->intervals_float[j][1];
+    for (size_t i = first; i < n && i < first + chunk_size; i++) {
+        float x = (float) (a + harness_uniform(&g) * (b - a));
+        float y = (*test->function_float)(x);
+
+        mpfr_set_flt(mp->x, x, MPFR_RNDN);
+        (*test->mp_function)(mp->result, mp->x, MPFR_RNDN);
+        float z = mpfr_get_flt(mp->result, MPFR_RNDN);
+
+        // in MPFR, for the subnormals, where the error is below the ulp
+        mpfr_sub_d(mp->error, mp->result, y, MPFR_RNDN);
+        mpfr_abs(mp->error, mp->error, MPFR_RNDN);
+        double abs_error = mpfr_get_d(mp->error, MPFR_RNDN);
+        mpfr_div_d(mp->error, mp->error, ulp_result_float(z), MPFR_RNDN);
+        double rel_error = mpfr_get_d(mp->error, MPFR_RNDN);
+        if (rel_error >= 1.0) {
+            flockfile(stderr);
+            fprintf(stderr, "%*s%s(%a) = %a, expected %a\n", indent, "", test->name, x, y, z);
+            funlockfile(stderr);
+        }
+        harness_count(stats, j, abs_error, rel_error);
+    }
+}
+
+static void
+test_double_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    const test_function *test = context;
+    harness_mp *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+    size_t j = chunk / harness_chunks(n, chunk_size);
+    size_t first = (chunk % harness_chunks(n, chunk_size)) * chunk_size;
+    double a = test->intervals_double[j][0];
+    double b = test->intervals_double[j][1];
+    for (size_t i = first; i < n && i < first + chunk_size; i++) {
+        double x = a + harness_uniform(&g) * (b - a);
+        double y = (*test->function_double)(x);
+
+        mpfr_set_d(mp->x, x, MPFR_RNDN);
+        (*test->mp_function)(mp->result, mp->x, MPFR_RNDN);
+        double z = mpfr_get_d(mp->result, MPFR_RNDN);
+
+        // in MPFR, for the subnormals, where the error is below the ulp
+        mpfr_sub_d(mp->error, mp->result, y, MPFR_RNDN);
+        mpfr_abs(mp->error, mp->error, MPFR_RNDN);
+        double abs_error = mpfr_get_d(mp->error, MPFR_RNDN);
+        mpfr_div_d(mp->error, mp->error, ulp_result_double(z), MPFR_RNDN);
+        double rel_error = mpfr_get_d(mp->error, MPFR_RNDN);
+        if (rel_error >= 1.0) {
+            flockfile(stderr);
+            fprintf(stderr, "%*s%s(%a) = %a, expected %a\n", indent, "", test->name, x, y, z);
+            funlockfile(stderr);
+        }
+        harness_count(stats, j, abs_error, rel_error);
+    }
+}
+
+static void
+test_float(const test_function *test)
+{
+    printf("testing float %s ...\n\n", test->name);
+    indent += 4;
+    harness_job job = {
+        .context = test,
+        .n_chunks = N_INTERVALS * harness_chunks(n, chunk_size),
+        .local_size = sizeof (harness_mp),
+        .init = &harness_mp_init,
+        .clear = &harness_mp_clear,
+        .chunk = &test_float_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
+    assert(harness_total(&stats) == N_INTERVALS * n);
+    print_stats(&stats, test->intervals_float);
+    indent -= 4;
+}
+
+static void
+test_double(const test_function *test)
+{
+    printf("testing double %s ...\n\n", test->name);
+    indent += 4;
+    harness_job job = {
+        .context = test,
+        .n_chunks = N_INTERVALS * harness_chunks(n, chunk_size),
+        .local_size = sizeof (harness_mp),
+        .init = &harness_mp_init,
+        .clear = &harness_mp_clear,
+        .chunk = &test_double_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
+    assert(harness_total(&stats) == N_INTERVALS * n);
+    print_stats(&stats, test->intervals_double);
+    indent -= 4;
+}
+
+/*
+ * The special values, against MPFR, with the sign of zero: the results
+ * are exact (0, 1, -1, ±∞, NaN), or at the thresholds of overflow and
+ * underflow.
+ */
+
+static const double special_values[] = {
+    0.0, -0.0, 0x1.0p-1074, -0x1.0p-1074, 0x1.0p-149, -0x1.0p-149,
+    1.0, -1.0, 88.7f, 89.0, -103.9f, -104.0, 128.0, 127.99f, -150.0, -149.5,
+    709.78, 710.0, -745.1, -746.0, 1024.0, -1074.0, -1075.5,
+    0x1.fffffffffffffp1023, -0x1.fffffffffffffp1023, INFINITY, -INFINITY, NAN,
+};
+
+#define N_SPECIAL_VALUES (sizeof special_values / sizeof special_values[0])
+
+static int
+same_float(float a, float b)
+{
+    return (a == b && signbit(a) == signbit(b)) || (isnan(a) && isnan(b));
+}
+
+static int
+same_double(double a, double b)
+{
+    return (a == b && signbit(a) == signbit(b)) || (isnan(a) && isnan(b));
+}
+
+static void
+test_special_values(void)
+{
+    mpfr_t x, y;
+    mpfr_init2(x, HARNESS_MP_PRECISION);
+    mpfr_init2(y, HARNESS_MP_PRECISION);
+    printf("testing special values ...\n\n");
+    printf("    mismatches:\n");
+    for (size_t k = 0; k < N_FUNCTIONS; k++) {
+        const test_function *test = &functions[k];
+        size_t mismatches_float = 0;
+        size_t mismatches_double = 0;
+        for (size_t i = 0; i < N_SPECIAL_VALUES; i++) {
+            float xf = (float) special_values[i];
+            mpfr_set_flt(x, xf, MPFR_RNDN);
+            (*test->mp_function)(y, x, MPFR_RNDN);
+            float yf = (*test->function_float)(xf);
+            if (!same_float(yf, mpfr_get_flt(y, MPFR_RNDN))) {
+                fprintf(stderr, "    %s(%a) = %a, expected %a\n", test->name, xf, yf, mpfr_get_flt(y, MPFR_RNDN));
+                mismatches_float++;
+            }
+            double xd = special_values[i];
+            mpfr_set_d(x, xd, MPFR_RNDN);
+            (*test->mp_function)(y, x, MPFR_RNDN);
+            double yd = (*test->function_double)(xd);
+            if (!same_double(yd, mpfr_get_d(y, MPFR_RNDN))) {
+                fprintf(stderr, "    %s(%a) = %a, expected %a\n", test->name, xd, yd, mpfr_get_d(y, MPFR_RNDN));
+                mismatches_double++;
+            }
+        }
+        printf("    %14s float %zu\n", test->name, mismatches_float);
+        printf("    %14s double %zu\n", test->name, mismatches_double);
+    }
+    printf("\n");
+    mpfr_clear(y);
+    mpfr_clear(x);
+}
+
+/*
+ * The array functions, against the scalar functions, on the special
+ * values and the intervals, with a length that is not a multiple of 16.
+ */
+
+#define N_ARRAY 1001
+
+static void
+test_arrays(void)
+{
+    static float xfs[N_ARRAY], yfs[N_ARRAY], zfs[N_ARRAY];
+    static double xds[N_ARRAY], yds[N_ARRAY], zds[N_ARRAY];
+    harness_random g = harness_chunk_random(0);
+    for (size_t i = 0; i < N_ARRAY; i++) {
+        const double *interval = functions[0].intervals_double[i % N_INTERVALS];
+        double x = i < N_SPECIAL_VALUES ? special_values[i]
+            : interval[0] + harness_uniform(&g) * (interval[1] - interval[0]);
+        xfs[i] = (float) x;
+        xds[i] = x;
+    }
+    printf("testing arrays ...\n\n");
+    printf("    mismatches:\n");
+    for (size_t k = 0; k < N_FUNCTIONS; k++) {
+        const test_function *test = &functions[k];
+        if (k == 0) {
+            _exp_array(xfs, yfs, N_ARRAY);
+            _exp_array(xds, yds, N_ARRAY);
+        } else if (k == 1) {
+            _exp2_array(xfs, yfs, N_ARRAY);
+            _exp2_array(xds, yds, N_ARRAY);
+        } else {
+            _expm1_array(xfs, yfs, N_ARRAY);
+            _expm1_array(xds, yds, N_ARRAY);
+        }
+        size_t mismatches_float = 0;
+        size_t mismatches_double = 0;
+        for (size_t i = 0; i < N_ARRAY; i++) {
+            zfs[i] = (*test->function_float)(xfs[i]);
+            zds[i] = (*test->function_double)(xds[i]);
+            mismatches_float += !same_float(yfs[i], zfs[i]);
+            mismatches_double += !same_double(yds[i], zds[i]);
+        }
+        printf("    %14s float %zu\n", test->name, mismatches_float);
+        printf("    %14s double %zu\n", test->name, mismatches_double);
+    }
+    printf("\n");
+}
+
+int
+main(void)
+{
+    for (size_t k = 0; k < N_FUNCTIONS; k++) {
+        test_float(&functions[k]);
+        test_double(&functions[k]);
+    }
+    test_special_values();
+    test_arrays();
+    return 0;
+}
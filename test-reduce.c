@@ -1,130 +1,199 @@
 /* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
 
 #include <assert.h>
-#include <math.h> // fabs, frexp, ldexp
-#include <stdio.h>
+#include <math.h> // INFINITY, fabs, frexp, ldexp
+#include <stdio.h> // flockfile, printf
 #include <stddef.h> // size_t
 #include <stdint.h> // int64_t
-#include <stdlib.h> // drand48
-#include <string.h> // strcmp
+#include <string.h> // memcmp, strcmp
 
 #include <mpfr.h>
 
 #include "common.h" // ulp
+#include "harness.h"
+#include "magnitudes.h" // magnitudes_double, magnitudes_float
 #include "reduce.h"
-#include "types.h" // rem_result_double, rem_result_float
+#include "types.h" // quadrant_result_double, rem_result_double, etc.
 
 static const mpfr_prec_t mp_precision = 2 * (sizeof(double) * 8);
 
+/*
+ * Large arguments (Payne-Hanek): only the quotient modulo 4 is returned,
+ * and x⋅2∕π needs about 1100 bits to be represented exactly.
+ */
+
+static const mpfr_prec_t mp_precision_large = 2048;
+
 static const size_t n = 1000000;
 
+// The size of the chunks of the test (harness.h).
+static const size_t chunk_size = 1 << 14;
+
 static int indent = 0;
 
+/*
+ * The arguments nearest to a multiple of π∕2, beyond the thresholds of
+ * Payne-Hanek, for the exponents where the remainder is the smallest,
+ * found with the continued fractions of 2ᵉ⋅2∕π: as small as 2⁻²⁹ (float)
+ * and 2⁻⁶⁰·⁹ (double), which the random arguments never come close to.
+ * They are tested after the magnitudes, within the largest one.
+ */
+
+static const float hard_cases_float[] = {
+    0x1.f37c8ap+95f, 0x1.47d0fep+34f, 0x1.32ede2p+85f, 0x1.628d4cp+40f,
+    0x1.130930p+76f, 0x1.b08c4ap+111f,
+};
+
+static const double hard_cases_double[] = {
+    0x1.6ac5b262ca1ffp+849, 0x1.504cac51f1eafp+131, 0x1.e009c53148be1p+991,
+    0x1.4c96c11134d36p+577, 0x1.cfe482285f8edp+860, 0x1.db41f3cb71d7bp+680,
+};
+
+/*
+ * The magnitudes of a test, then its hard cases (x, and -x), in a chunk
+ * of their own. With a modulus, the quotient is tested modulo it.
+ */
+
+typedef struct {
+    rem_result_float (*rem_float)(float);
+    rem_result_double (*rem_double)(double);
+    mpfr_ptr mp_divisor;
+    unsigned long int modulus;
+    const void *magnitudes; // float or double
+    size_t n_magnitudes;
+    const void *hard_cases; // float or double
+    size_t n_hard_cases;
+} test_context;
+
+/*
+ * The MPFR variables of a thread (harness.h), of the precision of the
+ * divisor. The expected result is the quotient, then the remainder.
+ */
+
+static void
+mp_local_init(const void *context, void *local)
+{
+    const test_context *test = context;
+    harness_mp_init2(local, mpfr_get_prec(test->mp_divisor));
+}
+
 static void
-test_q_and_r_float(rem_result_float (*rem_function)(float), mpfr_t mp_divisor)
+run(test_context *context, void (*chunk)(const void *, void *, size_t, harness_stats *), harness_stats *stats)
 {
-    size_t error_dist[4] = {0};
-    const float magnitudes[] = {
-        0x1.0p+00f,
-        0x1.0p+01f,
-        0x1.0p+02f,
-        0x1.0p+04f,
-        0x1.0p+08f,
-        0x1.0p+16f,
-        0x1.0p+20f,
-        0x1.0p+23f,
+    harness_job job = {
+        .context = context,
+        .n_chunks = context->n_magnitudes * harness_chunks(n, chunk_size) + (context->n_hard_cases > 0),
+        .local_size = sizeof (harness_mp),
+        .init = &mp_local_init,
+        .clear = &harness_mp_clear,
+        .chunk = chunk,
     };
-    float max_abs_error_by_magnitude[24] = {0.0f};
-    float max_rel_error_by_magnitude[24] = {0.0f};
-    for (size_t j = 0; j < sizeof magnitudes / sizeof magnitudes[0]; j++) {
-        float max_abs_error = 0.0f;
-        float max_rel_error = 0.0f;
-        for (size_t i = 0; i < n; i++) {
-            float x = (drand48() - 0.5) * 2.0f * magnitudes[j];
-            mpfr_t mp_x;
-            mpfr_init2(mp_x, mp_precision);
-            mpfr_set_flt(mp_x, x, MPFR_RNDN);
-
-            rem_result_float rem = (*rem_function)(x);
-            int32_t q = rem.z;
-            float r = rem.v1 + rem.v2;
-            float abs_error = 0.0f;
-            float rel_error = 0.0f;
-
-            // mp_q = trunc(mp_x / mp_divisor)
-            mpfr_t mp_q;
-            mpfr_init2(mp_q, mp_precision);
-            mpfr_div(mp_q, mp_x, mp_divisor, MPFR_RNDN);
-            mpfr_trunc(mp_q, mp_q);
-            long int mp_q_int = mpfr_get_si(mp_q, MPFR_RNDN);
-            if (q != mp_q_int) {
-                fprintf(stderr, "%*sx = %.12f\n", indent, "", x);
-                fprintf(
-                    stderr,
-                    "%*squotient of %.12f ÷ %.12f = %.0f\n",
-                    indent, "",
-                    mpfr_get_flt(mp_x, MPFR_RNDN),
-                    mpfr_get_flt(mp_divisor, MPFR_RNDN),
-                    mpfr_get_flt(mp_q, MPFR_RNDN)
-                );
-                fprintf(stderr, "%*s    expected q = %+li\n", indent, "", mp_q_int);
-                fprintf(stderr, "%*s         got q = %+i\n", indent, "", q);
-            }
-            assert(q == mp_q_int);
-
-            // mp_r = remainder(mp_x / mp_divisor)
-            mpfr_t mp_r;
-            mpfr_init2(mp_r, mp_precision);
-            mpfr_fmod(mp_r, mp_x, mp_divisor, MPFR_RNDN);
-            float mp_r_float = mpfr_get_flt(mp_r, MPFR_RNDN);
-            abs_error = fabsf(r - mp_r_float);
-            rel_error = abs_error / ulp(mp_r_float);
-            if (rel_error >= 3.0f) {
-                fprintf(stderr, "%*sx = %+.12f\n", indent, "", x);
-                int N = significant_digits(mp_r_float);
-                fprintf(
-                    stderr,
-                    "%*sremainder of %+.12f ÷ %+.12f = %+.*f\n",
-                    indent, "",
-                    mpfr_get_flt(mp_x, MPFR_RNDN),
-                    mpfr_get_flt(mp_divisor, MPFR_RNDN),
-                    N, mp_r_float
-                );
-                fprintf(stderr, "%*s    expected r = %+.*f\n", indent, "", N, mp_r_float);
-                fprintf(stderr, "%*s         got r = %+.*f\n", indent, "", N, r);
-                fprintf(stderr, "%*s         error = %+.*f\n", indent, "", N, abs_error);
-                fprintf(stderr, "%*s        ulp(r) = %+.*f\n", indent, "", N, ulp(mp_r_float));
-            }
-            if (abs_error > max_abs_error)
-                max_abs_error = abs_error;
-            if (rel_error > max_rel_error)
-                max_rel_error = rel_error;
-
-            mpfr_clear(mp_r);
-            mpfr_clear(mp_q);
-            mpfr_clear(mp_x);
-
-            if (rel_error >= 3.0f)
-                error_dist[3]++;
-            else if (rel_error >= 2.0f)
-                error_dist[2]++;
-            else if (rel_error >= 1.0f)
-                error_dist[1]++;
-            else
-                error_dist[0]++;
+    harness_run(&job, stats);
+}
+
+static void
+test_q_and_r_float_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    const test_context *test = context;
+    rem_result_float (*rem_function)(float) = test->rem_float;
+    const float *magnitudes = test->magnitudes;
+    const float *hard_cases = test->hard_cases;
+    mpfr_ptr mp_divisor = test->mp_divisor;
+    harness_mp *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+    size_t j = chunk / harness_chunks(n, chunk_size);
+    size_t first = (chunk % harness_chunks(n, chunk_size)) * chunk_size;
+    size_t last = j < test->n_magnitudes ? n : 2 * test->n_hard_cases;
+    for (size_t i = first; i < last && i < first + chunk_size; i++) {
+        float x = (harness_uniform(&g) - 0.5) * 2.0f * magnitudes[j < test->n_magnitudes ? j : 0];
+        if (j == test->n_magnitudes)
+            x = i % 2 == 0 ? hard_cases[i / 2] : -hard_cases[i / 2];
+        if (test->modulus != 0 && fabsf(x) < 1.0f)
+            continue;
+        mpfr_set_flt(mp->x, x, MPFR_RNDN);
+
+        rem_result_float rem = (*rem_function)(x);
+        int32_t q = rem.z;
+        float r = rem.v1 + rem.v2;
+        float abs_error = 0.0f;
+        float rel_error = 0.0f;
+
+        // mp_q = trunc(mp_x / mp_divisor), modulo the modulus
+        mpfr_div(mp->result, mp->x, mp_divisor, MPFR_RNDN);
+        mpfr_trunc(mp->result, mp->result);
+        if (test->modulus != 0)
+            mpfr_fmod_ui(mp->result, mp->result, test->modulus, MPFR_RNDN);
+        long int mp_q_int = mpfr_get_si(mp->result, MPFR_RNDN);
+        if (q != mp_q_int) {
+            flockfile(stderr);
+            fprintf(stderr, "%*sx = %a\n", indent, "", x);
+            fprintf(
+                stderr,
+                "%*squotient of %.12f ÷ %.12f = %.0f\n",
+                indent, "",
+                mpfr_get_flt(mp->x, MPFR_RNDN),
+                mpfr_get_flt(mp_divisor, MPFR_RNDN),
+                mpfr_get_flt(mp->result, MPFR_RNDN)
+            );
+            fprintf(stderr, "%*s    expected q = %+li\n", indent, "", mp_q_int);
+            fprintf(stderr, "%*s         got q = %+i\n", indent, "", q);
+            funlockfile(stderr);
         }
-        max_abs_error_by_magnitude[j] = max_abs_error;
-        max_rel_error_by_magnitude[j] = max_rel_error;
+        assert(q == mp_q_int);
+
+        // mp_r = remainder(mp_x / mp_divisor)
+        mpfr_fmod(mp->result, mp->x, mp_divisor, MPFR_RNDN);
+        float mp_r_float = mpfr_get_flt(mp->result, MPFR_RNDN);
+        abs_error = fabsf(r - mp_r_float);
+        rel_error = abs_error / ulp(mp_r_float);
+        if (rel_error >= 3.0f) {
+            int N = significant_digits(mp_r_float);
+            flockfile(stderr);
+            fprintf(stderr, "%*sx = %a\n", indent, "", x);
+            fprintf(
+                stderr,
+                "%*sremainder of %+.12f ÷ %+.12f = %+.*f\n",
+                indent, "",
+                mpfr_get_flt(mp->x, MPFR_RNDN),
+                mpfr_get_flt(mp_divisor, MPFR_RNDN),
+                N, mp_r_float
+            );
+            fprintf(stderr, "%*s    expected r = %+.*f\n", indent, "", N, mp_r_float);
+            fprintf(stderr, "%*s         got r = %+.*f\n", indent, "", N, r);
+            fprintf(stderr, "%*s         error = %+.*f\n", indent, "", N, abs_error);
+            fprintf(stderr, "%*s        ulp(r) = %+.*f\n", indent, "", N, ulp(mp_r_float));
+            funlockfile(stderr);
+        }
+        harness_count(stats, j, abs_error, rel_error);
     }
-    size_t m = n * sizeof magnitudes / sizeof magnitudes[0];
-    assert(error_dist[0] + error_dist[1] + error_dist[2] + error_dist[3] == m);
-    printf("\n");
-    printf("%*serror distribution:\n", indent, "");
-    printf("%*s 0 ulp %zu (%.2f%%)\n", indent, "", error_dist[0], (float) error_dist[0] / m * 100.0f);
-    printf("%*s 1 ulp %zu (%.2f%%)\n", indent, "", error_dist[1], (float) error_dist[1] / m * 100.0f);
-    printf("%*s 2 ulp %zu (%.2f%%)\n", indent, "", error_dist[2], (float) error_dist[2] / m * 100.0f);
-    printf("%*s≥3 ulp %zu (%.2f%%)\n", indent, "", error_dist[3], (float) error_dist[3] / m * 100.0f);
+}
+
+/*
+ * Test the quotient (modulo the modulus, if not 0) and the remainder of
+ * a reduction, for the magnitudes in [min_magnitude, max_magnitude], and
+ * the hard cases below the largest of them.
+ */
+
+static void
+test_q_and_r_float(rem_result_float (*rem_function)(float), mpfr_t mp_divisor, float min_magnitude, float max_magnitude, unsigned long int modulus)
+{
+    size_t first = 0;
+    while (first < N_MAGNITUDES_FLOAT && magnitudes_float[first] < min_magnitude)
+        first++;
+    size_t n_magnitudes = 0;
+    while (first + n_magnitudes < N_MAGNITUDES_FLOAT && magnitudes_float[first + n_magnitudes] <= max_magnitude)
+        n_magnitudes++;
+    const float *magnitudes = &magnitudes_float[first];
+    size_t n_hard_cases = 0;
+    for (size_t i = 0; i < sizeof hard_cases_float / sizeof hard_cases_float[0]; i++)
+        n_hard_cases += n_magnitudes > 0 && hard_cases_float[i] <= magnitudes[n_magnitudes - 1];
+    assert(n_hard_cases == 0 || n_hard_cases == sizeof hard_cases_float / sizeof hard_cases_float[0]);
+    test_context context = {rem_function, NULL, mp_divisor, modulus, magnitudes, n_magnitudes, hard_cases_float, n_hard_cases};
+    harness_stats stats = {0};
+    run(&context, &test_q_and_r_float_chunk, &stats);
+    assert(modulus != 0 || harness_total(&stats) == n * n_magnitudes + 2 * n_hard_cases);
     printf("\n");
+    harness_print_distribution(&stats, indent);
 
     printf("%*smaximum error by magnitude:\n", indent, "");
     printf(
@@ -137,127 +206,125 @@ test_q_and_r_float(rem_result_float (*rem_function)(float), mpfr_t mp_divisor)
     printf("%*s┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈  ", indent, "");
     printf("┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈  ");
     printf("┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈\n");
-    for (size_t j = 0; j < sizeof magnitudes / sizeof magnitudes[0]; j++) {
+    for (size_t j = 0; j < n_magnitudes; j++) {
         printf(
             "%*s%30a  %30.12e  %30.1f\n",
             indent, "",
             magnitudes[j],
-            max_abs_error_by_magnitude[j],
-            max_rel_error_by_magnitude[j]
+            stats.max_abs_error[j],
+            stats.max_rel_error[j]
+        );
+    }
+    if (n_hard_cases > 0) {
+        printf(
+            "%*s%30s  %30.12e  %30.1f\n",
+            indent, "",
+            "hard cases",
+            stats.max_abs_error[n_magnitudes],
+            stats.max_rel_error[n_magnitudes]
         );
     }
     printf("\n");
 }
 
 static void
-test_q_and_r_double(rem_result_double (*rem_function)(double), mpfr_t mp_divisor)
+test_q_and_r_double_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
 {
-    size_t error_dist[4] = {0};
-    const double magnitudes[] = {
-        0x1.0p+00,
-        0x1.0p+01,
-        0x1.0p+02,
-        0x1.0p+04,
-        0x1.0p+08,
-        0x1.0p+16,
-        0x1.0p+24,
-        0x1.0p+32,
-        0x1.0p+40,
-        0x1.0p+48,
-        0x1.0p+52,
-    };
-    double max_abs_error_by_magnitude[24] = {0.0};
-    double max_rel_error_by_magnitude[24] = {0.0};
-    for (size_t j = 0; j < sizeof magnitudes / sizeof magnitudes[0]; j++) {
-        double max_abs_error = 0.0;
-        double max_rel_error = 0.0;
-        for (size_t i = 0; i < n; i++) {
-            double x = (drand48() - 0.5) * 2.0 * magnitudes[j];
-            mpfr_t mp_x;
-            mpfr_init2(mp_x, mp_precision);
-            mpfr_set_d(mp_x, x, MPFR_RNDN);
-
-            rem_result_double rem = (*rem_function)(x);
-            int64_t q = rem.z;
-            double r = rem.v1 + rem.v2;
-            double abs_error = 0.0;
-            double rel_error = 0.0;
-
-            // mp_q = trunc(mp_x / mp_divisor)
-            mpfr_t mp_q;
-            mpfr_init2(mp_q, mp_precision);
-            mpfr_div(mp_q, mp_x, mp_divisor, MPFR_RNDN);
-            mpfr_trunc(mp_q, mp_q);
-            long int mp_q_int = mpfr_get_si(mp_q, MPFR_RNDN);
-            if (q != mp_q_int) {
-                fprintf(stderr, "%*sx = %.20f\n", indent, "", x);
-                fprintf(
-                    stderr,
-                    "%*squotient of %.20f ÷ %.20f = %.0f\n",
-                    indent, "",
-                    mpfr_get_d(mp_x, MPFR_RNDN),
-                    mpfr_get_d(mp_divisor, MPFR_RNDN),
-                    mpfr_get_d(mp_q, MPFR_RNDN)
-                );
-                fprintf(stderr, "%*s    expected q = %+li\n", indent, "", mp_q_int);
-                fprintf(stderr, "%*s         got q = %+li\n", indent, "", q);
-            }
-            assert(q == mp_q_int);
-
-            // mp_r = remainder(mp_x / mp_divisor)
-            mpfr_t mp_r;
-            mpfr_init2(mp_r, mp_precision);
-            mpfr_fmod(mp_r, mp_x, mp_divisor, MPFR_RNDN);
-            double mp_r_double = mpfr_get_d(mp_r, MPFR_RNDN);
-            abs_error = fabs(r - mp_r_double);
-            rel_error = abs_error / ulp(mp_r_double);
-            if (rel_error >= 3.0) {
-                fprintf(stderr, "%*sx = %+.20f\n", indent, "", x);
-                int N = significant_digits(mp_r_double);
-                fprintf(
-                    stderr,
-                    "%*sremainder of %+.20f ÷ %+.20f = %+.*f\n",
-                    indent, "",
-                    mpfr_get_d(mp_x, MPFR_RNDN),
-                    mpfr_get_d(mp_divisor, MPFR_RNDN),
-                    N, mp_r_double
-                );
-                fprintf(stderr, "%*s    expected r = %+.*f\n", indent, "", N, mp_r_double);
-                fprintf(stderr, "%*s         got r = %+.*f\n", indent, "", N, r);
-                fprintf(stderr, "%*s         error = %+.*f\n", indent, "", N, abs_error);
-                fprintf(stderr, "%*s        ulp(r) = %+.*f\n", indent, "", N, ulp(mp_r_double));
-            }
-            // assert(fabs(r - mp_r_double) <= ulp(mp_r_double));
-            if (abs_error > max_abs_error)
-                max_abs_error = abs_error;
-            if (rel_error > max_rel_error)
-                max_rel_error = rel_error;
-
-            mpfr_clear(mp_r);
-            mpfr_clear(mp_q);
-            mpfr_clear(mp_x);
-
-            if (rel_error >= 3.0)
-                error_dist[3]++;
-            else if (rel_error >= 2.0)
-                error_dist[2]++;
-            else if (rel_error >= 1.0)
-                error_dist[1]++;
-            else
-                error_dist[0]++;
+    const test_context *test = context;
+    rem_result_double (*rem_function)(double) = test->rem_double;
+    const double *magnitudes = test->magnitudes;
+    const double *hard_cases = test->hard_cases;
+    mpfr_ptr mp_divisor = test->mp_divisor;
+    harness_mp *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+    size_t j = chunk / harness_chunks(n, chunk_size);
+    size_t first = (chunk % harness_chunks(n, chunk_size)) * chunk_size;
+    size_t last = j < test->n_magnitudes ? n : 2 * test->n_hard_cases;
+    for (size_t i = first; i < last && i < first + chunk_size; i++) {
+        double x = (harness_uniform(&g) - 0.5) * 2.0 * magnitudes[j < test->n_magnitudes ? j : 0];
+        if (j == test->n_magnitudes)
+            x = i % 2 == 0 ? hard_cases[i / 2] : -hard_cases[i / 2];
+        if (test->modulus != 0 && fabs(x) < 1.0)
+            continue;
+        mpfr_set_d(mp->x, x, MPFR_RNDN);
+
+        rem_result_double rem = (*rem_function)(x);
+        int64_t q = rem.z;
+        double r = rem.v1 + rem.v2;
+        double abs_error = 0.0;
+        double rel_error = 0.0;
+
+        // mp_q = trunc(mp_x / mp_divisor), modulo the modulus
+        mpfr_div(mp->result, mp->x, mp_divisor, MPFR_RNDN);
+        mpfr_trunc(mp->result, mp->result);
+        if (test->modulus != 0)
+            mpfr_fmod_ui(mp->result, mp->result, test->modulus, MPFR_RNDN);
+        long int mp_q_int = mpfr_get_si(mp->result, MPFR_RNDN);
+        if (q != mp_q_int) {
+            flockfile(stderr);
+            fprintf(stderr, "%*sx = %a\n", indent, "", x);
+            fprintf(
+                stderr,
+                "%*squotient of %.20f ÷ %.20f = %.0f\n",
+                indent, "",
+                mpfr_get_d(mp->x, MPFR_RNDN),
+                mpfr_get_d(mp_divisor, MPFR_RNDN),
+                mpfr_get_d(mp->result, MPFR_RNDN)
+            );
+            fprintf(stderr, "%*s    expected q = %+li\n", indent, "", mp_q_int);
+            fprintf(stderr, "%*s         got q = %+li\n", indent, "", q);
+            funlockfile(stderr);
+        }
+        assert(q == mp_q_int);
+
+        // mp_r = remainder(mp_x / mp_divisor)
+        mpfr_fmod(mp->result, mp->x, mp_divisor, MPFR_RNDN);
+        double mp_r_double = mpfr_get_d(mp->result, MPFR_RNDN);
+        abs_error = fabs(r - mp_r_double);
+        rel_error = abs_error / ulp(mp_r_double);
+        if (rel_error >= 3.0) {
+            int N = significant_digits(mp_r_double);
+            flockfile(stderr);
+            fprintf(stderr, "%*sx = %a\n", indent, "", x);
+            fprintf(
+                stderr,
+                "%*sremainder of %+.20f ÷ %+.20f = %+.*f\n",
+                indent, "",
+                mpfr_get_d(mp->x, MPFR_RNDN),
+                mpfr_get_d(mp_divisor, MPFR_RNDN),
+                N, mp_r_double
+            );
+            fprintf(stderr, "%*s    expected r = %+.*f\n", indent, "", N, mp_r_double);
+            fprintf(stderr, "%*s         got r = %+.*f\n", indent, "", N, r);
+            fprintf(stderr, "%*s         error = %+.*f\n", indent, "", N, abs_error);
+            fprintf(stderr, "%*s        ulp(r) = %+.*f\n", indent, "", N, ulp(mp_r_double));
+            funlockfile(stderr);
         }
-        max_abs_error_by_magnitude[j] = max_abs_error;
-        max_rel_error_by_magnitude[j] = max_rel_error;
+        // assert(fabs(r - mp_r_double) <= ulp(mp_r_double));
+        harness_count(stats, j, abs_error, rel_error);
     }
-    size_t m = n * sizeof magnitudes / sizeof magnitudes[0];
-    assert(error_dist[0] + error_dist[1] + error_dist[2] + error_dist[3] == m);
-    printf("\n");
-    printf("%*serror distribution:\n", indent, "");
-    printf("%*s 0 ulp %zu (%.2f%%)\n", indent, "", error_dist[0], (double) error_dist[0] / m * 100.0);
-    printf("%*s 1 ulp %zu (%.2f%%)\n", indent, "", error_dist[1], (double) error_dist[1] / m * 100.0);
-    printf("%*s 2 ulp %zu (%.2f%%)\n", indent, "", error_dist[2], (double) error_dist[2] / m * 100.0);
-    printf("%*s≥3 ulp %zu (%.2f%%)\n", indent, "", error_dist[3], (double) error_dist[3] / m * 100.0);
+}
+
+static void
+test_q_and_r_double(rem_result_double (*rem_function)(double), mpfr_t mp_divisor, double min_magnitude, double max_magnitude, unsigned long int modulus)
+{
+    size_t first = 0;
+    while (first < N_MAGNITUDES_DOUBLE && magnitudes_double[first] < min_magnitude)
+        first++;
+    size_t n_magnitudes = 0;
+    while (first + n_magnitudes < N_MAGNITUDES_DOUBLE && magnitudes_double[first + n_magnitudes] <= max_magnitude)
+        n_magnitudes++;
+    const double *magnitudes = &magnitudes_double[first];
+    size_t n_hard_cases = 0;
+    for (size_t i = 0; i < sizeof hard_cases_double / sizeof hard_cases_double[0]; i++)
+        n_hard_cases += n_magnitudes > 0 && hard_cases_double[i] <= magnitudes[n_magnitudes - 1];
+    assert(n_hard_cases == 0 || n_hard_cases == sizeof hard_cases_double / sizeof hard_cases_double[0]);
+    test_context context = {NULL, rem_function, mp_divisor, modulus, magnitudes, n_magnitudes, hard_cases_double, n_hard_cases};
+    harness_stats stats = {0};
+    run(&context, &test_q_and_r_double_chunk, &stats);
+    assert(modulus != 0 || harness_total(&stats) == n * n_magnitudes + 2 * n_hard_cases);
     printf("\n");
+    harness_print_distribution(&stats, indent);
 
     printf("%*smaximum error by magnitude:\n", indent, "");
     printf(
@@ -270,21 +337,271 @@ test_q_and_r_double(rem_result_double (*rem_function)(double), mpfr_t mp_divisor
     printf("%*s┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈  ", indent, "");
     printf("┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈  ");
     printf("┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈┈\n");
-    for (size_t j = 0; j < sizeof magnitudes / sizeof magnitudes[0]; j++) {
+    for (size_t j = 0; j < n_magnitudes; j++) {
         printf(
             "%*s%30a  %30.18e  %30.1f\n",
             indent, "",
             magnitudes[j],
-            max_abs_error_by_magnitude[j],
-            max_rel_error_by_magnitude[j]
+            stats.max_abs_error[j],
+            stats.max_rel_error[j]
+        );
+    }
+    if (n_hard_cases > 0) {
+        printf(
+            "%*s%30s  %30.18e  %30.1f\n",
+            indent, "",
+            "hard cases",
+            stats.max_abs_error[n_magnitudes],
+            stats.max_rel_error[n_magnitudes]
         );
     }
     printf("\n");
 }
 
+/*
+ * The quadrant reduction returns z = k + σ, so recover k = z - σ
+ * to test it against the quotient and remainder of MPFR.
+ * The two low bits of z must be k mod 4.
+ */
+
+static rem_result_float
+bdl_quadrant_rem_pi_2_float(float x)
+{
+    quadrant_result_float result = bdl_quadrant_pi_2_float(x);
+    int32_t k = (int32_t) (result.z - QUADRANT_BIAS_FLOAT);
+    assert(_quadrant(result.z) == ((uint32_t) k & 3));
+    return (rem_result_float) {k, result.v1, result.v2};
+}
+
+static rem_result_double
+bdl_quadrant_rem_pi_2_double(double x)
+{
+    quadrant_result_double result = bdl_quadrant_pi_2_double(x);
+    int64_t k = (int64_t) (result.z - QUADRANT_BIAS_DOUBLE);
+    assert(_quadrant(result.z) == ((uint64_t) k & 3));
+    return (rem_result_double) {k, result.v1, result.v2};
+}
+
+static rem_result_float
+bdl_dekker_quadrant_rem_pi_2_float(float x)
+{
+    quadrant_result_float result = bdl_dekker_quadrant_pi_2_float(x);
+    int32_t k = (int32_t) (result.z - QUADRANT_BIAS_FLOAT);
+    assert(_quadrant(result.z) == ((uint32_t) k & 3));
+    return (rem_result_float) {k, result.v1, result.v2};
+}
+
+static rem_result_double
+bdl_dekker_quadrant_rem_pi_2_double(double x)
+{
+    quadrant_result_double result = bdl_dekker_quadrant_pi_2_double(x);
+    int64_t k = (int64_t) (result.z - QUADRANT_BIAS_DOUBLE);
+    assert(_quadrant(result.z) == ((uint64_t) k & 3));
+    return (rem_result_double) {k, result.v1, result.v2};
+}
+
+/*
+ * The array reductions, against the scalar reductions, bit for bit
+ * (z, v₁ and v₂), on random magnitudes up to 2²⁰ (float) and 2⁴⁸ (double),
+ * where all three are exact, and special values, with every length up to
+ * 64 and a length that is not a multiple of the vector width.
+ */
+
+static const double array_special_values[] = {
+    0.0, -0.0, 0x1.0p-1074, 0x1.0p-149, 0x1.0p-30, 1.0,
+    0x1.921fb54442d18p0, 0x1.921fb6p0, 0x1.921fb54442d18p1, 0x1.0p20,
+    0x1.0p48,
+};
+
+#define N_ARRAY_SPECIAL_VALUES (sizeof array_special_values / sizeof array_special_values[0])
+
+#define N_ARRAY 1001
+
+static void
+test_arrays_float(void)
+{
+    static float xs[N_ARRAY], v1s[N_ARRAY], v2s[N_ARRAY], qzs[N_ARRAY];
+    static int32_t zs[N_ARRAY];
+    harness_random g = harness_chunk_random(0);
+    for (size_t i = 0; i < N_ARRAY; i++) {
+        double x = ldexp(harness_uniform(&g), (int) (harness_uniform(&g) * 52.0) - 32);
+        if (i < N_ARRAY_SPECIAL_VALUES && array_special_values[i] <= 0x1.0p20)
+            x = array_special_values[i];
+        xs[i] = (float) (harness_uniform(&g) < 0.5 ? -x : x);
+    }
+
+    size_t mismatches[3] = {0};
+    for (size_t k = 0; k <= N_ARRAY; k = k < 64 ? k + 1 : N_ARRAY) {
+        cw_rem_pi_2_array_float(xs, k, zs, v1s, v2s);
+        for (size_t i = 0; i < k; i++) {
+            rem_result_float r = cw_rem_pi_2_float(xs[i]);
+            mismatches[0] += r.z != zs[i]
+                || memcmp(&r.v1, &v1s[i], sizeof (float)) != 0
+                || memcmp(&r.v2, &v2s[i], sizeof (float)) != 0;
+        }
+        bdl_rem_pi_2_array_float(xs, k, zs, v1s, v2s);
+        for (size_t i = 0; i < k; i++) {
+            rem_result_float r = bdl_rem_pi_2_float(xs[i]);
+            mismatches[1] += r.z != zs[i]
+                || memcmp(&r.v1, &v1s[i], sizeof (float)) != 0
+                || memcmp(&r.v2, &v2s[i], sizeof (float)) != 0;
+        }
+        bdl_quadrant_pi_2_array_float(xs, k, qzs, v1s, v2s);
+        for (size_t i = 0; i < k; i++) {
+            quadrant_result_float r = bdl_quadrant_pi_2_float(xs[i]);
+            mismatches[2] += memcmp(&r.z, &qzs[i], sizeof (float)) != 0
+                || memcmp(&r.v1, &v1s[i], sizeof (float)) != 0
+                || memcmp(&r.v2, &v2s[i], sizeof (float)) != 0;
+        }
+        if (k == N_ARRAY)
+            break;
+    }
+
+    printf("%*stesting float arrays ...\n\n", indent, "");
+    printf("%*s    mismatches:\n", indent, "");
+    printf("%*s          cw_rem_pi_2 %zu\n", indent, "", mismatches[0]);
+    printf("%*s         bdl_rem_pi_2 %zu\n", indent, "", mismatches[1]);
+    printf("%*s    bdl_quadrant_pi_2 %zu\n", indent, "", mismatches[2]);
+    printf("\n");
+    assert(mismatches[0] == 0 && mismatches[1] == 0 && mismatches[2] == 0);
+}
+
+static void
+test_arrays_double(void)
+{
+    static double xs[N_ARRAY], v1s[N_ARRAY], v2s[N_ARRAY], qzs[N_ARRAY];
+    static int64_t zs[N_ARRAY];
+    harness_random g = harness_chunk_random(0);
+    for (size_t i = 0; i < N_ARRAY; i++) {
+        double x = ldexp(harness_uniform(&g), (int) (harness_uniform(&g) * 80.0) - 32);
+        if (i < N_ARRAY_SPECIAL_VALUES)
+            x = array_special_values[i];
+        xs[i] = harness_uniform(&g) < 0.5 ? -x : x;
+    }
+
+    size_t mismatches[3] = {0};
+    for (size_t k = 0; k <= N_ARRAY; k = k < 64 ? k + 1 : N_ARRAY) {
+        cw_rem_pi_2_array_double(xs, k, zs, v1s, v2s);
+        for (size_t i = 0; i < k; i++) {
+            rem_result_double r = cw_rem_pi_2_double(xs[i]);
+            mismatches[0] += r.z != zs[i]
+                || memcmp(&r.v1, &v1s[i], sizeof (double)) != 0
+                || memcmp(&r.v2, &v2s[i], sizeof (double)) != 0;
+        }
+        bdl_rem_pi_2_array_double(xs, k, zs, v1s, v2s);
+        for (size_t i = 0; i < k; i++) {
+            rem_result_double r = bdl_rem_pi_2_double(xs[i]);
+            mismatches[1] += r.z != zs[i]
+                || memcmp(&r.v1, &v1s[i], sizeof (double)) != 0
+                || memcmp(&r.v2, &v2s[i], sizeof (double)) != 0;
+        }
+        bdl_quadrant_pi_2_array_double(xs, k, qzs, v1s, v2s);
+        for (size_t i = 0; i < k; i++) {
+            quadrant_result_double r = bdl_quadrant_pi_2_double(xs[i]);
+            mismatches[2] += memcmp(&r.z, &qzs[i], sizeof (double)) != 0
+                || memcmp(&r.v1, &v1s[i], sizeof (double)) != 0
+                || memcmp(&r.v2, &v2s[i], sizeof (double)) != 0;
+        }
+        if (k == N_ARRAY)
+            break;
+    }
+
+    printf("%*stesting double arrays ...\n\n", indent, "");
+    printf("%*s    mismatches:\n", indent, "");
+    printf("%*s          cw_rem_pi_2 %zu\n", indent, "", mismatches[0]);
+    printf("%*s         bdl_rem_pi_2 %zu\n", indent, "", mismatches[1]);
+    printf("%*s    bdl_quadrant_pi_2 %zu\n", indent, "", mismatches[2]);
+    printf("\n");
+    assert(mismatches[0] == 0 && mismatches[1] == 0 && mismatches[2] == 0);
+}
+
 int
 main(int argc, char *argv[])
 {
+    if (argc == 2 && strcmp(argv[1], "array") == 0) {
+        test_arrays_float();
+        test_arrays_double();
+        return 0;
+    }
+
+    if (argc == 2 && strcmp(argv[1], "dekker") == 0) {
+        // π∕2, without fma
+        mpfr_t mp_pi_2;
+        mpfr_init2(mp_pi_2, mp_precision);
+        mpfr_const_pi(mp_pi_2, MPFR_RNDN);
+        mpfr_div_ui(mp_pi_2, mp_pi_2, 2, MPFR_RNDN);
+        {
+            printf("%*stesting float [0, π∕2] ...\n", indent, "");
+            indent += 4;
+            test_q_and_r_float(&bdl_dekker_rem_pi_2_float, mp_pi_2, 0.0f, 0x1.0p+23f, 0);
+            indent -= 4;
+        }
+        {
+            printf("%*stesting double [0, π∕2] ...\n", indent, "");
+            indent += 4;
+            test_q_and_r_double(&bdl_dekker_rem_pi_2_double, mp_pi_2, 0.0, 0x1.0p+52, 0);
+            indent -= 4;
+        }
+        {
+            printf("%*stesting float quadrant [0, π∕2] ...\n", indent, "");
+            indent += 4;
+            test_q_and_r_float(&bdl_dekker_quadrant_rem_pi_2_float, mp_pi_2, 0.0f, 0x1.0p+20f, 0);
+            indent -= 4;
+        }
+        {
+            printf("%*stesting double quadrant [0, π∕2] ...\n", indent, "");
+            indent += 4;
+            test_q_and_r_double(&bdl_dekker_quadrant_rem_pi_2_double, mp_pi_2, 0.0, 0x1.0p+48, 0);
+            indent -= 4;
+        }
+        mpfr_clear(mp_pi_2);
+        return 0;
+    }
+
+    if (argc == 2 && strcmp(argv[1], "ph") == 0) {
+        // π∕2
+        mpfr_t mp_pi_2;
+        mpfr_init2(mp_pi_2, mp_precision_large);
+        mpfr_const_pi(mp_pi_2, MPFR_RNDN);
+        mpfr_div_ui(mp_pi_2, mp_pi_2, 2, MPFR_RNDN);
+        {
+            printf("%*stesting float [0, π∕2] ...\n", indent, "");
+            indent += 4;
+            test_q_and_r_float(&ph_rem_pi_2_float, mp_pi_2, 0x1.0p+23f, INFINITY, 4);
+            indent -= 4;
+        }
+        {
+            printf("%*stesting double [0, π∕2] ...\n", indent, "");
+            indent += 4;
+            test_q_and_r_double(&ph_rem_pi_2_double, mp_pi_2, 0x1.0p+52, INFINITY, 4);
+            indent -= 4;
+        }
+        mpfr_clear(mp_pi_2);
+        return 0;
+    }
+
+    if (argc == 2 && strcmp(argv[1], "quadrant") == 0) {
+        // π∕2
+        mpfr_t mp_pi_2;
+        mpfr_init2(mp_pi_2, mp_precision);
+        mpfr_const_pi(mp_pi_2, MPFR_RNDN);
+        mpfr_div_ui(mp_pi_2, mp_pi_2, 2, MPFR_RNDN);
+        {
+            printf("%*stesting float [0, π∕2] ...\n", indent, "");
+            indent += 4;
+            test_q_and_r_float(&bdl_quadrant_rem_pi_2_float, mp_pi_2, 0.0f, 0x1.0p+20f, 0);
+            indent -= 4;
+        }
+        {
+            printf("%*stesting double [0, π∕2] ...\n", indent, "");
+            indent += 4;
+            test_q_and_r_double(&bdl_quadrant_rem_pi_2_double, mp_pi_2, 0.0, 0x1.0p+48, 0);
+            indent -= 4;
+        }
+        mpfr_clear(mp_pi_2);
+        return 0;
+    }
+
     // π
     mpfr_t mp_pi;
     mpfr_init2(mp_pi, mp_precision);
@@ -300,7 +617,7 @@ main(int argc, char *argv[])
         else
             rem_pi = &bdl_rem_pi_float;
         assert(rem_pi != NULL);
-        test_q_and_r_float(rem_pi, mp_pi);
+        test_q_and_r_float(rem_pi, mp_pi, 0.0f, 0x1.0p+23f, 0);
         indent -= 4;
     }
     {
@@ -314,7 +631,7 @@ main(int argc, char *argv[])
         else
             rem_pi = &bdl_rem_pi_double;
         assert(rem_pi != NULL);
-        test_q_and_r_double(rem_pi, mp_pi);
+        test_q_and_r_double(rem_pi, mp_pi, 0.0, 0x1.0p+52, 0);
         indent -= 4;
     }
 
@@ -333,7 +650,7 @@ main(int argc, char *argv[])
         else
             rem_2pi = &bdl_rem_2pi_float;
         assert(rem_2pi != NULL);
-        test_q_and_r_float(rem_2pi, mp_2pi);
+        test_q_and_r_float(rem_2pi, mp_2pi, 0.0f, 0x1.0p+23f, 0);
         indent -= 4;
     }
     {
@@ -347,7 +664,7 @@ main(int argc, char *argv[])
         else
             rem_2pi = &bdl_rem_2pi_double;
         assert(rem_2pi != NULL);
-        test_q_and_r_double(rem_2pi, mp_2pi);
+        test_q_and_r_double(rem_2pi, mp_2pi, 0.0, 0x1.0p+52, 0);
         indent -= 4;
     }
 
@@ -366,7 +683,7 @@ main(int argc, char *argv[])
         else
             rem_pi_2 = &bdl_rem_pi_2_float;
         assert(rem_pi_2 != NULL);
-        test_q_and_r_float(rem_pi_2, mp_pi_2);
+        test_q_and_r_float(rem_pi_2, mp_pi_2, 0.0f, 0x1.0p+23f, 0);
         indent -= 4;
     }
     {
@@ -380,7 +697,7 @@ main(int argc, char *argv[])
         else
             rem_pi_2 = &bdl_rem_pi_2_double;
         assert(rem_pi_2 != NULL);
-        test_q_and_r_double(rem_pi_2, mp_pi_2);
+        test_q_and_r_double(rem_pi_2, mp_pi_2, 0.0, 0x1.0p+52, 0);
         indent -= 4;
     }
 
@@ -0,0 +1,191 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Test _sin, _cos, _sin_cr, _cos_cr, cw_rem_pi_2 and bdl_rem_pi_2 against
+ * the reference file of gen-reference.c (see reference.h), mapped into
+ * memory, without MPFR:
+ *
+ *     make reference.bin test-reference
+ *     ./test-reference reference.bin
+ *
+ * The errors are in ulp of the correctly rounded result, so 0 ulp means
+ * correctly rounded, and 1 ulp, faithfully rounded.
+ */
+
+#include <assert.h>
+#include <fcntl.h> // open, O_RDONLY
+#include <math.h> // fabs, fabsf
+#include <stddef.h> // size_t, NULL
+#include <stdint.h> // int32_t, int64_t
+#include <stdio.h> // fprintf, printf
+#include <string.h> // memcmp
+#include <sys/mman.h> // mmap, munmap, posix_madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
+
+#include "common.h" // ulp
+#include "harness.h" // harness_count, harness_print_stats, harness_stats
+#include "reduce.h" // bdl_rem_pi_2, cw_rem_pi_2
+#include "reference.h" // magnitudes_double, magnitudes_float
+#include "sincos.h"
+#include "types.h" // rem_result_double, rem_result_float
+
+static int indent = 0;
+
+static void
+test_float(const char *name, float (*function)(float), int cos, const reference_float *records, size_t n, size_t n_per_magnitude)
+{
+    printf("%*stesting float %s ...\n\n", indent, "", name);
+    indent += 4;
+    harness_stats stats = {0};
+    for (size_t i = 0; i < n; i++) {
+        float x = records[i].x;
+        float z = cos ? records[i].cos : records[i].sin;
+        float y = (*function)(x);
+        float abs_error = fabsf(y - z);
+        float rel_error = abs_error / ulp(z);
+        if (rel_error >= 2.0f)
+            fprintf(stderr, "%*s%s(%a) = %a, expected %a\n", indent, "", name, x, y, z);
+        harness_count(&stats, i / n_per_magnitude, abs_error, rel_error);
+    }
+    double magnitudes[N_MAGNITUDES_FLOAT];
+    for (size_t j = 0; j < N_MAGNITUDES_FLOAT; j++)
+        magnitudes[j] = magnitudes_float[j];
+    harness_print_stats(&stats, magnitudes, n / n_per_magnitude, 1, indent);
+    indent -= 4;
+}
+
+static void
+test_double(const char *name, double (*function)(double), int cos, const reference_double *records, size_t n, size_t n_per_magnitude)
+{
+    printf("%*stesting double %s ...\n\n", indent, "", name);
+    indent += 4;
+    harness_stats stats = {0};
+    for (size_t i = 0; i < n; i++) {
+        double x = records[i].x;
+        double z = cos ? records[i].cos : records[i].sin;
+        double y = (*function)(x);
+        double abs_error = fabs(y - z);
+        double rel_error = abs_error / ulp(z);
+        if (rel_error >= 2.0)
+            fprintf(stderr, "%*s%s(%a) = %a, expected %a\n", indent, "", name, x, y, z);
+        harness_count(&stats, i / n_per_magnitude, abs_error, rel_error);
+    }
+    harness_print_stats(&stats, magnitudes_double, n / n_per_magnitude, 1, indent);
+    indent -= 4;
+}
+
+static void
+test_rem_float(const char *name, rem_result_float (*rem_function)(float), const reference_float *records, size_t n, size_t n_per_magnitude)
+{
+    printf("%*stesting float %s ...\n\n", indent, "", name);
+    indent += 4;
+    harness_stats stats = {0};
+    size_t q_mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        float x = records[i].x;
+        rem_result_float rem = (*rem_function)(x);
+        float r = rem.v1 + rem.v2;
+        if (rem.z != records[i].q) {
+            fprintf(stderr, "%*s%s(%a): q = %i, expected %i\n", indent, "", name, x, rem.z, records[i].q);
+            q_mismatches++;
+        }
+        float abs_error = fabsf(r - records[i].r);
+        float rel_error = abs_error / ulp(records[i].r);
+        harness_count(&stats, i / n_per_magnitude, abs_error, rel_error);
+    }
+    printf("%*squotient mismatches: %zu\n\n", indent, "", q_mismatches);
+    double magnitudes[N_MAGNITUDES_FLOAT];
+    for (size_t j = 0; j < N_MAGNITUDES_FLOAT; j++)
+        magnitudes[j] = magnitudes_float[j];
+    harness_print_stats(&stats, magnitudes, n / n_per_magnitude, 1, indent);
+    indent -= 4;
+}
+
+static void
+test_rem_double(const char *name, rem_result_double (*rem_function)(double), const reference_double *records, size_t n, size_t n_per_magnitude)
+{
+    printf("%*stesting double %s ...\n\n", indent, "", name);
+    indent += 4;
+    harness_stats stats = {0};
+    size_t q_mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        double x = records[i].x;
+        rem_result_double rem = (*rem_function)(x);
+        double r = rem.v1 + rem.v2;
+        if (rem.z != records[i].q) {
+            fprintf(stderr, "%*s%s(%a): q = %li, expected %li\n", indent, "", name, x, (long int) rem.z, (long int) records[i].q);
+            q_mismatches++;
+        }
+        double abs_error = fabs(r - records[i].r);
+        double rel_error = abs_error / ulp(records[i].r);
+        harness_count(&stats, i / n_per_magnitude, abs_error, rel_error);
+    }
+    printf("%*squotient mismatches: %zu\n\n", indent, "", q_mismatches);
+    harness_print_stats(&stats, magnitudes_double, n / n_per_magnitude, 1, indent);
+    indent -= 4;
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s file\n", argv[0]);
+        return 1;
+    }
+    int fd = open(argv[1], O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    size_t size = (size_t) st.st_size;
+    const unsigned char *data = NULL;
+    if (size >= sizeof (reference_header))
+        data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == NULL || data == MAP_FAILED) {
+        fprintf(stderr, "%s: cannot map\n", argv[1]);
+        return 1;
+    }
+
+    const reference_header *header = (const reference_header *) data;
+    size_t n_float = header->n_float;
+    size_t n_double = header->n_double;
+    size_t n_per_magnitude = header->n_per_magnitude;
+    size_t offset_float = sizeof (reference_header);
+    size_t offset_double = offset_float + n_float * sizeof (reference_float);
+    if (memcmp(header->magic, REFERENCE_MAGIC, sizeof REFERENCE_MAGIC) != 0
+        || header->version != REFERENCE_VERSION
+        || header->record_size_float != sizeof (reference_float)
+        || header->record_size_double != sizeof (reference_double)
+        || n_float != N_MAGNITUDES_FLOAT * n_per_magnitude
+        || n_double != N_MAGNITUDES_DOUBLE * n_per_magnitude
+        || offset_double % sizeof (double) != 0
+        || size != offset_double + n_double * sizeof (reference_double)) {
+        fprintf(stderr, "%s: not a reference file of this version (make reference.bin)\n", argv[1]);
+        return 1;
+    }
+    const reference_float *records_float = (const reference_float *) (data + offset_float);
+    const reference_double *records_double = (const reference_double *) (data + offset_double);
+    posix_madvise((void *) data, size, POSIX_MADV_SEQUENTIAL);
+
+    test_float("sin", &_sin_float, 0, records_float, n_float, n_per_magnitude);
+    test_float("cos", &_cos_float, 1, records_float, n_float, n_per_magnitude);
+    test_float("sin_cr", &_sin_cr_float, 0, records_float, n_float, n_per_magnitude);
+    test_float("cos_cr", &_cos_cr_float, 1, records_float, n_float, n_per_magnitude);
+    test_double("sin", &_sin_double, 0, records_double, n_double, n_per_magnitude);
+    test_double("cos", &_cos_double, 1, records_double, n_double, n_per_magnitude);
+    test_double("sin_cr", &_sin_cr_double, 0, records_double, n_double, n_per_magnitude);
+    test_double("cos_cr", &_cos_cr_double, 1, records_double, n_double, n_per_magnitude);
+    // The reductions of reduce.h, up to the thresholds of Payne-Hanek.
+    size_t n_cw_float = N_CW_MAGNITUDES_FLOAT * n_per_magnitude;
+    size_t n_cw_double = N_CW_MAGNITUDES_DOUBLE * n_per_magnitude;
+    test_rem_float("cw_rem_pi_2", &cw_rem_pi_2_float, records_float, n_cw_float, n_per_magnitude);
+    test_rem_float("bdl_rem_pi_2", &bdl_rem_pi_2_float, records_float, n_cw_float, n_per_magnitude);
+    test_rem_double("cw_rem_pi_2", &cw_rem_pi_2_double, records_double, n_cw_double, n_per_magnitude);
+    test_rem_double("bdl_rem_pi_2", &bdl_rem_pi_2_double, records_double, n_cw_double, n_per_magnitude);
+
+    munmap((void *) data, size);
+    return 0;
+}
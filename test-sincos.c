@@ -1,208 +1,693 @@
 /* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
 
 #include <assert.h>
-#include <math.h> // M_PI
+#include <errno.h> // errno, EEXIST
+#include <inttypes.h> // PRIx32
+#include <math.h> // M_PI, isfinite, isnan
 #include <stddef.h> // size_t, NULL
-#include <stdlib.h> // calloc, drand48
-#include <stdio.h> // printf
-#include <time.h>
+#include <stdint.h> // uint32_t
+#include <stdlib.h> // calloc, exit, strtoul
+#include <stdio.h> // flockfile, fopen, printf, rename
+#include <string.h> // memcmp, memcpy, strcmp
+#include <sys/stat.h> // mkdir
+#include <unistd.h> // access
 
 #include <mpfr.h>
 
-#include "common.h" // significant_digits, ulp, xtime
+#include "common.h" // significant_digits, ulp
+#include "harness.h"
 #include "sincos.h"
 #include "types.h" // tuple_double
 
-static const mpfr_prec_t mp_precision = 128;
-
 static int indent = 0;
 
-// The size of the precision test array.
+// The size of the precision test.
 static const size_t n = 10000000;
 
+// The size of the chunks of the test (harness.h).
+static const size_t chunk_size = 1 << 16;
+
+typedef int (*mpfr_function_t)(mpfr_t rop, const mpfr_t op, mpfr_rnd_t rnd);
+
+typedef struct {
+    const char *function_name;
+    float (*function)(float);
+    mpfr_function_t mpfr_function;
+} test_float_context;
+
+static void
+test_float_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    const test_float_context *test = context;
+    harness_mp *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+
+    tuple_float D = {-2.0 * M_PI, 2.0 * M_PI}; // test domain
+    // D = (tuple_float) {-0x1.0p23, 0x1.0p23};
+    for (size_t i = chunk * chunk_size; i < n && i < (chunk + 1) * chunk_size; i++) {
+        float x = harness_uniform(&g) * (D.b - D.a) + D.a;
+        float y = (*test->function)(x);
+
+        mpfr_set_flt(mp->x, x, MPFR_RNDN);
+        (*test->mpfr_function)(mp->result, mp->x, MPFR_RNDN);
+        float z = mpfr_get_flt(mp->result, MPFR_RNDN);
+
+        // error = |mpfr_function(x) - function(x)|
+        mpfr_sub_d(mp->error, mp->result, y, MPFR_RNDN);
+        mpfr_abs(mp->error, mp->error, MPFR_RNDN);
+        float abs_error = mpfr_get_flt(mp->error, MPFR_RNDN);
+        float rel_error = abs_error / ulp(z);
+        if (rel_error >= 1.0f) {
+            int N = significant_digits(z);
+            const char *function_name = test->function_name;
+            flockfile(stderr);
+            fprintf(stderr, "%*sx = %+.*f\n", indent, "", 20, x);
+            fprintf(stderr, "%*s    expected %s(x) = %+.*f\n", indent, "", function_name, N, z);
+            fprintf(stderr, "%*s         got %s(x) = %+.*f\n", indent, "", function_name, N, y);
+            fprintf(stderr, "%*s              error = %+.*f = %e\n", indent, "", N, abs_error, abs_error);
+            fprintf(stderr, "%*s        ulp(%s(x)) = %+.*f = %e\n", indent, "", function_name, N, ulp(z), ulp(z));
+            fprintf(stderr, "\n");
+            funlockfile(stderr);
+        }
+        harness_count(stats, 0, abs_error, rel_error);
+    }
+}
+
 static void
 test_float(
     const char *function_name,
     float (*function)(float),
-    int (*mpfr_function)(mpfr_t rop, const mpfr_t op, mpfr_rnd_t rnd)
+    mpfr_function_t mpfr_function
 ) {
     printf("testing float %s ...\n\n", function_name);
     indent += 4;
 
-    float *xs = calloc(n, sizeof (float)); // array of input values x
-    float *ys = calloc(n, sizeof (float)); // array of function(x)
-    float *zs = calloc(n, sizeof (float)); // array of function(x) using mpfr
-    assert(xs != NULL);
-    assert(ys != NULL);
-    assert(zs != NULL);
+    test_float_context context = {function_name, function, mpfr_function};
+    harness_job job = {
+        .context = &context,
+        .n_chunks = harness_chunks(n, chunk_size),
+        .local_size = sizeof (harness_mp),
+        .init = &harness_mp_init,
+        .clear = &harness_mp_clear,
+        .chunk = &test_float_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
 
-    srand48(time(NULL));
+    assert(harness_total(&stats) == n);
+    harness_print_distribution(&stats, indent);
 
-    tuple_float D; // test domain
-    D = (tuple_float) {-2.0 * M_PI, 2.0 * M_PI};
-    for (size_t i = 0; i < n / 2; i++) xs[i] = drand48() * (D.b - D.a) + D.a;
-    // D = (tuple_float) {-0x1.0p23, 0x1.0p23};
-    for (size_t i = n / 2; i < n; i++) xs[i] = drand48() * (D.b - D.a) + D.a;
-
-    for (size_t i = 0; i < n; i++)
-        ys[i] = (*function)(xs[i]);
-
-    mpfr_t mp_x;
-    mpfr_t mp_result;
-    mpfr_t mp_error;
-    mpfr_init2(mp_x, mp_precision);
-    mpfr_init2(mp_result, mp_precision);
-    mpfr_init2(mp_error, mp_precision);
-    float max_abs_error = 0.0;
-    float max_rel_error = 0.0;
-    int error_dist[4] = {0};
-    for (size_t i = 0; i < n; i++) {
-        mpfr_set_flt(mp_x, xs[i], MPFR_RNDN);
-        (*mpfr_function)(mp_result, mp_x, MPFR_RNDN);
-        zs[i] = mpfr_get_flt(mp_result, MPFR_RNDN);
+    indent -= 4;
+}
+
+typedef struct {
+    const char *function_name;
+    double (*function)(double);
+    mpfr_function_t mpfr_function;
+} test_double_context;
+
+static void
+test_double_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    const test_double_context *test = context;
+    harness_mp *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+
+    tuple_double D = {-2.0 * M_PI, 2.0 * M_PI}; // test domain
+    // D = (tuple_double) {-0x1.0p52, 0x1.0p52};
+    for (size_t i = chunk * chunk_size; i < n && i < (chunk + 1) * chunk_size; i++) {
+        double x = harness_uniform(&g) * (D.b - D.a) + D.a;
+        double y = (*test->function)(x);
+
+        mpfr_set_d(mp->x, x, MPFR_RNDN);
+        (*test->mpfr_function)(mp->result, mp->x, MPFR_RNDN);
+        double z = mpfr_get_d(mp->result, MPFR_RNDN);
 
         // error = |mpfr_function(x) - function(x)|
-        mpfr_sub_d(mp_error, mp_result, ys[i], MPFR_RNDN);
-        mpfr_abs(mp_error, mp_error, MPFR_RNDN);
-        float abs_error = mpfr_get_flt(mp_error, MPFR_RNDN);
-        float rel_error = abs_error / ulp(zs[i]);
-        if (rel_error >= 1.0f) {
-            int N = significant_digits(zs[i]);
-            fprintf(stderr, "%*sx = %+.*f\n", indent, "", 20, xs[i]);
-            fprintf(stderr, "%*s    expected %s(x) = %+.*f\n", indent, "", function_name, N, zs[i]);
-            fprintf(stderr, "%*s         got %s(x) = %+.*f\n", indent, "", function_name, N, ys[i]);
+        mpfr_sub_d(mp->error, mp->result, y, MPFR_RNDN);
+        mpfr_abs(mp->error, mp->error, MPFR_RNDN);
+        double abs_error = mpfr_get_d(mp->error, MPFR_RNDN);
+        double rel_error = abs_error / ulp(z);
+        if (rel_error >= 1.0) {
+            int N = significant_digits(z);
+            const char *function_name = test->function_name;
+            flockfile(stderr);
+            fprintf(stderr, "%*sx = %+.*f\n", indent, "", 20, x);
+            fprintf(stderr, "%*s    expected %s(x) = %+.*f\n", indent, "", function_name, N, z);
+            fprintf(stderr, "%*s         got %s(x) = %+.*f\n", indent, "", function_name, N, y);
             fprintf(stderr, "%*s              error = %+.*f = %e\n", indent, "", N, abs_error, abs_error);
-            fprintf(stderr, "%*s        ulp(%s(x)) = %+.*f = %e\n", indent, "", function_name, N, ulp(zs[i]), ulp(zs[i]));
+            fprintf(stderr, "%*s        ulp(%s(x)) = %+.*f = %e\n", indent, "", function_name, N, ulp(z), ulp(z));
             fprintf(stderr, "\n");
+            funlockfile(stderr);
         }
-        if (rel_error >= 3.0f)
-            error_dist[3]++;
-        else if (rel_error >= 2.0f)
-            error_dist[2]++;
-        else if (rel_error >= 1.0f)
-            error_dist[1]++;
-        else
-            error_dist[0]++;
-        if (abs_error > max_abs_error)
-            max_abs_error = abs_error;
-        if (rel_error > max_rel_error)
-            max_rel_error = rel_error;
+        harness_count(stats, 0, abs_error, rel_error);
     }
-    assert(error_dist[0] + error_dist[1] + error_dist[2] + error_dist[3] == n);
-    printf("%*serror distribution:\n", indent, "");
-    printf("%*s 0 ulp %i (%.2f%%)\n", indent, "", error_dist[0], (float) error_dist[0] / n * 100.0f);
-    printf("%*s 1 ulp %i (%.2f%%)\n", indent, "", error_dist[1], (float) error_dist[1] / n * 100.0f);
-    printf("%*s 2 ulp %i (%.2f%%)\n", indent, "", error_dist[2], (float) error_dist[2] / n * 100.0f);
-    printf("%*s≥3 ulp %i (%.2f%%)\n", indent, "", error_dist[3], (float) error_dist[3] / n * 100.0f);
-    printf("\n");
-
-    mpfr_clear(mp_error);
-    mpfr_clear(mp_result);
-    mpfr_clear(mp_x);
-
-    free(xs);
-    free(ys);
-    free(zs);
-
-    indent -= 4;
 }
 
 static void
 test_double(
     const char *function_name,
     double (*function)(double),
-    int (*mpfr_function)(mpfr_t rop, const mpfr_t op, mpfr_rnd_t rnd)
+    mpfr_function_t mpfr_function
 ) {
     printf("testing double %s ...\n\n", function_name);
     indent += 4;
 
-    double *xs = calloc(n, sizeof (double)); // array of input values x
-    double *ys = calloc(n, sizeof (double)); // array of function(x)
-    double *zs = calloc(n, sizeof (double)); // array of function(x) using mpfr
-    assert(xs != NULL);
-    assert(ys != NULL);
-    assert(zs != NULL);
+    test_double_context context = {function_name, function, mpfr_function};
+    harness_job job = {
+        .context = &context,
+        .n_chunks = harness_chunks(n, chunk_size),
+        .local_size = sizeof (harness_mp),
+        .init = &harness_mp_init,
+        .clear = &harness_mp_clear,
+        .chunk = &test_double_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
 
-    srand48(time(NULL));
+    assert(harness_total(&stats) == n);
+    harness_print_distribution(&stats, indent);
 
-    tuple_double D; // test domain
-    D = (tuple_double) {-2.0 * M_PI, 2.0 * M_PI};
-    for (size_t i = 0; i < n / 2; i++) xs[i] = drand48() * (D.b - D.a) + D.a;
-    // D = (tuple_double) {-0x1.0p52, 0x1.0p52};
-    for (size_t i = n / 2; i < n; i++) xs[i] = drand48() * (D.b - D.a) + D.a;
-
-    for (size_t i = 0; i < n; i++)
-        ys[i] = (*function)(xs[i]);
-
-    mpfr_t mp_x;
-    mpfr_t mp_result;
-    mpfr_t mp_error;
-    mpfr_init2(mp_x, mp_precision);
-    mpfr_init2(mp_result, mp_precision);
-    mpfr_init2(mp_error, mp_precision);
-    double max_abs_error = 0.0;
-    double max_rel_error = 0.0;
-    int error_dist[4] = {0};
-    for (size_t i = 0; i < n; i++) {
-        mpfr_set_d(mp_x, xs[i], MPFR_RNDN);
-        (*mpfr_function)(mp_result, mp_x, MPFR_RNDN);
-        zs[i] = mpfr_get_d(mp_result, MPFR_RNDN);
+    indent -= 4;
+}
 
-        // error = |mpfr_function(x) - function(x)|
-        mpfr_sub_d(mp_error, mp_result, ys[i], MPFR_RNDN);
-        mpfr_abs(mp_error, mp_error, MPFR_RNDN);
-        double abs_error = mpfr_get_d(mp_error, MPFR_RNDN);
-        double rel_error = abs_error / ulp(zs[i]);
-        if (rel_error >= 1.0) {
-            int N = significant_digits(zs[i]);
-            fprintf(stderr, "%*sx = %+.*f\n", indent, "", 20, xs[i]);
-            fprintf(stderr, "%*s    expected %s(x) = %+.*f\n", indent, "", function_name, N, zs[i]);
-            fprintf(stderr, "%*s         got %s(x) = %+.*f\n", indent, "", function_name, N, ys[i]);
-            fprintf(stderr, "%*s              error = %+.*f = %e\n", indent, "", N, abs_error, abs_error);
-            fprintf(stderr, "%*s        ulp(%s(x)) = %+.*f = %e\n", indent, "", function_name, N, ulp(zs[i]), ulp(zs[i]));
-            fprintf(stderr, "\n");
-        }
-        if (rel_error >= 3.0)
-            error_dist[3]++;
-        else if (rel_error >= 2.0)
-            error_dist[2]++;
-        else if (rel_error >= 1.0)
-            error_dist[1]++;
-        else
-            error_dist[0]++;
-        if (abs_error > max_abs_error)
-            max_abs_error = abs_error;
-        if (rel_error > max_rel_error)
-            max_rel_error = rel_error;
+/*
+ * Test each result of sincos as a function of one argument.
+ */
+
+static float
+_sincos_sin_float(float x)
+{
+    float s, c;
+    _sincos_float(x, &s, &c);
+    return s;
+}
+
+static float
+_sincos_cos_float(float x)
+{
+    float s, c;
+    _sincos_float(x, &s, &c);
+    return c;
+}
+
+static double
+_sincos_sin_double(double x)
+{
+    double s, c;
+    _sincos_double(x, &s, &c);
+    return s;
+}
+
+static double
+_sincos_cos_double(double x)
+{
+    double s, c;
+    _sincos_double(x, &s, &c);
+    return c;
+}
+
+/*
+ * MPFR computes sin and cos in degrees as sin and cos of x∕360 of a turn.
+ */
+
+static int
+mpfr_sind(mpfr_t rop, const mpfr_t op, mpfr_rnd_t rnd)
+{
+    return mpfr_sinu(rop, op, 360, rnd);
+}
+
+static int
+mpfr_cosd(mpfr_t rop, const mpfr_t op, mpfr_rnd_t rnd)
+{
+    return mpfr_cosu(rop, op, 360, rnd);
+}
+
+/*
+ * Test that the array functions (which may use the vector kernels of
+ * sincos-simd.h) agree bit for bit with the scalar functions, on random
+ * magnitudes and special values, with a length that is not a multiple
+ * of the vector width.
+ */
+
+static const double special_values[] = {
+    0.0, -0.0, 0x1.0p-1074, 0x1.0p-149, 0x1.0p-30, 1.0,
+    0x1.921fb54442d18p0, 0x1.921fb6p0, 0x1.921fb54442d18p1, 0x1.0p23,
+    0x1.0p52, 0x1.0p60, 0x1.fffffffffffffp1023, INFINITY, NAN,
+};
+
+static const size_t n_special_values = sizeof special_values / sizeof special_values[0];
+
+/*
+ * The buffers of a thread, and its mismatches, added to the totals of
+ * the test at the end.
+ */
+
+typedef struct {
+    size_t *mismatches; // of sin, cos and sincos
+} array_context;
+
+typedef struct {
+    size_t *mismatches;
+    float *xs; // array of input values x
+    float *ss; // array of sin(x), scalar
+    float *cs; // array of cos(x), scalar
+    float *ys; // array of sin(x), array function
+    float *zs; // array of cos(x), array function
+    size_t local_mismatches[3];
+} array_float_local;
+
+static void
+array_float_init(const void *context, void *local)
+{
+    const array_context *test = context;
+    array_float_local *a = local;
+    a->mismatches = test->mismatches;
+    a->xs = calloc(chunk_size, sizeof (float));
+    a->ss = calloc(chunk_size, sizeof (float));
+    a->cs = calloc(chunk_size, sizeof (float));
+    a->ys = calloc(chunk_size, sizeof (float));
+    a->zs = calloc(chunk_size, sizeof (float));
+    assert(a->xs != NULL && a->ss != NULL && a->cs != NULL);
+    assert(a->ys != NULL && a->zs != NULL);
+}
+
+static void
+array_float_clear(void *local)
+{
+    array_float_local *a = local;
+    for (size_t k = 0; k < 3; k++)
+        __atomic_fetch_add(&a->mismatches[k], a->local_mismatches[k], __ATOMIC_RELAXED);
+    free(a->zs);
+    free(a->ys);
+    free(a->cs);
+    free(a->ss);
+    free(a->xs);
+}
+
+static void
+array_float_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    (void) context;
+    (void) stats;
+    array_float_local *a = local;
+    harness_random g = harness_chunk_random(chunk);
+
+    const size_t m = n + 3;
+    size_t first = chunk * chunk_size;
+    size_t k = m - first < chunk_size ? m - first : chunk_size;
+    for (size_t i = 0; i < k; i++) {
+        double x = ldexp(harness_uniform(&g), (int) (harness_uniform(&g) * 96.0) - 32);
+        if (harness_uniform(&g) < 0.01)
+            x = special_values[(first + i) % n_special_values];
+        a->xs[i] = (float) (harness_uniform(&g) < 0.5 ? -x : x);
+    }
+
+    for (size_t i = 0; i < k; i++) {
+        a->ss[i] = _sin_float(a->xs[i]);
+        a->cs[i] = _cos_float(a->xs[i]);
     }
-    assert(error_dist[0] + error_dist[1] + error_dist[2] + error_dist[3] == n);
-    printf("%*serror distribution:\n", indent, "");
-    printf("%*s 0 ulp %i (%.2f%%)\n", indent, "", error_dist[0], (double) error_dist[0] / n * 100.0);
-    printf("%*s 1 ulp %i (%.2f%%)\n", indent, "", error_dist[1], (double) error_dist[1] / n * 100.0);
-    printf("%*s 2 ulp %i (%.2f%%)\n", indent, "", error_dist[2], (double) error_dist[2] / n * 100.0);
-    printf("%*s≥3 ulp %i (%.2f%%)\n", indent, "", error_dist[3], (double) error_dist[3] / n * 100.0);
+
+    _sin_array(a->xs, a->ys, k);
+    _cos_array(a->xs, a->zs, k);
+    for (size_t i = 0; i < k; i++) {
+        a->local_mismatches[0] += memcmp(&a->ys[i], &a->ss[i], sizeof (float)) != 0;
+        a->local_mismatches[1] += memcmp(&a->zs[i], &a->cs[i], sizeof (float)) != 0;
+    }
+    _sincos_array(a->xs, a->ys, a->zs, k);
+    for (size_t i = 0; i < k; i++)
+        a->local_mismatches[2] += memcmp(&a->ys[i], &a->ss[i], sizeof (float)) != 0
+            || memcmp(&a->zs[i], &a->cs[i], sizeof (float)) != 0;
+}
+
+static void
+test_array_float(void)
+{
+    printf("testing float arrays ...\n\n");
+    indent += 4;
+
+    const size_t m = n + 3;
+    size_t mismatches[3] = {0};
+    array_context context = {mismatches};
+    harness_job job = {
+        .context = &context,
+        .n_chunks = harness_chunks(m, chunk_size),
+        .local_size = sizeof (array_float_local),
+        .init = &array_float_init,
+        .clear = &array_float_clear,
+        .chunk = &array_float_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
+
+    printf("%*smismatches:\n", indent, "");
+    printf("%*s       sin %zu\n", indent, "", mismatches[0]);
+    printf("%*s       cos %zu\n", indent, "", mismatches[1]);
+    printf("%*s    sincos %zu\n", indent, "", mismatches[2]);
     printf("\n");
 
-    mpfr_clear(mp_error);
-    mpfr_clear(mp_result);
-    mpfr_clear(mp_x);
+    indent -= 4;
+}
+
+typedef struct {
+    size_t *mismatches;
+    double *xs; // array of input values x
+    double *ss; // array of sin(x), scalar
+    double *cs; // array of cos(x), scalar
+    double *ys; // array of sin(x), array function
+    double *zs; // array of cos(x), array function
+    size_t local_mismatches[3];
+} array_double_local;
+
+static void
+array_double_init(const void *context, void *local)
+{
+    const array_context *test = context;
+    array_double_local *a = local;
+    a->mismatches = test->mismatches;
+    a->xs = calloc(chunk_size, sizeof (double));
+    a->ss = calloc(chunk_size, sizeof (double));
+    a->cs = calloc(chunk_size, sizeof (double));
+    a->ys = calloc(chunk_size, sizeof (double));
+    a->zs = calloc(chunk_size, sizeof (double));
+    assert(a->xs != NULL && a->ss != NULL && a->cs != NULL);
+    assert(a->ys != NULL && a->zs != NULL);
+}
+
+static void
+array_double_clear(void *local)
+{
+    array_double_local *a = local;
+    for (size_t k = 0; k < 3; k++)
+        __atomic_fetch_add(&a->mismatches[k], a->local_mismatches[k], __ATOMIC_RELAXED);
+    free(a->zs);
+    free(a->ys);
+    free(a->cs);
+    free(a->ss);
+    free(a->xs);
+}
+
+static void
+array_double_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    (void) context;
+    (void) stats;
+    array_double_local *a = local;
+    harness_random g = harness_chunk_random(chunk);
+
+    const size_t m = n + 3;
+    size_t first = chunk * chunk_size;
+    size_t k = m - first < chunk_size ? m - first : chunk_size;
+    for (size_t i = 0; i < k; i++) {
+        double x = ldexp(harness_uniform(&g), (int) (harness_uniform(&g) * 96.0) - 32);
+        if (harness_uniform(&g) < 0.01)
+            x = special_values[(first + i) % n_special_values];
+        a->xs[i] = (double) (harness_uniform(&g) < 0.5 ? -x : x);
+    }
+
+    for (size_t i = 0; i < k; i++) {
+        a->ss[i] = _sin_double(a->xs[i]);
+        a->cs[i] = _cos_double(a->xs[i]);
+    }
+
+    _sin_array(a->xs, a->ys, k);
+    _cos_array(a->xs, a->zs, k);
+    for (size_t i = 0; i < k; i++) {
+        a->local_mismatches[0] += memcmp(&a->ys[i], &a->ss[i], sizeof (double)) != 0;
+        a->local_mismatches[1] += memcmp(&a->zs[i], &a->cs[i], sizeof (double)) != 0;
+    }
+    _sincos_array(a->xs, a->ys, a->zs, k);
+    for (size_t i = 0; i < k; i++)
+        a->local_mismatches[2] += memcmp(&a->ys[i], &a->ss[i], sizeof (double)) != 0
+            || memcmp(&a->zs[i], &a->cs[i], sizeof (double)) != 0;
+}
+
+static void
+test_array_double(void)
+{
+    printf("testing double arrays ...\n\n");
+    indent += 4;
 
-    free(xs);
-    free(ys);
-    free(zs);
+    const size_t m = n + 3;
+    size_t mismatches[3] = {0};
+    array_context context = {mismatches};
+    harness_job job = {
+        .context = &context,
+        .n_chunks = harness_chunks(m, chunk_size),
+        .local_size = sizeof (array_double_local),
+        .init = &array_double_init,
+        .clear = &array_double_clear,
+        .chunk = &array_double_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
+
+    printf("%*smismatches:\n", indent, "");
+    printf("%*s       sin %zu\n", indent, "", mismatches[0]);
+    printf("%*s       cos %zu\n", indent, "", mismatches[1]);
+    printf("%*s    sincos %zu\n", indent, "", mismatches[2]);
+    printf("\n");
 
     indent -= 4;
 }
 
+/*
+ * Test _sin_float, _cos_float, _sin_cr_float and _cos_cr_float on every
+ * float, in chunks of 2²⁰ bit patterns (4096 chunks), with a checkpoint
+ * file for each chunk:
+ *
+ *     ./test-sincos exhaustive DIRECTORY [FIRST LAST]
+ *
+ * A chunk whose file exists in the directory is not run again, so that
+ * an interrupted run resumes where it stopped; FIRST and LAST limit the
+ * run to a range of chunks. Each file holds, for each function, the
+ * error distribution, the maximum error in ulp and its argument, and
+ * the arguments with an error of one ulp or more (or not NaN for an
+ * infinity or a NaN), all of which are reported at the end.
+ */
+
+#define EXHAUSTIVE_CHUNK_BITS 20
+#define EXHAUSTIVE_N_CHUNKS (((size_t) 1) << (32 - EXHAUSTIVE_CHUNK_BITS))
+
+static const struct {
+    const char *name;
+    float (*function)(float);
+    mpfr_function_t mpfr_function;
+} exhaustive_functions[] = {
+    {"sin", &_sin_float, &mpfr_sin},
+    {"cos", &_cos_float, &mpfr_cos},
+    {"sin_cr", &_sin_cr_float, &mpfr_sin},
+    {"cos_cr", &_cos_cr_float, &mpfr_cos},
+};
+
+#define EXHAUSTIVE_N_FUNCTIONS (sizeof exhaustive_functions / sizeof exhaustive_functions[0])
+
+typedef struct {
+    const char *directory;
+    size_t first; // the first chunk
+} exhaustive_context;
+
+static void
+exhaustive_path(char *path, size_t size, const char *directory, size_t chunk)
+{
+    int k = snprintf(path, size, "%s/chunk-%04zx.txt", directory, chunk);
+    assert(k > 0 && (size_t) k < size);
+    (void) k;
+}
+
+static float
+bits_float(uint32_t u)
+{
+    float x;
+    memcpy(&x, &u, sizeof x);
+    return x;
+}
+
+static void
+exhaustive_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    (void) stats;
+    const exhaustive_context *test = context;
+    harness_mp *mp = local;
+    chunk += test->first;
+
+    char path[4096];
+    char temporary[4096 + 4];
+    exhaustive_path(path, sizeof path, test->directory, chunk);
+    if (access(path, F_OK) == 0)
+        return; // done
+    int k = snprintf(temporary, sizeof temporary, "%s.tmp", path);
+    assert(k > 0 && (size_t) k < sizeof temporary);
+    (void) k;
+    FILE *f = fopen(temporary, "w");
+    if (f == NULL) {
+        perror(temporary);
+        exit(1);
+    }
+
+    uint32_t first = (uint32_t) chunk << EXHAUSTIVE_CHUNK_BITS;
+    uint32_t last = first + ((uint32_t) 1 << EXHAUSTIVE_CHUNK_BITS) - 1;
+    for (size_t j = 0; j < EXHAUSTIVE_N_FUNCTIONS; j++) {
+        harness_stats counts = {0};
+        float max_rel_error = 0.0f;
+        uint32_t argmax = first;
+        for (uint32_t u = first; ; u++) {
+            float x = bits_float(u);
+            float y = (*exhaustive_functions[j].function)(x);
+            float abs_error = 0.0f;
+            float rel_error = 0.0f;
+            if (!isfinite(x)) {
+                rel_error = isnan(y) ? 0.0f : INFINITY;
+            } else {
+                mpfr_set_flt(mp->x, x, MPFR_RNDN);
+                (*exhaustive_functions[j].mpfr_function)(mp->result, mp->x, MPFR_RNDN);
+                float z = mpfr_get_flt(mp->result, MPFR_RNDN);
+                mpfr_sub_d(mp->error, mp->result, y, MPFR_RNDN);
+                mpfr_abs(mp->error, mp->error, MPFR_RNDN);
+                abs_error = mpfr_get_flt(mp->error, MPFR_RNDN);
+                rel_error = isnan(y) ? INFINITY : abs_error / ulp(z);
+            }
+            if (rel_error >= 1.0f)
+                fprintf(f, "fail %s 0x%08" PRIx32 " %a\n", exhaustive_functions[j].name, u, rel_error);
+            harness_count(&counts, 0, abs_error, rel_error);
+            if (rel_error > max_rel_error) {
+                max_rel_error = rel_error;
+                argmax = u;
+            }
+            if (u == last)
+                break;
+        }
+        fprintf(
+            f, "%s %zu %zu %zu %zu %a 0x%08" PRIx32 "\n",
+            exhaustive_functions[j].name,
+            counts.error_dist[0], counts.error_dist[1], counts.error_dist[2], counts.error_dist[3],
+            max_rel_error, argmax
+        );
+    }
+
+    if (fclose(f) != 0 || rename(temporary, path) != 0) {
+        perror(path);
+        exit(1);
+    }
+}
+
+static int
+test_exhaustive(const char *directory, size_t first, size_t last)
+{
+    if (mkdir(directory, 0777) != 0 && errno != EEXIST) {
+        perror(directory);
+        return 1;
+    }
+    assert(first <= last && last < EXHAUSTIVE_N_CHUNKS);
+
+    exhaustive_context context = {directory, first};
+    harness_job job = {
+        .context = &context,
+        .n_chunks = last - first + 1,
+        .local_size = sizeof (harness_mp),
+        .init = &harness_mp_init,
+        .clear = &harness_mp_clear,
+        .chunk = &exhaustive_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
+
+    for (size_t j = 0; j < EXHAUSTIVE_N_FUNCTIONS; j++) {
+        const char *name = exhaustive_functions[j].name;
+        printf("testing float %s, chunks %zu to %zu of %zu ...\n\n", name, first, last, EXHAUSTIVE_N_CHUNKS - 1);
+        indent += 4;
+        harness_stats counts = {0};
+        float max_rel_error = 0.0f;
+        uint32_t argmax = (uint32_t) first << EXHAUSTIVE_CHUNK_BITS;
+        size_t n_failures = 0;
+        for (int pass = 0; pass < 2; pass++) {
+            if (pass == 1 && n_failures > 0)
+                printf("%*sfailures:\n", indent, "");
+            for (size_t chunk = first; chunk <= last; chunk++) {
+                char path[4096];
+                exhaustive_path(path, sizeof path, directory, chunk);
+                FILE *f = fopen(path, "r");
+                if (f == NULL) {
+                    perror(path);
+                    return 1;
+                }
+                char line[256];
+                while (fgets(line, sizeof line, f) != NULL) {
+                    char function[16];
+                    unsigned int u = 0;
+                    float e = 0.0f;
+                    size_t d[4] = {0};
+                    if (sscanf(line, "fail %15s %x %a", function, &u, &e) == 3) {
+                        if (strcmp(function, name) != 0)
+                            continue;
+                        if (pass == 1)
+                            printf("%*s    x = %+a (0x%08x) %10.3f ulp\n", indent, "", bits_float(u), u, e);
+                        else
+                            n_failures++;
+                    } else if (pass == 0 && sscanf(line, "%15s %zu %zu %zu %zu %a %x", function, &d[0], &d[1], &d[2], &d[3], &e, &u) == 7) {
+                        if (strcmp(function, name) != 0)
+                            continue;
+                        for (size_t i = 0; i < 4; i++)
+                            counts.error_dist[i] += d[i];
+                        if (e > max_rel_error) {
+                            max_rel_error = e;
+                            argmax = u;
+                        }
+                    }
+                }
+                fclose(f);
+            }
+        }
+        if (n_failures > 0)
+            printf("\n");
+        assert(harness_total(&counts) == (last - first + 1) << EXHAUSTIVE_CHUNK_BITS);
+        harness_print_distribution(&counts, indent);
+        printf("%*smaximum error: %.3f ulp at x = %+a (0x%08" PRIx32 ")\n", indent, "",
+            max_rel_error, bits_float(argmax), argmax);
+        printf("%*sfailures: %zu\n", indent, "", n_failures);
+        printf("\n");
+        indent -= 4;
+    }
+    return 0;
+}
+
 int
-main(void)
+main(int argc, char *argv[])
 {
+    if (argc >= 3 && strcmp(argv[1], "exhaustive") == 0) {
+        size_t first = 0;
+        size_t last = EXHAUSTIVE_N_CHUNKS - 1;
+        if (argc == 5) {
+            first = strtoul(argv[3], NULL, 0);
+            last = strtoul(argv[4], NULL, 0);
+        }
+        if (first > last || last >= EXHAUSTIVE_N_CHUNKS) {
+            fprintf(stderr, "chunks: 0 to %zu\n", EXHAUSTIVE_N_CHUNKS - 1);
+            return 1;
+        }
+        return test_exhaustive(argv[2], first, last);
+    }
+
     // test_float("libm sinf", &sinf, &mpfr_sin);
     // test_float("libm cosf", &cosf, &mpfr_cos);
     test_float("sin", &_sin_float, &mpfr_sin);
     test_float("cos", &_cos_float, &mpfr_cos);
     test_double("sin", &_sin_double, &mpfr_sin);
     test_double("cos", &_cos_double, &mpfr_cos);
+    test_float("sincos (sin)", &_sincos_sin_float, &mpfr_sin);
+    test_float("sincos (cos)", &_sincos_cos_float, &mpfr_cos);
+    test_double("sincos (sin)", &_sincos_sin_double, &mpfr_sin);
+    test_double("sincos (cos)", &_sincos_cos_double, &mpfr_cos);
+    test_float("sinpi", &_sinpi_float, &mpfr_sinpi);
+    test_float("cospi", &_cospi_float, &mpfr_cospi);
+    test_double("sinpi", &_sinpi_double, &mpfr_sinpi);
+    test_double("cospi", &_cospi_double, &mpfr_cospi);
+    test_float("sind", &_sind_float, &mpfr_sind);
+    test_float("cosd", &_cosd_float, &mpfr_cosd);
+    test_double("sind", &_sind_double, &mpfr_sind);
+    test_double("cosd", &_cosd_double, &mpfr_cosd);
+    test_array_float();
+    test_array_double();
     printf("\n");
     return 0;
 }
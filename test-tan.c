@@ -0,0 +1,270 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Test _tan against MPFR, by magnitude of the argument, and near the
+ * poles (k + ½)π, where tan(x) = -1∕tan(x - (k + ½)π) is large, and its
+ * accuracy depends on the accuracy of the reduced argument, up to the
+ * arguments nearest to the poles, beyond the range of (k + ½)π; and test
+ * that _tan_array agrees bit for bit with _tan.
+ */
+
+#include <assert.h>
+#include <math.h> // INFINITY, NAN, M_PI, nextafter, nextafterf
+#include <stddef.h> // size_t
+#include <stdio.h> // flockfile, printf
+
+#include <mpfr.h>
+
+#include "common.h" // ulp
+#include "harness.h"
+#include "magnitudes.h"
+#include "sincos.h"
+
+static int indent = 0;
+
+// The size of the test, per magnitude.
+static const size_t n = 1000000;
+
+// The size of the chunks of the test (harness.h).
+static const size_t chunk_size = 1 << 14;
+
+/*
+ * The arguments nearest to the poles, in the range of Payne-Hanek, found
+ * with the continued fractions of 2ᵉ⋅2∕π (as in test-reduce.c): x - (k + ½)π
+ * is as small as 2⁻²⁹ (float) and 2⁻⁶⁰·⁹ (double), and tan(x) as large as
+ * 2²⁹ and 2⁶⁰·⁹.
+ */
+
+static const double hard_cases_float[] = {
+    0x1.f37c8ap+95, 0x1.47d0fep+34, 0x1.32ede2p+85, 0x1.628d4cp+40,
+    0x1.130930p+76, 0x1.b08c4ap+111,
+};
+
+static const double hard_cases_double[] = {
+    0x1.6ac5b262ca1ffp+849, 0x1.504cac51f1eafp+131, 0x1.e009c53148be1p+991,
+    0x1.4c96c11134d36p+577, 0x1.cfe482285f8edp+860, 0x1.db41f3cb71d7bp+680,
+    0x1.e7e44a78ac18cp+197, 0x1.c45cd11154dfdp+295, 0x1.83009e2e9e2ebp+614,
+    0x1.b2196364d750bp+253, 0x1.69eab0985179bp+246, 0x1.782b7a20df6d4p+67,
+};
+
+#define N_HARD_CASES_FLOAT (sizeof hard_cases_float / sizeof hard_cases_float[0])
+#define N_HARD_CASES_DOUBLE (sizeof hard_cases_double / sizeof hard_cases_double[0])
+
+/*
+ * With poles, each magnitude m is that of k, for x the nearest float to
+ * (k + ½)π, moved by up to 8 ulp, up to 2²³ and 2⁵² (magnitudes.h): beyond,
+ * (k + ½)π is no longer within a few ulp of a pole; then the hard cases,
+ * x and -x, in a chunk of their own.
+ */
+
+typedef struct {
+    const double *magnitudes;
+    size_t n_magnitudes;
+    int poles;
+    const double *hard_cases;
+    size_t n_hard_cases;
+} test_context;
+
+static void
+test_float_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    const test_context *test = context;
+    harness_mp *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+    size_t j = chunk / harness_chunks(n, chunk_size);
+    size_t first = (chunk % harness_chunks(n, chunk_size)) * chunk_size;
+    double m = test->magnitudes[j < test->n_magnitudes ? j : 0];
+    size_t last = j < test->n_magnitudes ? n : 2 * test->n_hard_cases;
+    for (size_t i = first; i < last && i < first + chunk_size; i++) {
+        float x = (float) ((harness_uniform(&g) - 0.5) * 2.0 * m);
+        if (test->poles) {
+            double k = floor(harness_uniform(&g) * m);
+            x = (float) ((k + 0.5) * M_PI);
+            for (int d = (int) (harness_next(&g) % 17) - 8; d != 0; d += d < 0 ? 1 : -1)
+                x = nextafterf(x, d < 0 ? 0.0f : INFINITY);
+        }
+        if (j == test->n_magnitudes)
+            x = (float) (i % 2 == 0 ? test->hard_cases[i / 2] : -test->hard_cases[i / 2]);
+        float y = _tan(x);
+
+        mpfr_set_flt(mp->x, x, MPFR_RNDN);
+        mpfr_tan(mp->result, mp->x, MPFR_RNDN);
+        float z = mpfr_get_flt(mp->result, MPFR_RNDN);
+
+        mpfr_sub_d(mp->error, mp->result, y, MPFR_RNDN);
+        mpfr_abs(mp->error, mp->error, MPFR_RNDN);
+        float abs_error = mpfr_get_flt(mp->error, MPFR_RNDN);
+        float rel_error = abs_error / ulp(z);
+        if (rel_error >= 1.0f) {
+            flockfile(stderr);
+            fprintf(stderr, "%*stan(%a) = %a, expected %a\n", indent, "", x, y, z);
+            funlockfile(stderr);
+        }
+        harness_count(stats, j, abs_error, rel_error);
+    }
+}
+
+static void
+test_double_chunk(const void *context, void *local, size_t chunk, harness_stats *stats)
+{
+    const test_context *test = context;
+    harness_mp *mp = local;
+    harness_random g = harness_chunk_random(chunk);
+    size_t j = chunk / harness_chunks(n, chunk_size);
+    size_t first = (chunk % harness_chunks(n, chunk_size)) * chunk_size;
+    double m = test->magnitudes[j < test->n_magnitudes ? j : 0];
+    size_t last = j < test->n_magnitudes ? n : 2 * test->n_hard_cases;
+    for (size_t i = first; i < last && i < first + chunk_size; i++) {
+        double x = ((harness_uniform(&g) - 0.5) * 2.0 * m);
+        if (test->poles) {
+            double k = floor(harness_uniform(&g) * m);
+            x = (k + 0.5) * M_PI;
+            for (int d = (int) (harness_next(&g) % 17) - 8; d != 0; d += d < 0 ? 1 : -1)
+                x = nextafter(x, d < 0 ? 0.0 : INFINITY);
+        }
+        if (j == test->n_magnitudes)
+            x = i % 2 == 0 ? test->hard_cases[i / 2] : -test->hard_cases[i / 2];
+        double y = _tan(x);
+
+        mpfr_set_d(mp->x, x, MPFR_RNDN);
+        mpfr_tan(mp->result, mp->x, MPFR_RNDN);
+        double z = mpfr_get_d(mp->result, MPFR_RNDN);
+
+        mpfr_sub_d(mp->error, mp->result, y, MPFR_RNDN);
+        mpfr_abs(mp->error, mp->error, MPFR_RNDN);
+        double abs_error = mpfr_get_d(mp->error, MPFR_RNDN);
+        double rel_error = abs_error / ulp(z);
+        if (rel_error >= 1.0) {
+            flockfile(stderr);
+            fprintf(stderr, "%*stan(%a) = %a, expected %a\n", indent, "", x, y, z);
+            funlockfile(stderr);
+        }
+        harness_count(stats, j, abs_error, rel_error);
+    }
+}
+
+static void
+test_float(int poles)
+{
+    printf("testing float tan%s ...\n\n", poles ? " (poles)" : "");
+    indent += 4;
+    double magnitudes[N_MAGNITUDES_FLOAT];
+    for (size_t j = 0; j < N_MAGNITUDES_FLOAT; j++)
+        magnitudes[j] = magnitudes_float[j];
+    test_context context = {
+        magnitudes, poles ? N_CW_MAGNITUDES_FLOAT : N_MAGNITUDES_FLOAT,
+        poles, hard_cases_float, poles ? N_HARD_CASES_FLOAT : 0,
+    };
+    harness_job job = {
+        .context = &context,
+        .n_chunks = context.n_magnitudes * harness_chunks(n, chunk_size) + (context.n_hard_cases > 0),
+        .local_size = sizeof (harness_mp),
+        .init = &harness_mp_init,
+        .clear = &harness_mp_clear,
+        .chunk = &test_float_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
+    assert(harness_total(&stats) == context.n_magnitudes * n + 2 * context.n_hard_cases);
+    harness_print_stats(&stats, magnitudes, context.n_magnitudes, 3, indent);
+    if (context.n_hard_cases > 0) {
+        printf("%*smaximum error (ulp) of the hard cases:\n", indent, "");
+        printf("%*s%14s %14.3f\n", indent, "", "hard cases", stats.max_rel_error[context.n_magnitudes]);
+        printf("\n");
+    }
+    indent -= 4;
+}
+
+static void
+test_double(int poles)
+{
+    printf("testing double tan%s ...\n\n", poles ? " (poles)" : "");
+    indent += 4;
+    test_context context = {
+        magnitudes_double, poles ? N_CW_MAGNITUDES_DOUBLE : N_MAGNITUDES_DOUBLE,
+        poles, hard_cases_double, poles ? N_HARD_CASES_DOUBLE : 0,
+    };
+    harness_job job = {
+        .context = &context,
+        .n_chunks = context.n_magnitudes * harness_chunks(n, chunk_size) + (context.n_hard_cases > 0),
+        .local_size = sizeof (harness_mp),
+        .init = &harness_mp_init,
+        .clear = &harness_mp_clear,
+        .chunk = &test_double_chunk,
+    };
+    harness_stats stats = {0};
+    harness_run(&job, &stats);
+    assert(harness_total(&stats) == context.n_magnitudes * n + 2 * context.n_hard_cases);
+    harness_print_stats(&stats, magnitudes_double, context.n_magnitudes, 3, indent);
+    if (context.n_hard_cases > 0) {
+        printf("%*smaximum error (ulp) of the hard cases:\n", indent, "");
+        printf("%*s%14s %14.3f\n", indent, "", "hard cases", stats.max_rel_error[context.n_magnitudes]);
+        printf("\n");
+    }
+    indent -= 4;
+}
+
+/*
+ * The array functions, against the scalar functions, on the magnitudes
+ * and special values, with a length that is not a multiple of 16.
+ */
+
+static const double special_values[] = {
+    0.0, -0.0, 0x1.0p-1074, 0x1.0p-149, 0x1.0p-30, 1.0,
+    0x1.921fb54442d18p0, 0x1.921fb6p0, 0x1.921fb54442d18p1, 0x1.0p23,
+    0x1.0p52, 0x1.0p60, 0x1.fffffffffffffp1023, INFINITY, NAN,
+};
+
+#define N_SPECIAL_VALUES (sizeof special_values / sizeof special_values[0])
+
+#define N_ARRAY 1001
+
+static int
+same_float(float a, float b)
+{
+    return a == b || (isnan(a) && isnan(b));
+}
+
+static int
+same_double(double a, double b)
+{
+    return a == b || (isnan(a) && isnan(b));
+}
+
+static void
+test_arrays(void)
+{
+    static float xfs[N_ARRAY], yfs[N_ARRAY];
+    static double xds[N_ARRAY], yds[N_ARRAY];
+    harness_random g = harness_chunk_random(0);
+    size_t mismatches_float = 0;
+    size_t mismatches_double = 0;
+    for (size_t i = 0; i < N_ARRAY; i++) {
+        double x = i < N_SPECIAL_VALUES ? special_values[i]
+            : (harness_uniform(&g) - 0.5) * 2.0 * magnitudes_double[i % N_MAGNITUDES_DOUBLE];
+        xfs[i] = (float) x;
+        xds[i] = x;
+    }
+    _tan_array(xfs, yfs, N_ARRAY);
+    _tan_array(xds, yds, N_ARRAY);
+    for (size_t i = 0; i < N_ARRAY; i++) {
+        mismatches_float += !same_float(yfs[i], _tan(xfs[i]));
+        mismatches_double += !same_double(yds[i], _tan(xds[i]));
+    }
+    printf("testing arrays ...\n\n");
+    printf("    mismatches:\n");
+    printf("         float %zu\n", mismatches_float);
+    printf("        double %zu\n", mismatches_double);
+    printf("\n");
+}
+
+int
+main(void)
+{
+    test_float(0);
+    test_float(1);
+    test_double(0);
+    test_double(1);
+    test_arrays();
+    return 0;
+}
@@ -0,0 +1,157 @@
+/* Copyright 2025, Mansour Moufid <mansourmoufid@gmail.com> */
+
+/*
+ * Test that loops calling _sin and _cos, vectorized onto the variants of
+ * the vector function ABI (sincos-vector.h), give the same results as the
+ * array functions, bit for bit. Compile with -O3 (and -fopenmp-simd for
+ * clang) so that the loops are vectorized.
+ */
+
+#include <assert.h>
+#include <math.h> // ldexp
+#include <stddef.h> // size_t, NULL
+#include <stdlib.h> // calloc, drand48
+#include <stdio.h> // printf
+#include <string.h> // memcmp
+#include <time.h>
+
+#include "sincos-vector.h"
+#include "sincos.h"
+
+// The size of the test arrays.
+static const size_t n = 1000003;
+
+static int indent = 0;
+
+/*
+ * The same loops, compiled for each variant of the ABI.
+ */
+
+#define TEST_LOOPS(name, features) \
+    __attribute__((target(features))) \
+    static void \
+    loop_float_##name(const float *restrict xs, float *restrict ss, float *restrict cs, size_t m) \
+    { \
+        for (size_t i = 0; i < m; i++) \
+            ss[i] = _sin_float(xs[i]); \
+        for (size_t i = 0; i < m; i++) \
+            cs[i] = _cos_float(xs[i]); \
+    } \
+    __attribute__((target(features))) \
+    static void \
+    loop_double_##name(const double *restrict xs, double *restrict ss, double *restrict cs, size_t m) \
+    { \
+        for (size_t i = 0; i < m; i++) \
+            ss[i] = _sin_double(xs[i]); \
+        for (size_t i = 0; i < m; i++) \
+            cs[i] = _cos_double(xs[i]); \
+    }
+
+#if defined(__x86_64__)
+TEST_LOOPS(sse, "sse2")
+TEST_LOOPS(avx, "avx")
+TEST_LOOPS(avx2, "avx2")
+TEST_LOOPS(avx512, "avx512f")
+#endif
+
+static const struct {
+    const char *name;
+    const char *feature; // for __builtin_cpu_supports
+    void (*loop_float)(const float *restrict, float *restrict, float *restrict, size_t);
+    void (*loop_double)(const double *restrict, double *restrict, double *restrict, size_t);
+} variants[] = {
+#if defined(__x86_64__)
+    {"sse", "sse2", &loop_float_sse, &loop_double_sse},
+    {"avx", "avx", &loop_float_avx, &loop_double_avx},
+    {"avx2", "avx2", &loop_float_avx2, &loop_double_avx2},
+    {"avx-512", "avx512f", &loop_float_avx512, &loop_double_avx512},
+#endif
+};
+
+static const size_t n_variants = sizeof variants / sizeof variants[0];
+
+static int
+supported(const char *feature)
+{
+    __builtin_cpu_init();
+    if (strcmp(feature, "sse2") == 0)
+        return __builtin_cpu_supports("sse2");
+    if (strcmp(feature, "avx") == 0)
+        return __builtin_cpu_supports("avx");
+    if (strcmp(feature, "avx2") == 0)
+        return __builtin_cpu_supports("avx2");
+    if (strcmp(feature, "avx512f") == 0)
+        return __builtin_cpu_supports("avx512f");
+    return 0;
+}
+
+static size_t
+mismatches_float(const float *a, const float *b, size_t m)
+{
+    size_t k = 0;
+    for (size_t i = 0; i < m; i++)
+        k += memcmp(&a[i], &b[i], sizeof (float)) != 0;
+    return k;
+}
+
+static size_t
+mismatches_double(const double *a, const double *b, size_t m)
+{
+    size_t k = 0;
+    for (size_t i = 0; i < m; i++)
+        k += memcmp(&a[i], &b[i], sizeof (double)) != 0;
+    return k;
+}
+
+int
+main(void)
+{
+    float *xfs = calloc(n, sizeof (float));
+    float *sfs = calloc(n, sizeof (float));
+    float *cfs = calloc(n, sizeof (float));
+    float *yfs = calloc(n, sizeof (float));
+    float *zfs = calloc(n, sizeof (float));
+    double *xds = calloc(n, sizeof (double));
+    double *sds = calloc(n, sizeof (double));
+    double *cds = calloc(n, sizeof (double));
+    double *yds = calloc(n, sizeof (double));
+    double *zds = calloc(n, sizeof (double));
+    assert(xfs != NULL && sfs != NULL && cfs != NULL && yfs != NULL && zfs != NULL);
+    assert(xds != NULL && sds != NULL && cds != NULL && yds != NULL && zds != NULL);
+
+    srand48(time(NULL));
+    for (size_t i = 0; i < n; i++) {
+        double x = ldexp(drand48() - 0.5, (int) (drand48() * 96.0) - 32);
+        xds[i] = x;
+        xfs[i] = (float) x;
+    }
+    _sincos_array(xfs, sfs, cfs, n);
+    _sincos_array(xds, sds, cds, n);
+
+    printf("testing the vector function ABI ...\n\n");
+    indent += 4;
+    printf("%*smismatches:%14s%14s%14s%14s\n", indent, "", "float sin", "float cos", "double sin", "double cos");
+    for (size_t v = 0; v < n_variants; v++) {
+        if (!supported(variants[v].feature))
+            continue;
+        (*variants[v].loop_float)(xfs, yfs, zfs, n);
+        (*variants[v].loop_double)(xds, yds, zds, n);
+        printf("%*s%11s%14zu%14zu%14zu%14zu\n", indent, "", variants[v].name,
+            mismatches_float(yfs, sfs, n), mismatches_float(zfs, cfs, n),
+            mismatches_double(yds, sds, n), mismatches_double(zds, cds, n));
+    }
+    printf("\n");
+    indent -= 4;
+
+    free(zds);
+    free(yds);
+    free(cds);
+    free(sds);
+    free(xds);
+    free(zfs);
+    free(yfs);
+    free(cfs);
+    free(sfs);
+    free(xfs);
+    return 0;
+}
@@ -14,6 +14,12 @@ typedef struct {
     double b;
 } tuple_double;
 
+typedef struct {
+    double a;
+    double b;
+    double c;
+} triple_double;
+
 typedef struct {
     int32_t z;
     float v1;
@@ -25,3 +31,33 @@ typedef struct {
     double v1;
     double v2;
 } rem_result_double;
+
+typedef struct {
+    int64_t z;
+    double v1;
+    double v2;
+    double v3;
+} rem_result_triple_double;
+
+/*
+ * z = k + σ, where σ is a large bias, such that the two low bits
+ * of the mantissa of z are k mod 4.
+ */
+
+typedef struct {
+    float z;
+    float v1;
+    float v2;
+} quadrant_result_float;
+
+typedef struct {
+    double z;
+    double v1;
+    double v2;
+} quadrant_result_double;
+
+// {sin, cos}, each as a double-double
+typedef struct {
+    tuple_double s;
+    tuple_double c;
+} sincos_result_double;